@@ -0,0 +1,435 @@
+#ifndef I18N_BENCH_HPP
+#define I18N_BENCH_HPP
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench
+{
+  /**
+   * @brief Keep @p value alive so the optimizer cannot drop the code that computed it.
+   */
+  template <typename T>
+  inline void doNotOptimize(const T &value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+  }
+
+  /**
+   * @brief Hardware cache counters for the calling thread (Linux perf events).
+   *
+   * Counts L1 data cache read misses and last-level cache misses. When perf events are not
+   * available (other platforms, containers, perf_event_paranoid) available() is false and
+   * the benchmarks report timings only.
+   */
+  struct CacheCounters
+  {
+  private:
+#if defined(__linux__)
+    int l1d = -1;
+    int llc = -1;
+
+    static int open(std::uint32_t type, std::uint64_t config)
+    {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = type;
+      attr.config = config;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    static std::uint64_t read(int fd)
+    {
+      std::uint64_t value = 0;
+      if (fd < 0 || ::read(fd, &value, sizeof(value)) != sizeof(value))
+      {
+        return 0;
+      }
+      return value;
+    }
+#endif
+
+  public:
+    CacheCounters()
+    {
+#if defined(__linux__)
+      l1d = open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+      llc = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#endif
+    }
+
+    ~CacheCounters()
+    {
+#if defined(__linux__)
+      if (l1d >= 0)
+      {
+        close(l1d);
+      }
+      if (llc >= 0)
+      {
+        close(llc);
+      }
+#endif
+    }
+
+    CacheCounters(const CacheCounters &) = delete;
+    CacheCounters &operator=(const CacheCounters &) = delete;
+
+    bool available() const
+    {
+#if defined(__linux__)
+      return l1d >= 0 || llc >= 0;
+#else
+      return false;
+#endif
+    }
+
+    void start()
+    {
+#if defined(__linux__)
+      for (int fd : {l1d, llc})
+      {
+        if (fd >= 0)
+        {
+          ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+          ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+      }
+#endif
+    }
+
+    /**
+     * @brief Stop counting and return the counts since start() by counter name
+     */
+    std::map<std::string, double> stop()
+    {
+      std::map<std::string, double> counts;
+#if defined(__linux__)
+      for (int fd : {l1d, llc})
+      {
+        if (fd >= 0)
+        {
+          ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+      }
+      if (l1d >= 0)
+      {
+        counts["l1d_misses"] = static_cast<double>(read(l1d));
+      }
+      if (llc >= 0)
+      {
+        counts["llc_misses"] = static_cast<double>(read(llc));
+      }
+#endif
+      return counts;
+    }
+  };
+
+  /**
+   * @brief Result of one benchmark: one sample per repetition plus averaged counters.
+   */
+  struct Result
+  {
+    std::string name;
+    std::string unit;
+    std::vector<double> samples;
+    std::map<std::string, double> counters;
+
+    double median() const
+    {
+      std::vector<double> sorted = samples;
+      std::sort(sorted.begin(), sorted.end());
+      std::size_t mid = sorted.size() / 2;
+      return sorted.size() % 2 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+    }
+  };
+
+  /**
+   * @brief Command-line driven benchmark runner shared by every benchmark executable.
+   *
+   * Options:
+   * - `--repetitions <n>`  samples per benchmark (default 5)
+   * - `--min-time <sec>`   minimum duration of one repetition (default 0.2)
+   * - `--filter <text>`    only run benchmarks whose name contains text
+   * - `--json <file>`      also write results as JSON
+   *
+   * Unrecognized `--name value` pairs are kept and can be read with option().
+   *
+   * The JSON output has the shape
+   * `{"context": {...}, "benchmarks": [{"name", "unit", "samples": [...], "counters": {...}}]}`
+   * with one sample per repetition, so results can be compared statistically across runs.
+   */
+  struct Runner
+  {
+  private:
+    int repetitions = 5;
+    double minTime = 0.2;
+    std::string filter;
+    std::string jsonPath;
+    std::map<std::string, std::string> extra;
+    nlohmann::json context = nlohmann::json::object();
+    std::vector<Result> results;
+    CacheCounters counters;
+
+    void print(const Result &result) const
+    {
+      auto minmax = std::minmax_element(result.samples.begin(), result.samples.end());
+      std::cout << std::left << std::setw(44) << result.name << std::right << std::fixed << std::setprecision(2)
+                << std::setw(12) << result.median() << " " << std::left << std::setw(8) << result.unit << std::right
+                << " [" << *minmax.first << " .. " << *minmax.second << "]";
+      for (const auto &[name, value] : result.counters)
+      {
+        std::cout << "  " << name << "=" << std::setprecision(3) << value;
+      }
+      std::cout << std::endl;
+    }
+
+  public:
+    Runner(int argc, char **argv)
+    {
+      for (int i = 1; i + 1 < argc; i += 2)
+      {
+        std::string name = argv[i];
+        std::string value = argv[i + 1];
+        if (name == "--repetitions")
+        {
+          repetitions = std::max(1, std::stoi(value));
+        }
+        else if (name == "--min-time")
+        {
+          minTime = std::stod(value);
+        }
+        else if (name == "--filter")
+        {
+          filter = value;
+        }
+        else if (name == "--json")
+        {
+          jsonPath = value;
+        }
+        else if (name.rfind("--", 0) == 0)
+        {
+          extra[name.substr(2)] = value;
+        }
+      }
+      context["repetitions"] = repetitions;
+      context["cacheCounters"] = counters.available();
+    }
+
+    /**
+     * @brief Read a benchmark-specific option passed as `--name value`
+     */
+    std::string option(const std::string &name, const std::string &defaultValue) const
+    {
+      auto it = extra.find(name);
+      return it != extra.end() ? it->second : defaultValue;
+    }
+
+    /**
+     * @brief Samples taken per benchmark (`--repetitions`)
+     */
+    int repetitionCount() const
+    {
+      return repetitions;
+    }
+
+    /**
+     * @brief Minimum duration of one repetition in seconds (`--min-time`)
+     */
+    double minimumTime() const
+    {
+      return minTime;
+    }
+
+    /**
+     * @brief Record a key/value pair describing the run (sizes, modes) in the JSON context
+     */
+    template <typename T>
+    void describe(const std::string &name, const T &value)
+    {
+      context[name] = value;
+    }
+
+    /**
+     * @brief Whether a benchmark with this name passes the filter
+     */
+    bool enabled(const std::string &name) const
+    {
+      return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    /**
+     * @brief Time @p fn, which performs @p opsPerCall operations per invocation
+     *
+     * The iteration count is calibrated so that one repetition lasts at least the
+     * minimum time; samples and cache counters are reported per operation.
+     */
+    template <typename Fn>
+    void run(const std::string &name, std::size_t opsPerCall, Fn &&fn)
+    {
+      if (!enabled(name))
+      {
+        return;
+      }
+
+      using Clock = std::chrono::steady_clock;
+      fn();
+
+      std::size_t iterations = 1;
+      for (;;)
+      {
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+          fn();
+        }
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        if (elapsed >= minTime || iterations >= (std::size_t{1} << 30))
+        {
+          break;
+        }
+        iterations = elapsed > 0 ? std::max(iterations * 2, static_cast<std::size_t>(iterations * minTime * 1.2 / elapsed)) : iterations * 10;
+      }
+
+      Result result;
+      result.name = name;
+      result.unit = "ns/op";
+      double ops = static_cast<double>(iterations) * static_cast<double>(opsPerCall);
+      for (int r = 0; r < repetitions; ++r)
+      {
+        counters.start();
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+          fn();
+        }
+        double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        for (const auto &[counter, value] : counters.stop())
+        {
+          result.counters[counter + "_per_op"] += value / ops / repetitions;
+        }
+        result.samples.push_back(elapsed / ops);
+      }
+
+      print(result);
+      results.push_back(std::move(result));
+    }
+
+    /**
+     * @brief Record externally measured samples (e.g., from child processes)
+     */
+    void record(Result result)
+    {
+      if (!enabled(result.name))
+      {
+        return;
+      }
+      print(result);
+      results.push_back(std::move(result));
+    }
+
+    /**
+     * @brief Write the JSON report if requested
+     *
+     * @return int Process exit code
+     */
+    int finish() const
+    {
+      if (jsonPath.empty())
+      {
+        return 0;
+      }
+
+      nlohmann::json benchmarks = nlohmann::json::array();
+      for (const auto &result : results)
+      {
+        benchmarks.push_back({{"name", result.name},
+                              {"unit", result.unit},
+                              {"samples", result.samples},
+                              {"counters", result.counters}});
+      }
+
+      std::ofstream ofs(jsonPath);
+      if (!ofs.is_open())
+      {
+        std::cerr << "Could not open file: " << jsonPath << std::endl;
+        return 1;
+      }
+      ofs << nlohmann::json{{"context", context}, {"benchmarks", benchmarks}}.dump(2) << std::endl;
+      return 0;
+    }
+  };
+
+  /**
+   * @brief Small deterministic PRNG (splitmix64) so every run sees the same data.
+   */
+  struct Random
+  {
+    std::uint64_t state;
+
+    explicit Random(std::uint64_t seed = 0x9e3779b97f4a7c15ull) : state(seed) {}
+
+    std::uint64_t next()
+    {
+      std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+      return z ^ (z >> 31);
+    }
+
+    std::size_t below(std::size_t bound)
+    {
+      return static_cast<std::size_t>(next() % bound);
+    }
+  };
+
+  /**
+   * @brief Generate a synthetic catalog: @p keys keys in @p locales locales, nested two levels deep.
+   */
+  inline nlohmann::json syntheticCatalog(std::size_t keys, std::size_t locales, std::uint64_t seed = 1)
+  {
+    static const char *const codes[] = {"en", "id", "de", "fr", "es", "it", "pt", "nl", "sv", "pl", "tr", "ru", "ja", "ko", "zh", "ar"};
+    Random random(seed);
+    nlohmann::json json = nlohmann::json::object();
+    for (std::size_t l = 0; l < locales; ++l)
+    {
+      std::string code = l < sizeof(codes) / sizeof(codes[0]) ? codes[l] : "x" + std::to_string(l);
+      nlohmann::json &tree = json[code];
+      for (std::size_t k = 0; k < keys; ++k)
+      {
+        std::string text = code + " text " + std::to_string(k) + " ";
+        text.append(random.below(32), 'a' + static_cast<char>(l % 26));
+        tree["section" + std::to_string(k / 100)]["key" + std::to_string(k % 100)] = text;
+      }
+    }
+    return json;
+  }
+} // namespace bench
+
+#endif // I18N_BENCH_HPP
@@ -0,0 +1,300 @@
+// Cold start: time and page faults until a fresh process has its first translation.
+//
+// Every sample launches a new process (fork + exec of this executable), which loads the
+// translations one way and looks up one key:
+//
+//   json-file:   I18n from the JSON file path
+//   json-object: the file parsed into nlohmann::json first, then I18n from that object
+//   binary:      Catalog::load() of a binary catalog (read into memory)
+//   mmap:        Catalog::fromBytes() over a MappedFile of the binary catalog (no copy)
+//   embedded:    Catalog::fromBytes() over a catalog compiled into the executable
+//                (built by i18nBenchEmbed; its size is fixed at build time)
+//
+// Per mode and catalog size it reports, one sample per process:
+//   startup: fork to first translation, including exec and dynamic loading (ms)
+//   main:    main() to first translation (ms)
+//   faults:  minor page faults from main() to the first translation; major faults over the
+//            same span, and minor faults since exec (dynamic loading, static init), in counters
+//
+// Data files are evicted from the page cache before each launch (--drop-cache 0 keeps them
+// cached); the executable itself stays cached.
+//
+// Usage: i18nBenchColdStart [--sizes 1000,10000,100000] [--locales 8] [--drop-cache 1]
+//                           [runner options]
+
+#include "bench.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/i18n.hpp>
+#include <i18n/mapped_file.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "embedded_catalog.inc"
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  const char *const modes[] = {"json-file", "json-object", "binary", "mmap", "embedded"};
+  const char *const probeKey = "section0.key1";
+  const char *const probeLocale = "de";
+
+  /**
+   * @brief A point in a process's life: monotonic time and page faults so far
+   */
+  struct Probe
+  {
+    std::int64_t nanoseconds;
+    long minorFaults;
+    long majorFaults;
+  };
+
+  Probe probe()
+  {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count(),
+            usage.ru_minflt, usage.ru_majflt};
+  }
+
+  /**
+   * @brief Load the translations the way @p mode does and return the first translation's size
+   */
+  std::size_t firstTranslation(const std::string &mode, const std::string &path)
+  {
+    if (mode == "json-file")
+    {
+      I18n i18n(path);
+      return i18n.t(probeKey, probeLocale).size();
+    }
+    if (mode == "json-object")
+    {
+      std::ifstream in(path);
+      nlohmann::json json = nlohmann::json::parse(in);
+      I18n i18n(json);
+      return i18n.t(probeKey, probeLocale).size();
+    }
+
+    i18n::Catalog catalog;
+    if (mode == "binary")
+    {
+      catalog = i18n::Catalog::load(path);
+    }
+    else if (mode == "mmap")
+    {
+      auto file = std::make_shared<i18n::MappedFile>(path);
+      catalog = i18n::Catalog::fromBytes(std::shared_ptr<const char>(file, file->data()), file->size());
+    }
+    else if (mode == "embedded")
+    {
+      catalog = i18n::Catalog::fromBytes(std::shared_ptr<const char>(embeddedCatalog, [](const char *) {}), sizeof(embeddedCatalog) - 1);
+    }
+    else
+    {
+      throw std::runtime_error("Unknown mode: " + mode);
+    }
+    return catalog.t_view(probeKey, probeLocale).size();
+  }
+
+  /**
+   * @brief Child side: `--child <mode> <path> <spawn ns>`; prints the measurements on stdout
+   */
+  int child(const Probe &start, char **argv)
+  {
+    std::size_t size = firstTranslation(argv[2], argv[3]);
+    Probe first = probe();
+    if (size == 0)
+    {
+      std::cerr << "No translation for " << probeKey << std::endl;
+      return 1;
+    }
+    std::cout << first.nanoseconds - std::stoll(argv[4]) << " " << first.nanoseconds - start.nanoseconds << " "
+              << first.minorFaults - start.minorFaults << " " << first.majorFaults - start.majorFaults << " "
+              << first.minorFaults << std::endl;
+    return 0;
+  }
+
+  /**
+   * @brief Drop a file's pages from the page cache, so the next launch reads it from disk
+   */
+  void evict(const std::string &path)
+  {
+#if defined(POSIX_FADV_DONTNEED)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+      fdatasync(fd);
+      posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+      close(fd);
+    }
+#else
+    (void)path;
+#endif
+  }
+
+  /**
+   * @brief What one child process measured
+   */
+  struct Sample
+  {
+    double startupMs = 0;
+    double mainMs = 0;
+    double minorFaults = 0;     // since main()
+    double majorFaults = 0;     // since main()
+    double execMinorFaults = 0; // since exec
+  };
+
+  /**
+   * @brief Launch one child process and parse what it measured
+   */
+  bool launch(const std::string &self, const std::string &mode, const std::string &path, Sample &sample)
+  {
+    int channel[2];
+    if (pipe(channel) != 0)
+    {
+      return false;
+    }
+
+    std::string spawned = std::to_string(probe().nanoseconds);
+    std::vector<const char *> arguments = {self.c_str(), "--child", mode.c_str(), path.c_str(), spawned.c_str(), nullptr};
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+      dup2(channel[1], STDOUT_FILENO);
+      close(channel[0]);
+      close(channel[1]);
+      execv(self.c_str(), const_cast<char *const *>(arguments.data()));
+      _exit(127);
+    }
+    close(channel[1]);
+    if (pid < 0)
+    {
+      close(channel[0]);
+      return false;
+    }
+
+    std::string output;
+    char buffer[256];
+    for (ssize_t n; (n = read(channel[0], buffer, sizeof(buffer))) > 0;)
+    {
+      output.append(buffer, static_cast<std::size_t>(n));
+    }
+    close(channel[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+      return false;
+    }
+
+    std::istringstream in(output);
+    double startupNs = 0;
+    double mainNs = 0;
+    in >> startupNs >> mainNs >> sample.minorFaults >> sample.majorFaults >> sample.execMinorFaults;
+    sample.startupMs = startupNs / 1e6;
+    sample.mainMs = mainNs / 1e6;
+    return static_cast<bool>(in);
+  }
+
+  /**
+   * @brief Launch one process per repetition for @p mode and record the results
+   */
+  void measure(bench::Runner &runner, const std::string &self, const std::string &mode, const std::string &path,
+               std::size_t keys, bool dropCache)
+  {
+    std::string prefix = "coldstart/" + mode + "/keys:" + std::to_string(keys);
+    bench::Result startup{prefix + "/startup", "ms", {}, {}};
+    bench::Result fromMain{prefix + "/main", "ms", {}, {}};
+    bench::Result faults{prefix + "/faults", "faults", {}, {}};
+    if (!runner.enabled(startup.name) && !runner.enabled(fromMain.name) && !runner.enabled(faults.name))
+    {
+      return;
+    }
+
+    for (int r = 0; r < runner.repetitionCount(); ++r)
+    {
+      if (dropCache && mode != "embedded")
+      {
+        evict(path);
+      }
+      Sample sample;
+      if (!launch(self, mode, path, sample))
+      {
+        std::cerr << prefix << ": child process failed" << std::endl;
+        return;
+      }
+      startup.samples.push_back(sample.startupMs);
+      fromMain.samples.push_back(sample.mainMs);
+      faults.samples.push_back(sample.minorFaults);
+      faults.counters["major"] += sample.majorFaults / runner.repetitionCount();
+      faults.counters["since_exec"] += sample.execMinorFaults / runner.repetitionCount();
+    }
+
+    runner.record(std::move(startup));
+    runner.record(std::move(fromMain));
+    runner.record(std::move(faults));
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  Probe start = probe();
+  if (argc == 5 && std::string(argv[1]) == "--child")
+  {
+    try
+    {
+      return child(start, argv);
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << e.what() << std::endl;
+      return 1;
+    }
+  }
+
+  bench::Runner runner(argc, argv);
+  std::string sizeList = runner.option("sizes", "1000,10000,100000");
+  std::size_t localeCount = std::stoul(runner.option("locales", "8"));
+  bool dropCache = runner.option("drop-cache", "1") != "0";
+  runner.describe("sizes", sizeList);
+  runner.describe("locales", localeCount);
+  runner.describe("dropCache", dropCache);
+  runner.describe("embeddedKeys", embeddedCatalogKeys);
+  runner.describe("embeddedLocales", embeddedCatalogLocales);
+
+  std::string self = std::filesystem::exists("/proc/self/exe") ? std::filesystem::read_symlink("/proc/self/exe").string() : argv[0];
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / ("i18n-bench-coldstart-" + std::to_string(getpid()));
+  std::filesystem::create_directories(directory);
+
+  std::istringstream sizes(sizeList);
+  for (std::string size; std::getline(sizes, size, ',');)
+  {
+    std::size_t keyCount = std::stoul(size);
+    nlohmann::json json = bench::syntheticCatalog(keyCount, localeCount);
+    std::string jsonPath = (directory / ("catalog-" + size + ".json")).string();
+    std::string binaryPath = (directory / ("catalog-" + size + ".i18nc")).string();
+    std::ofstream(jsonPath) << json.dump();
+    i18n::Catalog(json).save(binaryPath);
+
+    for (const char *mode : modes)
+    {
+      std::string name = mode;
+      if (name != "embedded")
+      {
+        measure(runner, self, name, name.rfind("json", 0) == 0 ? jsonPath : binaryPath, keyCount, dropCache);
+      }
+    }
+  }
+  measure(runner, self, "embedded", "", embeddedCatalogKeys, dropCache);
+
+  std::filesystem::remove_all(directory);
+  return runner.finish();
+}
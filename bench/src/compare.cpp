@@ -0,0 +1,321 @@
+// Compare two benchmark result files written with `--json` and flag regressions.
+//
+// For every benchmark present in both files, the per-repetition samples are compared with a
+// two-sided Mann-Whitney U test (exact for small samples without ties, normal approximation
+// with tie correction otherwise). A benchmark regresses when its median moved in the worse
+// direction by more than the threshold and the difference is significant. Units ending in
+// "/s" (throughput) are better when higher; all others (time, bytes, faults) when lower.
+//
+// Usage: i18nBenchCompare <baseline.json> <candidate.json> [--threshold 0.05] [--alpha 0.05]
+//                         [--filter <text>]
+//
+// Exit status: 0 without regressions, 1 if any benchmark regressed, 2 on usage or input errors
+// and when some benchmark has too few samples to reach significance (and none regressed).
+
+#include "bench.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+namespace
+{
+  /**
+   * @brief Outcome of a Mann-Whitney U test
+   */
+  struct MannWhitney
+  {
+    double u = 0;
+    double p = 1;
+
+    /**
+     * @brief Smallest two-sided p-value the test can reach with these sample sizes
+     */
+    double smallestP = 1;
+  };
+
+  /**
+   * @brief Number of arrangements of @p n1 + @p n2 distinct values with each U statistic (U counts
+   * the pairs where the first sample is larger)
+   */
+  std::vector<double> exactDistribution(std::size_t n1, std::size_t n2)
+  {
+    // counts[i][j][u] via the recurrence f(i, j, u) = f(i - 1, j, u - j) + f(i, j - 1, u).
+    std::vector<std::vector<std::vector<double>>> counts(n1 + 1, std::vector<std::vector<double>>(n2 + 1));
+    for (std::size_t i = 0; i <= n1; ++i)
+    {
+      for (std::size_t j = 0; j <= n2; ++j)
+      {
+        std::vector<double> &f = counts[i][j];
+        f.assign(i * j + 1, 0);
+        if (i == 0 || j == 0)
+        {
+          f[0] = 1;
+          continue;
+        }
+        for (std::size_t u = 0; u < f.size(); ++u)
+        {
+          if (u >= j && u - j < counts[i - 1][j].size())
+          {
+            f[u] += counts[i - 1][j][u - j];
+          }
+          if (u < counts[i][j - 1].size())
+          {
+            f[u] += counts[i][j - 1][u];
+          }
+        }
+      }
+    }
+    return counts[n1][n2];
+  }
+
+  MannWhitney mannWhitney(const std::vector<double> &a, const std::vector<double> &b)
+  {
+    MannWhitney result;
+    std::size_t n1 = a.size();
+    std::size_t n2 = b.size();
+    if (n1 == 0 || n2 == 0)
+    {
+      return result;
+    }
+
+    // Ranks of the pooled samples, ties sharing their average rank.
+    std::vector<std::pair<double, std::size_t>> pooled;
+    for (double value : a)
+    {
+      pooled.push_back({value, 0});
+    }
+    for (double value : b)
+    {
+      pooled.push_back({value, 1});
+    }
+    std::sort(pooled.begin(), pooled.end());
+
+    double rankSumA = 0;
+    double tieTerm = 0;
+    bool ties = false;
+    for (std::size_t i = 0; i < pooled.size();)
+    {
+      std::size_t j = i;
+      while (j < pooled.size() && pooled[j].first == pooled[i].first)
+      {
+        ++j;
+      }
+      double rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2;
+      for (std::size_t k = i; k < j; ++k)
+      {
+        rankSumA += pooled[k].second == 0 ? rank : 0;
+      }
+      double t = static_cast<double>(j - i);
+      tieTerm += t * t * t - t;
+      ties = ties || j - i > 1;
+      i = j;
+    }
+
+    double x = static_cast<double>(n1);
+    double y = static_cast<double>(n2);
+    result.u = rankSumA - x * (x + 1) / 2;
+
+    if (!ties && n1 + n2 <= 40)
+    {
+      std::vector<double> distribution = exactDistribution(n1, n2);
+      double total = 0;
+      for (double count : distribution)
+      {
+        total += count;
+      }
+      auto u = static_cast<std::size_t>(result.u);
+      double below = 0;
+      double above = 0;
+      for (std::size_t k = 0; k < distribution.size(); ++k)
+      {
+        below += k <= u ? distribution[k] : 0;
+        above += k >= u ? distribution[k] : 0;
+      }
+      result.p = std::min(1.0, 2 * std::min(below, above) / total);
+      result.smallestP = std::min(1.0, 2 * distribution[0] / total);
+      return result;
+    }
+
+    double n = x + y;
+    double mean = x * y / 2;
+    double variance = x * y / 12 * ((n + 1) - tieTerm / (n * (n - 1)));
+    if (variance <= 0)
+    {
+      return result;
+    }
+    double z = (std::abs(result.u - mean) - 0.5) / std::sqrt(variance);
+    result.p = std::min(1.0, std::erfc(std::max(0.0, z) / std::sqrt(2.0)));
+    result.smallestP = std::erfc((x * y / 2 - 0.5) / std::sqrt(x * y * (n + 1) / 12) / std::sqrt(2.0));
+    return result;
+  }
+
+  double median(std::vector<double> samples)
+  {
+    std::sort(samples.begin(), samples.end());
+    std::size_t mid = samples.size() / 2;
+    return samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+  }
+
+  bool higherIsBetter(const std::string &unit)
+  {
+    return unit.size() >= 2 && unit.compare(unit.size() - 2, 2, "/s") == 0;
+  }
+
+  nlohmann::json readResults(const std::string &path)
+  {
+    std::ifstream in(path);
+    if (!in.is_open())
+    {
+      throw std::runtime_error("Could not open file: " + path);
+    }
+    nlohmann::json json = nlohmann::json::parse(in);
+    if (!json.contains("benchmarks") || !json["benchmarks"].is_array())
+    {
+      throw std::runtime_error("Not a benchmark result file: " + path);
+    }
+    return json;
+  }
+
+  /**
+   * @brief Parse the whole of @p text as a finite number in [@p low, @p high]
+   */
+  bool parseNumber(const char *text, double low, double high, double &value)
+  {
+    char *end = nullptr;
+    double parsed = std::strtod(text, &end);
+    if (end == text || *end != '\0' || !std::isfinite(parsed) || parsed < low || parsed > high)
+    {
+      return false;
+    }
+    value = parsed;
+    return true;
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 3 || (argc - 3) % 2 != 0)
+  {
+    std::cerr << "Usage: i18nBenchCompare <baseline.json> <candidate.json> [--threshold 0.05] [--alpha 0.05] [--filter <text>]" << std::endl;
+    return 2;
+  }
+
+  double threshold = 0.05;
+  double alpha = 0.05;
+  std::string filter;
+  for (int i = 3; i + 1 < argc; i += 2)
+  {
+    std::string name = argv[i];
+    if (name == "--threshold" || name == "--alpha")
+    {
+      bool valid = name == "--threshold" ? parseNumber(argv[i + 1], 0, HUGE_VAL, threshold)
+                                         : parseNumber(argv[i + 1], 0, 1, alpha);
+      if (!valid)
+      {
+        std::cerr << "Invalid value for " << name << ": " << argv[i + 1] << std::endl;
+        return 2;
+      }
+    }
+    else if (name == "--filter")
+    {
+      filter = argv[i + 1];
+    }
+    else
+    {
+      std::cerr << "Unknown option: " << name << std::endl;
+      return 2;
+    }
+  }
+
+  nlohmann::json baseline;
+  nlohmann::json candidate;
+  try
+  {
+    baseline = readResults(argv[1]);
+    candidate = readResults(argv[2]);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << e.what() << std::endl;
+    return 2;
+  }
+
+  std::map<std::string, const nlohmann::json *> baselineByName;
+  for (const auto &benchmark : baseline["benchmarks"])
+  {
+    baselineByName[benchmark.value("name", "")] = &benchmark;
+  }
+
+  std::size_t regressions = 0;
+  std::size_t improvements = 0;
+  std::size_t compared = 0;
+  bool underpowered = false;
+  std::cout << std::left << std::setw(48) << "benchmark" << std::right << std::setw(14) << "baseline" << std::setw(14)
+            << "candidate" << std::setw(10) << "change" << std::setw(10) << "p" << "  verdict" << std::endl;
+
+  for (const auto &benchmark : candidate["benchmarks"])
+  {
+    std::string name = benchmark.value("name", "");
+    auto found = baselineByName.find(name);
+    if ((!filter.empty() && name.find(filter) == std::string::npos) || found == baselineByName.end())
+    {
+      continue;
+    }
+
+    std::vector<double> before = found->second->value("samples", std::vector<double>());
+    std::vector<double> after = benchmark.value("samples", std::vector<double>());
+    if (before.empty() || after.empty())
+    {
+      continue;
+    }
+    ++compared;
+
+    std::string unit = benchmark.value("unit", "");
+    double from = median(before);
+    double to = median(after);
+    double change = from != 0 ? (to - from) / std::abs(from) : 0;
+    double worse = higherIsBetter(unit) ? -change : change;
+    MannWhitney test = mannWhitney(before, after);
+
+    std::string verdict = "same";
+    if (test.smallestP > alpha)
+    {
+      verdict = "too few samples";
+      underpowered = true;
+    }
+    else if (test.p < alpha && worse > threshold)
+    {
+      verdict = "REGRESSION";
+      ++regressions;
+    }
+    else if (test.p < alpha && worse < -threshold)
+    {
+      verdict = "improvement";
+      ++improvements;
+    }
+
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2) << std::setw(14)
+              << from << std::setw(14) << to << std::setw(9) << std::showpos << change * 100 << "%" << std::noshowpos
+              << std::setprecision(4) << std::setw(10) << test.p << "  " << verdict << std::endl;
+  }
+
+  std::cout << std::defaultfloat << compared << " compared, " << regressions << " regressed, " << improvements << " improved"
+            << " (threshold " << threshold * 100 << "%, alpha " << alpha << ")" << std::endl;
+  if (compared == 0)
+  {
+    std::cerr << "No benchmarks in common" << std::endl;
+    return 2;
+  }
+  if (regressions)
+  {
+    return 1;
+  }
+  // Without enough samples a regression could not have been detected, so do not report success.
+  if (underpowered)
+  {
+    std::cerr << "Some benchmarks have too few repetitions to reach significance; rerun with more --repetitions." << std::endl;
+    return 2;
+  }
+  return 0;
+}
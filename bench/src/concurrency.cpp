@@ -0,0 +1,465 @@
+// Scaling of concurrent lookups while a writer publishes new data.
+//
+// 1..N reader threads look up keys drawn from a Zipfian distribution (a few hot keys, a long
+// tail) in random locales, while one writer thread replaces the data at a fixed rate:
+//
+//   json:    basic_i18n with snapshot threading; the writer reload()s the whole JSON file, or
+//            with --writer patch replaces one locale with loadShard()
+//   catalog: a compiled Catalog behind an atomic shared_ptr; the writer loads a fresh binary
+//            catalog (reload only)
+//
+// Per reader count it reports, one sample per repetition:
+//   throughput:  lookups per second over all readers (Mops/s)
+//   p50/p99/p999: lookup latency, including the clock reads around each lookup (~20 ns)
+//   lag:         reclamation lag, from publishing a new snapshot until the last reader
+//                releases the old one and it is freed (mean per repetition; max in counters)
+//
+// Usage: i18nBenchConcurrency [--keys 20000] [--locales 8] [--threads <cores>]
+//                             [--writes-per-sec 10] [--writer reload|patch] [--zipf 0.99]
+//                             [runner options]
+// Each repetition runs for --min-time seconds.
+
+#include "bench.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/i18n.hpp>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Reclamation lags of retired snapshots, collected across threads
+   */
+  struct LagLog
+  {
+  private:
+    std::mutex mutex;
+    std::unordered_map<const void *, Clock::time_point> retiredAt;
+    std::vector<double> lags;
+
+  public:
+    void retire(const void *snapshot)
+    {
+      Clock::time_point now = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex);
+      retiredAt[snapshot] = now;
+    }
+
+    void reclaim(const void *snapshot)
+    {
+      // Measured up to the release, not including the time the destructor takes.
+      Clock::time_point now = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = retiredAt.find(snapshot);
+      if (it != retiredAt.end())
+      {
+        lags.push_back(std::max(0.0, std::chrono::duration<double, std::micro>(now - it->second).count()));
+        retiredAt.erase(it);
+      }
+    }
+
+    std::vector<double> take()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return std::exchange(lags, {});
+    }
+  };
+
+  LagLog lagLog;
+
+  /**
+   * @brief Reclamation hook feeding lagLog
+   *
+   * Plugged into i18n::BasicSharedSnapshot, so the benchmark runs the library's own
+   * publication path; only the snapshots' allocation differs, as they need a custom deleter.
+   */
+  struct LagHook
+  {
+    static constexpr bool enabled = true;
+
+    static void retired(const void *snapshot) noexcept
+    {
+      lagLog.retire(snapshot);
+    }
+
+    static void reclaimed(const void *snapshot) noexcept
+    {
+      lagLog.reclaim(snapshot);
+    }
+  };
+
+  using TrackedSnapshot = i18n::BasicSharedSnapshot<LagHook>;
+
+  using TrackedI18n = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::NoDiagnostics, TrackedSnapshot>;
+
+  /**
+   * @brief Log-linear latency histogram (16 sub-buckets per power of two, ~6% resolution)
+   */
+  struct Histogram
+  {
+  private:
+    std::array<std::uint64_t, 1024> counts{};
+
+    static std::size_t bucket(std::uint64_t value)
+    {
+      if (value < 32)
+      {
+        return static_cast<std::size_t>(value);
+      }
+      int msb = 63;
+      while (!(value >> msb))
+      {
+        --msb;
+      }
+      return 32 + static_cast<std::size_t>(msb - 5) * 16 + ((value >> (msb - 4)) & 15);
+    }
+
+    static double midpoint(std::size_t index)
+    {
+      if (index < 32)
+      {
+        return static_cast<double>(index);
+      }
+      int msb = static_cast<int>((index - 32) / 16) + 5;
+      double width = std::ldexp(1.0, msb - 4);
+      return (16 + static_cast<double>((index - 32) % 16)) * width + width / 2;
+    }
+
+  public:
+    void add(std::uint64_t value)
+    {
+      ++counts[bucket(value)];
+    }
+
+    void merge(const Histogram &other)
+    {
+      for (std::size_t i = 0; i < counts.size(); ++i)
+      {
+        counts[i] += other.counts[i];
+      }
+    }
+
+    double percentile(double fraction) const
+    {
+      std::uint64_t total = 0;
+      for (std::uint64_t count : counts)
+      {
+        total += count;
+      }
+      std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(total)));
+      std::uint64_t seen = 0;
+      for (std::size_t i = 0; i < counts.size(); ++i)
+      {
+        seen += counts[i];
+        if (seen >= rank && counts[i])
+        {
+          return midpoint(i);
+        }
+      }
+      return 0;
+    }
+  };
+
+  /**
+   * @brief Zipf(s) ranks over [0, n), sampled by inverting a precomputed CDF
+   */
+  struct Zipf
+  {
+  private:
+    std::vector<double> cdf;
+
+  public:
+    Zipf(std::size_t n, double s)
+    {
+      cdf.reserve(n);
+      double sum = 0;
+      for (std::size_t rank = 1; rank <= n; ++rank)
+      {
+        sum += 1.0 / std::pow(static_cast<double>(rank), s);
+        cdf.push_back(sum);
+      }
+      for (double &value : cdf)
+      {
+        value /= sum;
+      }
+    }
+
+    std::size_t sample(bench::Random &random) const
+    {
+      double u = static_cast<double>(random.next() >> 11) * 0x1.0p-53;
+      return std::min(static_cast<std::size_t>(std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin()), cdf.size() - 1);
+    }
+  };
+
+  /**
+   * @brief One lookup to perform: a key index and a locale index
+   */
+  struct Op
+  {
+    std::uint32_t key;
+    std::uint32_t locale;
+  };
+
+  constexpr std::size_t streamSize = std::size_t{1} << 16;
+
+  /**
+   * @brief Per-thread lookup streams, generated up front so sampling stays out of the timed loop
+   */
+  std::vector<std::vector<Op>> makeStreams(std::size_t threads, std::size_t keys, std::size_t locales, double s)
+  {
+    Zipf zipf(keys, s);
+    bench::Random random(11);
+
+    // Spread the hot ranks over the key space instead of clustering them in one section.
+    std::vector<std::uint32_t> keyOfRank(keys);
+    for (std::size_t i = 0; i < keys; ++i)
+    {
+      keyOfRank[i] = static_cast<std::uint32_t>(i);
+    }
+    for (std::size_t i = keys; i > 1; --i)
+    {
+      std::swap(keyOfRank[i - 1], keyOfRank[random.below(i)]);
+    }
+
+    std::vector<std::vector<Op>> streams(threads);
+    for (auto &stream : streams)
+    {
+      stream.reserve(streamSize);
+      for (std::size_t i = 0; i < streamSize; ++i)
+      {
+        stream.push_back({keyOfRank[zipf.sample(random)], static_cast<std::uint32_t>(random.below(locales))});
+      }
+    }
+    return streams;
+  }
+
+  /**
+   * @brief What one reader thread measured in one repetition
+   */
+  struct ReaderStats
+  {
+    std::uint64_t lookups = 0;
+    Histogram latency;
+  };
+
+  /**
+   * @brief Run @p readers threads calling @p lookup, and a writer calling @p write every 1/@p rate
+   * seconds, for @p seconds; record throughput, latency percentiles and reclamation lag
+   */
+  template <typename Lookup, typename Write>
+  void measure(bench::Runner &runner, const std::string &name, std::size_t readers, double seconds, double rate,
+               const std::vector<std::vector<Op>> &streams, Lookup &&lookup, Write &&write)
+  {
+    std::string prefix = name + "/readers:" + std::to_string(readers);
+    bench::Result throughput{prefix + "/throughput", "Mops/s", {}, {}};
+    bench::Result p50{prefix + "/p50", "ns", {}, {}};
+    bench::Result p99{prefix + "/p99", "ns", {}, {}};
+    bench::Result p999{prefix + "/p999", "ns", {}, {}};
+    bench::Result lag{prefix + "/lag", "us", {}, {}};
+    std::vector<bench::Result *> results = {&throughput, &p50, &p99, &p999, &lag};
+    if (std::none_of(results.begin(), results.end(), [&](const bench::Result *result)
+                     { return runner.enabled(result->name); }))
+    {
+      return;
+    }
+
+    for (int r = 0; r < runner.repetitionCount(); ++r)
+    {
+      std::vector<ReaderStats> stats(readers);
+      std::atomic<bool> stop{false};
+      std::atomic<std::size_t> ready{0};
+      std::size_t writes = 0;
+      lagLog.take();
+
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < readers; ++t)
+      {
+        threads.emplace_back([&, t]()
+                             {
+          const std::vector<Op> &stream = streams[t];
+          ReaderStats &mine = stats[t];
+          ready.fetch_add(1);
+          std::size_t i = 0;
+          while (!stop.load(std::memory_order_relaxed))
+          {
+            const Op &op = stream[i++ & (streamSize - 1)];
+            auto start = Clock::now();
+            bench::doNotOptimize(lookup(op));
+            auto end = Clock::now();
+            mine.latency.add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+          }
+          mine.lookups = i; });
+      }
+      while (ready.load() < readers)
+      {
+        std::this_thread::yield();
+      }
+
+      auto start = Clock::now();
+      auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+      if (rate > 0)
+      {
+        auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+        for (auto next = start + period; next < deadline; next += period)
+        {
+          std::this_thread::sleep_until(next);
+          write(writes++);
+        }
+      }
+      std::this_thread::sleep_until(deadline);
+      stop.store(true);
+      for (auto &thread : threads)
+      {
+        thread.join();
+      }
+      double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+      Histogram latency;
+      std::uint64_t lookups = 0;
+      for (const ReaderStats &reader : stats)
+      {
+        latency.merge(reader.latency);
+        lookups += reader.lookups;
+      }
+      throughput.samples.push_back(static_cast<double>(lookups) / elapsed / 1e6);
+      p50.samples.push_back(latency.percentile(0.5));
+      p99.samples.push_back(latency.percentile(0.99));
+      p999.samples.push_back(latency.percentile(0.999));
+
+      std::vector<double> lags = lagLog.take();
+      double sum = 0;
+      double worst = 0;
+      for (double value : lags)
+      {
+        sum += value;
+        worst = std::max(worst, value);
+      }
+      lag.samples.push_back(lags.empty() ? 0 : sum / static_cast<double>(lags.size()));
+      lag.counters["max_us"] = std::max(lag.counters["max_us"], worst);
+      lag.counters["writes"] += static_cast<double>(writes) / runner.repetitionCount();
+    }
+
+    for (bench::Result *result : results)
+    {
+      runner.record(std::move(*result));
+    }
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  bench::Runner runner(argc, argv);
+  std::size_t keyCount = std::stoul(runner.option("keys", "20000"));
+  std::size_t localeCount = std::stoul(runner.option("locales", "8"));
+  std::size_t maxThreads = std::stoul(runner.option("threads", std::to_string(std::max(1u, std::thread::hardware_concurrency()))));
+  double rate = std::stod(runner.option("writes-per-sec", "10"));
+  std::string writer = runner.option("writer", "reload");
+  double skew = std::stod(runner.option("zipf", "0.99"));
+  if (writer != "reload" && writer != "patch")
+  {
+    std::cerr << "Unknown --writer " << writer << " (expected reload or patch)" << std::endl;
+    return 1;
+  }
+  runner.describe("keys", keyCount);
+  runner.describe("locales", localeCount);
+  runner.describe("threads", maxThreads);
+  runner.describe("writesPerSecond", rate);
+  runner.describe("writer", writer);
+  runner.describe("zipf", skew);
+
+  // The writer reads real files, as a deployment would.
+  nlohmann::json json = bench::syntheticCatalog(keyCount, localeCount);
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / ("i18n-bench-concurrency-" + std::to_string(Clock::now().time_since_epoch().count()));
+  std::filesystem::create_directories(directory);
+  std::string jsonPath = (directory / "translations.json").string();
+  std::string catalogPath = (directory / "catalog.i18nc").string();
+  std::ofstream(jsonPath) << json.dump();
+  i18n::Catalog(json).save(catalogPath);
+
+  std::vector<std::string> locales;
+  std::vector<std::string> shardPaths;
+  for (const auto &[code, tree] : json.items())
+  {
+    locales.push_back(code);
+    shardPaths.push_back((directory / (code + ".json")).string());
+    std::ofstream(shardPaths.back()) << tree.dump();
+  }
+  std::vector<std::string> paths;
+  for (std::size_t k = 0; k < keyCount; ++k)
+  {
+    paths.push_back("section" + std::to_string(k / 100) + ".key" + std::to_string(k % 100));
+  }
+
+  std::vector<std::size_t> readerCounts;
+  for (std::size_t n = 1; n < maxThreads; n *= 2)
+  {
+    readerCounts.push_back(n);
+  }
+  readerCounts.push_back(maxThreads);
+
+  std::vector<std::vector<Op>> streams = makeStreams(maxThreads, keyCount, localeCount, skew);
+  double seconds = runner.minimumTime();
+
+  TrackedI18n translations(jsonPath);
+  for (std::size_t readers : readerCounts)
+  {
+    measure(
+        runner, "concurrency/json/" + writer, readers, seconds, rate, streams, [&](const Op &op)
+        {
+          // Each lookup copies into a reset stack arena, so the allocator does not limit scaling.
+          char buffer[256];
+          std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+          std::pmr::memory_resource *resource = &arena;
+          return translations.t(std::string_view(paths[op.key]), std::string_view(locales[op.locale]), resource).size(); },
+        [&](std::size_t write)
+        {
+          if (writer == "reload")
+          {
+            translations.load(jsonPath);
+          }
+          else
+          {
+            std::size_t locale = write % locales.size();
+            translations.loadShard(locales[locale], shardPaths[locale]);
+          }
+        });
+  }
+
+  if (writer == "reload")
+  {
+    TrackedSnapshot::holder<i18n::Catalog> catalog(i18n::Catalog::load(catalogPath));
+    std::vector<i18n::KeyId> keys;
+    std::vector<i18n::LocaleId> localeIds;
+    for (const std::string &path : paths)
+    {
+      keys.push_back(catalog.snapshot()->findKey(path));
+    }
+    for (const std::string &code : locales)
+    {
+      localeIds.push_back(catalog.snapshot()->findLocale(code));
+    }
+
+    for (std::size_t readers : readerCounts)
+    {
+      measure(
+          runner, "concurrency/catalog/reload", readers, seconds, rate, streams, [&](const Op &op)
+          { return catalog.snapshot()->t_view(keys[op.key], localeIds[op.locale]).size(); },
+          [&](std::size_t)
+          { catalog.replace(i18n::Catalog::load(catalogPath)); });
+    }
+  }
+
+  std::filesystem::remove_all(directory);
+  return runner.finish();
+}
@@ -0,0 +1,162 @@
+// Loading translation DOMs: nlohmann::json (one heap allocation per node) against ArenaJson
+// (the same std::map objects, bump-allocated from a per-storage arena) and FlatArenaJson
+// (insertion-ordered flat objects in an arena).
+//
+//   load:   parse a serialized catalog into storage and free it again
+//   lookup: resolve random dot-separated paths in one locale
+//   memory: heap bytes and allocations held by a loaded DOM (one sample per repetition)
+//
+// Usage: i18nBenchDom [--keys 20000] [--locales 8] [runner options]
+
+#include "bench.hpp"
+
+#include <i18n/policies.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+namespace
+{
+  // Heap accounting for the whole process, including the chunks arenas obtain through
+  // std::pmr::new_delete_resource(). Each block carries its size in a header so unsized
+  // deletes can be accounted too.
+  std::atomic<std::size_t> liveBytes{0};
+  std::atomic<std::size_t> allocations{0};
+  constexpr std::size_t header = alignof(std::max_align_t);
+
+  void *acquire(std::size_t size)
+  {
+    void *block = std::malloc(header + size);
+    if (!block)
+    {
+      throw std::bad_alloc();
+    }
+    *static_cast<std::size_t *>(block) = size;
+    liveBytes.fetch_add(size, std::memory_order_relaxed);
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<unsigned char *>(block) + header;
+  }
+
+  void release(void *p)
+  {
+    if (!p)
+    {
+      return;
+    }
+    void *block = static_cast<unsigned char *>(p) - header;
+    liveBytes.fetch_sub(*static_cast<std::size_t *>(block), std::memory_order_relaxed);
+    std::free(block);
+  }
+
+  template <typename Storage>
+  void benchmark(bench::Runner &runner, const std::string &name, const std::string &document,
+                 const std::vector<std::string> &paths, std::size_t leaves)
+  {
+    runner.run("dom/" + name + "/load", leaves, [&]()
+               {
+      std::istringstream in(document);
+      Storage storage(in);
+      bench::doNotOptimize(storage.tree().size()); });
+
+    std::istringstream in(document);
+    Storage storage(in);
+    std::size_t next = 0;
+    runner.run("dom/" + name + "/lookup", paths.size(), [&]()
+               {
+      std::size_t found = 0;
+      for (const auto &path : paths)
+      {
+        found += storage.find("de", path) != nullptr;
+      }
+      next += found;
+      bench::doNotOptimize(next); });
+  }
+
+  /**
+   * @brief Heap footprint of one loaded DOM, measured once per repetition
+   */
+  template <typename Storage>
+  void footprint(bench::Runner &runner, int repetitions, const std::string &name, const std::string &document)
+  {
+    bench::Result bytes{"dom/" + name + "/memory", "bytes", {}, {}};
+    bench::Result blocks{"dom/" + name + "/allocations", "allocs", {}, {}};
+    for (int r = 0; r < repetitions; ++r)
+    {
+      std::istringstream in(document);
+      std::size_t bytesBefore = liveBytes.load();
+      std::size_t allocationsBefore = allocations.load();
+      {
+        Storage storage(in);
+        bytes.samples.push_back(static_cast<double>(liveBytes.load() - bytesBefore));
+        blocks.samples.push_back(static_cast<double>(allocations.load() - allocationsBefore));
+      }
+    }
+    runner.record(std::move(bytes));
+    runner.record(std::move(blocks));
+  }
+} // namespace
+
+void *operator new(std::size_t size)
+{
+  return acquire(size);
+}
+
+// Arena chunks are requested with an explicit alignment; none of them exceed the header alignment.
+void *operator new(std::size_t size, std::align_val_t)
+{
+  return acquire(size);
+}
+
+void operator delete(void *p) noexcept
+{
+  release(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+  release(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept
+{
+  release(p);
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept
+{
+  release(p);
+}
+
+int main(int argc, char **argv)
+{
+  bench::Runner runner(argc, argv);
+  std::size_t keyCount = std::stoul(runner.option("keys", "20000"));
+  std::size_t localeCount = std::stoul(runner.option("locales", "8"));
+  runner.describe("keys", keyCount);
+  runner.describe("locales", localeCount);
+
+  std::string document = bench::syntheticCatalog(keyCount, localeCount).dump();
+  runner.describe("documentBytes", document.size());
+
+  bench::Random random(7);
+  std::vector<std::string> paths(1024);
+  for (auto &path : paths)
+  {
+    std::size_t k = random.below(keyCount);
+    path = "section" + std::to_string(k / 100) + ".key" + std::to_string(k % 100);
+  }
+
+  using JsonStorage = i18n::BasicJsonStorage<nlohmann::json>;
+  using ArenaStorage = i18n::BasicJsonStorage<i18n::ArenaJson>;
+  using FlatStorage = i18n::BasicJsonStorage<i18n::FlatArenaJson>;
+  benchmark<JsonStorage>(runner, "json", document, paths, keyCount * localeCount);
+  benchmark<ArenaStorage>(runner, "arena", document, paths, keyCount * localeCount);
+  benchmark<FlatStorage>(runner, "flat-arena", document, paths, keyCount * localeCount);
+  footprint<JsonStorage>(runner, runner.repetitionCount(), "json", document);
+  footprint<ArenaStorage>(runner, runner.repetitionCount(), "arena", document);
+  footprint<FlatStorage>(runner, runner.repetitionCount(), "flat-arena", document);
+
+  return runner.finish();
+}
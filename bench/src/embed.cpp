@@ -0,0 +1,58 @@
+// Build-time helper for i18nBenchColdStart: compiles a synthetic catalog and writes it as a
+// C++ include, so the cold-start benchmark can measure a catalog embedded in the executable.
+//
+// Usage: i18nBenchEmbed <keys> <locales> <output.inc>
+
+#include "bench.hpp"
+
+#include <i18n/catalog.hpp>
+
+#include <cstdio>
+
+int main(int argc, char **argv)
+{
+  if (argc != 4)
+  {
+    std::cerr << "Usage: i18nBenchEmbed <keys> <locales> <output.inc>" << std::endl;
+    return 1;
+  }
+  std::size_t keyCount = std::stoul(argv[1]);
+  std::size_t localeCount = std::stoul(argv[2]);
+  std::string output = argv[3];
+
+  std::string catalogPath = output + ".i18nc";
+  i18n::Catalog(bench::syntheticCatalog(keyCount, localeCount)).save(catalogPath);
+  std::ifstream in(catalogPath, std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+  std::remove(catalogPath.c_str());
+
+  std::ofstream out(output);
+  if (!out.is_open())
+  {
+    std::cerr << "Could not open file: " << output << std::endl;
+    return 1;
+  }
+
+  // A string literal of octal escapes compiles much faster than a brace list of integers.
+  out << "// Generated by i18nBenchEmbed; do not edit.\n"
+      << "constexpr std::size_t embeddedCatalogKeys = " << keyCount << ";\n"
+      << "constexpr std::size_t embeddedCatalogLocales = " << localeCount << ";\n"
+      << "alignas(8) static const char embeddedCatalog[] =";
+  char escape[8];
+  for (std::size_t i = 0; i < bytes.size(); ++i)
+  {
+    if (i % 64 == 0)
+    {
+      out << "\n    \"";
+    }
+    std::snprintf(escape, sizeof(escape), "\\%03o", static_cast<unsigned char>(bytes[i]));
+    out << escape;
+    if (i % 64 == 63 || i + 1 == bytes.size())
+    {
+      out << "\"";
+    }
+  }
+  out << ";\n";
+  return out ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+// Cache behaviour of the two catalog layouts under request-style and export-style access.
+//
+//   request: pick a locale, then look up a batch of random keys in it (server traffic)
+//   scan:    read every key of one locale in id order (warming a per-locale cache)
+//   export:  read every locale of every key through row() (translation-management export)
+//
+// Usage: i18nBenchLayout [--keys 50000] [--locales 16] [--batch 64] [runner options]
+
+#include "bench.hpp"
+
+#include <i18n/catalog.hpp>
+
+int main(int argc, char **argv)
+{
+  bench::Runner runner(argc, argv);
+  std::size_t keyCount = std::stoul(runner.option("keys", "50000"));
+  std::size_t localeCount = std::stoul(runner.option("locales", "16"));
+  std::size_t batch = std::stoul(runner.option("batch", "64"));
+  runner.describe("keys", keyCount);
+  runner.describe("locales", localeCount);
+  runner.describe("batch", batch);
+
+  nlohmann::json json = bench::syntheticCatalog(keyCount, localeCount);
+
+  // One fixed request trace shared by both layouts: (locale, key) pairs grouped by locale.
+  bench::Random random(42);
+  const std::size_t requests = 256;
+  std::vector<i18n::LocaleId> requestLocales(requests);
+  std::vector<i18n::KeyId> requestKeys(requests * batch);
+  for (std::size_t r = 0; r < requests; ++r)
+  {
+    requestLocales[r] = static_cast<i18n::LocaleId>(random.below(localeCount));
+    for (std::size_t i = 0; i < batch; ++i)
+    {
+      requestKeys[r * batch + i] = static_cast<i18n::KeyId>(random.below(keyCount));
+    }
+  }
+
+  for (i18n::Layout layout : {i18n::Layout::KeyMajor, i18n::Layout::LocaleMajor})
+  {
+    i18n::Catalog catalog(json, {layout});
+    std::string prefix = layout == i18n::Layout::KeyMajor ? "layout/key-major/" : "layout/locale-major/";
+
+    runner.run(prefix + "request", requests * batch, [&]()
+               {
+      std::size_t bytes = 0;
+      for (std::size_t r = 0; r < requests; ++r)
+      {
+        i18n::LocaleId locale = requestLocales[r];
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+          std::string_view text = catalog.get(requestKeys[r * batch + i], locale);
+          bytes += text.size() + static_cast<unsigned char>(text[0]);
+        }
+      }
+      bench::doNotOptimize(bytes); });
+
+    i18n::LocaleId scanned = 0;
+    runner.run(prefix + "scan", catalog.keyCount(), [&]()
+               {
+      std::size_t bytes = 0;
+      for (std::string_view text : catalog.column(scanned))
+      {
+        bytes += text.size() + static_cast<unsigned char>(text[0]);
+      }
+      scanned = (scanned + 1) % catalog.localeCount();
+      bench::doNotOptimize(bytes); });
+
+    runner.run(prefix + "export", catalog.keyCount() * catalog.localeCount(), [&]()
+               {
+      std::size_t bytes = 0;
+      for (i18n::KeyId key = 0; key < catalog.keyCount(); ++key)
+      {
+        for (std::string_view text : catalog.row(key))
+        {
+          bytes += text.size() + static_cast<unsigned char>(text[0]);
+        }
+      }
+      bench::doNotOptimize(bytes); });
+  }
+
+  return runner.finish();
+}
@@ -0,0 +1,194 @@
+// C interface to i18n::Catalog (see include/i18n/i18n_c.h). Every entry point catches
+// exceptions at the boundary and reports them through i18n_last_error().
+
+#include <i18n/i18n_c.h>
+#include <i18n/catalog.hpp>
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct i18n_catalog
+{
+  i18n::Catalog catalog;
+};
+
+namespace
+{
+  thread_local std::string lastError;
+
+  i18n_string toC(std::string_view text)
+  {
+    return {text.data(), text.size()};
+  }
+
+  /**
+   * @brief Run @p open and hand its catalog to @p out, recording any exception
+   */
+  template <typename Open>
+  int create(i18n_catalog **out, Open &&open)
+  {
+    if (!out)
+    {
+      lastError = "Output handle is NULL";
+      return -1;
+    }
+    *out = nullptr;
+    try
+    {
+      *out = new i18n_catalog{open()};
+      return 0;
+    }
+    catch (const std::exception &e)
+    {
+      lastError = e.what();
+    }
+    catch (...)
+    {
+      lastError = "Unknown error";
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Map ids the catalog does not know to the invalid ids its lookups accept
+   */
+  i18n::KeyId checkKey(const i18n_catalog *catalog, i18n_key key)
+  {
+    return key < catalog->catalog.keyCount() ? key : i18n::invalidKey;
+  }
+
+  i18n::LocaleId checkLocale(const i18n_catalog *catalog, i18n_locale locale)
+  {
+    return locale < catalog->catalog.localeCount() ? locale : i18n::invalidLocale;
+  }
+} // namespace
+
+extern "C"
+{
+  uint32_t i18n_abi_version(void)
+  {
+    return I18N_C_ABI_VERSION;
+  }
+
+  const char *i18n_last_error(void)
+  {
+    return lastError.c_str();
+  }
+
+  int i18n_catalog_open(const char *path, i18n_catalog **out)
+  {
+    return create(out, [&]()
+                  { return i18n::Catalog::load(path ? path : ""); });
+  }
+
+  int i18n_catalog_from_json(const char *json, size_t size, i18n_catalog **out)
+  {
+    return create(out, [&]()
+                  { return i18n::Catalog(nlohmann::json::parse(json, json + (json ? size : 0))); });
+  }
+
+  int i18n_catalog_from_bytes(const void *bytes, size_t size, i18n_catalog **out)
+  {
+    return create(out, [&]()
+                  {
+      const char *begin = static_cast<const char *>(bytes);
+      auto owner = std::make_shared<std::vector<char>>(begin, begin + (begin ? size : 0));
+      return i18n::Catalog::fromBytes(std::shared_ptr<const char>(owner, owner->data()), owner->size()); });
+  }
+
+  void i18n_catalog_free(i18n_catalog *catalog)
+  {
+    delete catalog;
+  }
+
+  size_t i18n_locale_count(const i18n_catalog *catalog)
+  {
+    return catalog ? catalog->catalog.localeCount() : 0;
+  }
+
+  size_t i18n_key_count(const i18n_catalog *catalog)
+  {
+    return catalog ? catalog->catalog.keyCount() : 0;
+  }
+
+  i18n_locale i18n_find_locale(const i18n_catalog *catalog, const char *code, size_t size)
+  {
+    if (!catalog || (!code && size != 0))
+    {
+      return I18N_INVALID_LOCALE;
+    }
+    return catalog->catalog.findLocale(std::string_view(code, size));
+  }
+
+  i18n_key i18n_find_key(const i18n_catalog *catalog, const char *path, size_t size)
+  {
+    if (!catalog || (!path && size != 0))
+    {
+      return I18N_INVALID_KEY;
+    }
+    return catalog->catalog.findKey(std::string_view(path, size));
+  }
+
+  i18n_string i18n_locale_code(const i18n_catalog *catalog, i18n_locale locale)
+  {
+    if (!catalog || checkLocale(catalog, locale) == i18n::invalidLocale)
+    {
+      return {nullptr, 0};
+    }
+    return toC(catalog->catalog.localeCode(locale));
+  }
+
+  i18n_string i18n_key_name(const i18n_catalog *catalog, i18n_key key)
+  {
+    if (!catalog || checkKey(catalog, key) == i18n::invalidKey)
+    {
+      return {nullptr, 0};
+    }
+    return toC(catalog->catalog.keyName(key));
+  }
+
+  i18n_string i18n_t(const i18n_catalog *catalog, i18n_key key, i18n_locale locale)
+  {
+    if (!catalog)
+    {
+      return {nullptr, 0};
+    }
+    return toC(catalog->catalog.t_view(checkKey(catalog, key), checkLocale(catalog, locale)));
+  }
+
+  i18n_string i18n_get(const i18n_catalog *catalog, i18n_key key, i18n_locale locale)
+  {
+    if (!catalog || checkKey(catalog, key) == i18n::invalidKey || checkLocale(catalog, locale) == i18n::invalidLocale)
+    {
+      return {nullptr, 0};
+    }
+    return toC(catalog->catalog.get(key, locale));
+  }
+
+  i18n_string i18n_t_code(const i18n_catalog *catalog, const char *table, size_t size, int64_t code, i18n_locale locale)
+  {
+    if (!catalog || (!table && size != 0))
+    {
+      return {nullptr, 0};
+    }
+    return toC(catalog->catalog.t_code(std::string_view(table, size), code, checkLocale(catalog, locale)));
+  }
+
+  size_t i18n_t_array(const i18n_catalog *catalog, const char *path, size_t size, i18n_locale locale,
+                      i18n_string *out, size_t capacity)
+  {
+    if (!catalog || (!path && size != 0))
+    {
+      return 0;
+    }
+    auto elements = catalog->catalog.t_array(std::string_view(path, size), checkLocale(catalog, locale));
+    for (size_t i = 0; i < elements.size() && i < capacity; ++i)
+    {
+      out[i] = toC(elements[i]);
+    }
+    return elements.size();
+  }
+}
@@ -0,0 +1,148 @@
+#ifndef I18N_ARENA_JSON_HPP
+#define I18N_ARENA_JSON_HPP
+
+#include "core.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace i18n
+{
+  namespace detail
+  {
+    /**
+     * @brief Resource that ArenaAllocator allocates from on this thread, or nullptr for the heap
+     */
+    inline thread_local std::pmr::memory_resource *currentArena = nullptr;
+  } // namespace detail
+
+  /**
+   * @brief Routes ArenaAllocator allocations made on this thread to a memory resource while in scope.
+   *
+   * Scopes nest; the previous resource is restored on destruction.
+   *
+   * Example usage:
+   * @code{.cpp}
+   * std::pmr::monotonic_buffer_resource arena;
+   * i18n::ArenaJson json;
+   * {
+   *   i18n::ArenaScope scope(&arena);
+   *   json = i18n::ArenaJson::parse(file);   // every node, string and container comes from arena
+   * }
+   * @endcode
+   */
+  struct ArenaScope
+  {
+  private:
+    std::pmr::memory_resource *previous;
+
+  public:
+    explicit ArenaScope(std::pmr::memory_resource *resource) : previous(detail::currentArena)
+    {
+      detail::currentArena = resource;
+    }
+
+    ~ArenaScope()
+    {
+      detail::currentArena = previous;
+    }
+
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+  };
+
+  /**
+   * @brief Stateless allocator that draws from the current ArenaScope, or the heap outside one.
+   *
+   * nlohmann::basic_json default-constructs its allocator for every node, so the allocator
+   * cannot carry the arena itself. Instead each block records the resource it came from in a
+   * small header, and deallocation returns it there: a no-op for a monotonic arena, a real
+   * free for heap blocks. Values may therefore be created, copied and destroyed anywhere, as
+   * long as the arena outlives every value allocated from it.
+   *
+   * @tparam T Value type
+   */
+  template <typename T>
+  struct ArenaAllocator
+  {
+    using value_type = T;
+
+    /**
+     * @brief Bytes reserved in front of each block for the owning resource
+     */
+    static constexpr std::size_t header = alignof(std::max_align_t);
+
+    ArenaAllocator() noexcept = default;
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n)
+    {
+      static_assert(alignof(T) <= header, "ArenaAllocator does not support over-aligned types");
+      std::pmr::memory_resource *resource = detail::currentArena ? detail::currentArena : std::pmr::new_delete_resource();
+      auto *block = static_cast<unsigned char *>(resource->allocate(header + n * sizeof(T), header));
+      *reinterpret_cast<std::pmr::memory_resource **>(block) = resource;
+      return reinterpret_cast<T *>(block + header);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+      auto *block = reinterpret_cast<unsigned char *>(p) - header;
+      std::pmr::memory_resource *resource = *reinterpret_cast<std::pmr::memory_resource **>(block);
+      resource->deallocate(block, header + n * sizeof(T), header);
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &) const noexcept
+    {
+      return true;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &) const noexcept
+    {
+      return false;
+    }
+  };
+
+  /**
+   * @brief String type of ArenaJson
+   */
+  using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+  /**
+   * @brief nlohmann::basic_json whose nodes, strings and containers live in an arena.
+   *
+   * Values allocated inside an ArenaScope are bump-allocated, so parsing avoids the
+   * per-value heap allocations of nlohmann::json, and the whole DOM is released by
+   * destroying the arena. Objects keep std::map semantics (sorted keys, logarithmic lookup).
+   */
+  using ArenaJson = nlohmann::basic_json<std::map, std::vector, ArenaString, bool, std::int64_t,
+                                         std::uint64_t, double, ArenaAllocator>;
+
+  /**
+   * @brief ArenaJson with flat objects: nlohmann::ordered_map instead of std::map.
+   *
+   * An object is a single vector of key/value pairs in insertion order, i.e. one allocation
+   * rather than one per member and a contiguous scan on lookup. Insertion and lookup are
+   * linear in the object size, so this variant pays off only for narrow trees; with
+   * hundreds of members per object ArenaJson loads and looks up faster.
+   */
+  using FlatArenaJson = nlohmann::basic_json<nlohmann::ordered_map, std::vector, ArenaString, bool, std::int64_t,
+                                             std::uint64_t, double, ArenaAllocator>;
+
+  /**
+   * @brief Whether a basic_json specialization allocates through ArenaAllocator
+   */
+  template <typename Json>
+  constexpr bool usesArena = std::is_same_v<typename Json::allocator_type, ArenaAllocator<Json>>;
+} // namespace i18n
+
+#endif // I18N_ARENA_JSON_HPP
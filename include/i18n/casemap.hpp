@@ -0,0 +1,370 @@
+#ifndef I18N_CASEMAP_HPP
+#define I18N_CASEMAP_HPP
+
+#include "unicode.hpp"
+#include "unicode_tables.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace i18n
+{
+  /**
+   * @brief Case transformation applied by toUpper(), toLower(), toTitle() and the catalog's t_upper()/t_lower()/t_title()
+   */
+  enum class TextCase : std::uint8_t
+  {
+    Upper = 0,
+    Lower = 1,
+    Title = 2
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Locale-specific casing rules on top of the Unicode default mappings
+     */
+    struct CaseRules
+    {
+      /**
+       * @brief i/I pair with dotted/dotless forms: i <-> U+0130, U+0131 <-> I (Turkish, Azerbaijani)
+       */
+      bool dottedI = false;
+
+      /**
+       * @brief "ij" at the start of a word titlecases to "IJ" (Dutch)
+       */
+      bool dutchIJ = false;
+
+      /**
+       * @brief Uppercase Greek drops the tonos accent (Greek)
+       */
+      bool greekUpper = false;
+    };
+
+    /**
+     * @brief Casing rules for a locale code such as "tr" or "nl-BE"
+     */
+    inline CaseRules caseRules(std::string_view locale)
+    {
+      std::string_view language = locale.substr(0, locale.find_first_of("-_"));
+      CaseRules rules;
+      rules.dottedI = language == "tr" || language == "az";
+      rules.dutchIJ = language == "nl";
+      rules.greekUpper = language == "el";
+      return rules;
+    }
+
+    /**
+     * @brief Apply a case mapping table to @p cp
+     *
+     * @return The mapped code point, or @p cp if the table does not map it
+     */
+    template <std::size_t N>
+    inline char32_t mapCase(const CaseRange (&table)[N], char32_t cp, bool *mapped = nullptr)
+    {
+      std::size_t low = 0;
+      std::size_t high = N;
+      while (low < high)
+      {
+        std::size_t mid = (low + high) / 2;
+        if (table[mid].last < cp)
+        {
+          low = mid + 1;
+        }
+        else if (table[mid].first > cp)
+        {
+          high = mid;
+        }
+        else
+        {
+          if ((cp - table[mid].first) % table[mid].stride != 0)
+          {
+            break;
+          }
+          if (mapped)
+          {
+            *mapped = true;
+          }
+          return static_cast<char32_t>(static_cast<std::int32_t>(cp) + table[mid].delta);
+        }
+      }
+      return cp;
+    }
+
+    /**
+     * @brief The multi-code-point casing of @p cp, or nullptr
+     */
+    inline const SpecialCasing *findSpecialCasing(char32_t cp)
+    {
+      std::size_t low = 0;
+      std::size_t high = std::size(specialCasings);
+      while (low < high)
+      {
+        std::size_t mid = (low + high) / 2;
+        if (specialCasings[mid].codePoint < cp)
+        {
+          low = mid + 1;
+        }
+        else
+        {
+          high = mid;
+        }
+      }
+      return low < std::size(specialCasings) && specialCasings[low].codePoint == cp ? &specialCasings[low] : nullptr;
+    }
+
+    /**
+     * @brief Whether @p cp has an uppercase or lowercase counterpart
+     */
+    inline bool isCased(char32_t cp)
+    {
+      bool mapped = false;
+      mapCase(upperRanges, cp, &mapped);
+      mapCase(lowerRanges, cp, &mapped);
+      return mapped || findSpecialCasing(cp) != nullptr;
+    }
+
+    /**
+     * @brief Whether @p cp separates words for titlecasing
+     */
+    inline bool isWordSeparator(char32_t cp)
+    {
+      return (cp >= 0x09 && cp <= 0x0D) || cp == 0x20 || cp == 0x85 || cp == 0xA0 || cp == 0x1680 ||
+             (cp >= 0x2000 && cp <= 0x200A) || cp == 0x2028 || cp == 0x2029 || cp == 0x202F || cp == 0x205F ||
+             cp == 0x3000;
+    }
+
+    /**
+     * @brief Uppercase Greek letters with tonos without the accent, or 0 if @p cp has no tonos
+     */
+    inline char32_t greekUpperWithoutTonos(char32_t cp)
+    {
+      switch (cp)
+      {
+      case 0x0386: case 0x03AC: return 0x0391; // alpha
+      case 0x0388: case 0x03AD: return 0x0395; // epsilon
+      case 0x0389: case 0x03AE: return 0x0397; // eta
+      case 0x038A: case 0x03AF: return 0x0399; // iota
+      case 0x038C: case 0x03CC: return 0x039F; // omicron
+      case 0x038E: case 0x03CD: return 0x03A5; // upsilon
+      case 0x038F: case 0x03CE: return 0x03A9; // omega
+      case 0x0390: return 0x03AA;              // iota with dialytika and tonos
+      case 0x03B0: return 0x03AB;              // upsilon with dialytika and tonos
+      default: return 0;
+      }
+    }
+
+    /**
+     * @brief Append @p cp to @p out as UTF-8
+     */
+    template <typename Bytes>
+    inline void appendUtf8(Bytes &out, char32_t cp)
+    {
+      if (cp < 0x80)
+      {
+        out.push_back(static_cast<char>(cp));
+      }
+      else if (cp < 0x800)
+      {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+      else if (cp < 0x10000)
+      {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+      else
+      {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+      }
+    }
+
+    template <typename Bytes>
+    inline void appendString(Bytes &out, std::string_view text)
+    {
+      out.insert(out.end(), text.begin(), text.end());
+    }
+
+    template <typename Bytes>
+    inline void appendUpper(Bytes &out, char32_t cp, const CaseRules &rules)
+    {
+      if (rules.dottedI && cp == U'i')
+      {
+        appendUtf8(out, 0x0130);
+      }
+      else if (char32_t bare = rules.greekUpper ? greekUpperWithoutTonos(cp) : 0)
+      {
+        appendUtf8(out, bare);
+      }
+      else if (const SpecialCasing *special = findSpecialCasing(cp))
+      {
+        appendString(out, special->upper);
+      }
+      else
+      {
+        appendUtf8(out, mapCase(upperRanges, cp));
+      }
+    }
+
+    template <typename Bytes>
+    inline void appendTitle(Bytes &out, char32_t cp, const CaseRules &rules)
+    {
+      bool mapped = false;
+      char32_t title = mapCase(titleRanges, cp, &mapped);
+      if (mapped)
+      {
+        appendUtf8(out, title);
+      }
+      else if (const SpecialCasing *special = findSpecialCasing(cp))
+      {
+        appendString(out, special->title);
+      }
+      else
+      {
+        appendUpper(out, cp, CaseRules{rules.dottedI, false, false});
+      }
+    }
+
+    /**
+     * @brief Append the lowercase of @p cp, the code point of @p text that ends at @p end
+     */
+    template <typename Bytes>
+    inline void appendLower(Bytes &out, std::string_view text, std::size_t end, char32_t cp, bool afterCased, const CaseRules &rules)
+    {
+      if (rules.dottedI && cp == U'I')
+      {
+        appendUtf8(out, 0x0131);
+      }
+      else if (cp == 0x0130)
+      {
+        appendString(out, rules.dottedI ? "i" : "i\xCC\x87");
+      }
+      else if (cp == 0x03A3 && afterCased)
+      {
+        // Final sigma: a capital sigma that ends a word lowercases to U+03C2.
+        std::size_t next = end;
+        bool beforeCased = next < text.size() && isCased(decodeUtf8(text, next));
+        appendUtf8(out, beforeCased ? 0x03C3 : 0x03C2);
+      }
+      else
+      {
+        appendUtf8(out, mapCase(lowerRanges, cp));
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @brief Append @p text in the requested case to @p out
+   *
+   * Applies the Unicode default case mappings, including expansions such as German sharp s
+   * to "SS" and final sigma, plus locale rules: Turkish and Azerbaijani dotted and dotless i,
+   * Dutch "IJ" at the start of a title-cased word, and accent-free Greek capitals.
+   * Title case titlecases the first letter of each whitespace-separated word, skipping leading
+   * punctuation, and lowercases the rest.
+   *
+   * @param text Valid UTF-8
+   * @param target The case to produce
+   * @param locale Locale code whose rules apply (e.g., "tr"); empty for the default rules
+   * @param out Byte container with push_back() and insert() (std::string, std::vector<char>, ...)
+   */
+  template <typename Bytes>
+  void appendCaseMapped(std::string_view text, TextCase target, std::string_view locale, Bytes &out)
+  {
+    detail::CaseRules rules = detail::caseRules(locale);
+    bool wordStart = true;
+    bool afterCased = false;
+    bool afterGreek = false;
+    std::size_t i = 0;
+    while (i < text.size())
+    {
+      std::size_t begin = i;
+      char32_t cp = detail::decodeUtf8(text, i);
+
+      if (target == TextCase::Upper)
+      {
+        if (rules.greekUpper && afterGreek && cp == 0x0301)
+        {
+          continue;
+        }
+        detail::appendUpper(out, cp, rules);
+      }
+      else if (target == TextCase::Lower || !wordStart)
+      {
+        detail::appendLower(out, text, i, cp, afterCased, rules);
+      }
+      else if (!detail::isCased(cp))
+      {
+        // Leading punctuation is skipped; a leading digit starts the word ("3rd", not "3Rd").
+        out.insert(out.end(), text.begin() + static_cast<std::ptrdiff_t>(begin), text.begin() + static_cast<std::ptrdiff_t>(i));
+        wordStart = !(cp >= U'0' && cp <= U'9');
+      }
+      else
+      {
+        if (rules.dutchIJ && (cp == U'i' || cp == U'I') && i < text.size() && (text[i] == 'j' || text[i] == 'J'))
+        {
+          detail::appendString(out, "IJ");
+          ++i;
+        }
+        else
+        {
+          detail::appendTitle(out, cp, rules);
+        }
+        wordStart = false;
+      }
+
+      afterGreek = (cp >= 0x0370 && cp <= 0x03FF) || (cp >= 0x1F00 && cp <= 0x1FFF);
+      if (detail::isWordSeparator(cp))
+      {
+        wordStart = true;
+        afterCased = false;
+      }
+      else if (detail::isCased(cp))
+      {
+        afterCased = true;
+      }
+    }
+  }
+
+  /**
+   * @brief @p text in upper case (see appendCaseMapped())
+   */
+  inline std::string toUpper(std::string_view text, std::string_view locale = {})
+  {
+    std::string result;
+    result.reserve(text.size());
+    appendCaseMapped(text, TextCase::Upper, locale, result);
+    return result;
+  }
+
+  /**
+   * @brief @p text in lower case (see appendCaseMapped())
+   */
+  inline std::string toLower(std::string_view text, std::string_view locale = {})
+  {
+    std::string result;
+    result.reserve(text.size());
+    appendCaseMapped(text, TextCase::Lower, locale, result);
+    return result;
+  }
+
+  /**
+   * @brief @p text in title case (see appendCaseMapped())
+   */
+  inline std::string toTitle(std::string_view text, std::string_view locale = {})
+  {
+    std::string result;
+    result.reserve(text.size());
+    appendCaseMapped(text, TextCase::Title, locale, result);
+    return result;
+  }
+} // namespace i18n
+
+#endif // I18N_CASEMAP_HPP
@@ -0,0 +1,2271 @@
+#ifndef I18N_CATALOG_HPP
+#define I18N_CATALOG_HPP
+
+#include "casemap.hpp"
+#include "collation.hpp"
+#include "core.hpp"
+#include "load_stats.hpp"
+#include "trace.hpp"
+#include "unicode.hpp"
+#include "utf8.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace i18n
+{
+  /**
+   * @brief Dense identifier of a translation key inside a Catalog.
+   */
+  using KeyId = std::uint32_t;
+
+  /**
+   * @brief Dense identifier of a locale inside a Catalog.
+   */
+  using LocaleId = std::uint32_t;
+
+  /**
+   * @brief Returned by lookups when a key does not exist.
+   */
+  constexpr KeyId invalidKey = std::numeric_limits<KeyId>::max();
+
+  /**
+   * @brief Returned by lookups when a locale does not exist.
+   */
+  constexpr LocaleId invalidLocale = std::numeric_limits<LocaleId>::max();
+
+  /**
+   * @brief Minimal read-only view over a contiguous range (a C++17 stand-in for std::span).
+   *
+   * @tparam T Element type
+   */
+  template <typename T>
+  struct Span
+  {
+  private:
+    T *first = nullptr;
+    std::size_t count = 0;
+
+  public:
+    constexpr Span() = default;
+    constexpr Span(T *data, std::size_t size) : first(data), count(size) {}
+
+    constexpr T *begin() const { return first; }
+    constexpr T *end() const { return first + count; }
+    constexpr T *data() const { return first; }
+    constexpr std::size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr T &operator[](std::size_t index) const { return first[index]; }
+  };
+
+  /**
+   * @brief Read-only view over every n-th element of an array.
+   *
+   * Used for catalog rows and columns, which are contiguous in one storage layout and
+   * strided in the other.
+   *
+   * @tparam T Element type
+   */
+  template <typename T>
+  struct StridedSpan
+  {
+  private:
+    T *first = nullptr;
+    std::size_t count = 0;
+    std::size_t step = 1;
+
+  public:
+    /**
+     * @brief Forward iterator over a StridedSpan
+     */
+    struct iterator
+    {
+      T *current;
+      std::size_t step;
+
+      T &operator*() const { return *current; }
+      iterator &operator++()
+      {
+        current += step;
+        return *this;
+      }
+      bool operator==(const iterator &other) const { return current == other.current; }
+      bool operator!=(const iterator &other) const { return current != other.current; }
+    };
+
+    constexpr StridedSpan() = default;
+    constexpr StridedSpan(T *data, std::size_t size, std::size_t stride) : first(data), count(size), step(stride) {}
+
+    iterator begin() const { return {first, step}; }
+    iterator end() const { return {first + count * step, step}; }
+    constexpr std::size_t size() const { return count; }
+    constexpr std::size_t stride() const { return step; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr T &operator[](std::size_t index) const { return first[index * step]; }
+
+    /**
+     * @brief Whether the elements are adjacent in memory (stride of one)
+     */
+    constexpr bool contiguous() const { return step == 1; }
+
+    /**
+     * @brief View the elements as a plain Span; only valid when contiguous()
+     */
+    constexpr Span<T> span() const { return {first, count}; }
+  };
+
+  /**
+   * @brief Order of the (key, locale) cells in a compiled Catalog.
+   */
+  enum class Layout : std::uint32_t
+  {
+    /**
+     * @brief All locales of one key are adjacent; best for exports and tooling that read rows
+     */
+    KeyMajor = 0,
+
+    /**
+     * @brief All keys of one locale are adjacent; best for servers that read one locale at a time
+     */
+    LocaleMajor = 1
+  };
+
+  /**
+   * @brief Settings applied when a Catalog is built or loaded.
+   */
+  struct CatalogOptions
+  {
+    /**
+     * @brief Cell order of the compiled slab
+     */
+    Layout layout = Layout::KeyMajor;
+
+    /**
+     * @brief Memory resource for the catalog's long-lived storage (byte pool and lookup
+     * tables); nullptr uses std::pmr::get_default_resource()
+     */
+    std::pmr::memory_resource *resource = nullptr;
+
+    /**
+     * @brief Treatment of translations that are not valid UTF-8 when building from entries
+     * (invalid key paths and locale codes are always rejected)
+     */
+    InvalidUtf8 invalidUtf8 = InvalidUtf8::Reject;
+
+    /**
+     * @brief Precompute collation sort keys for every cell (see Catalog::sort_key())
+     */
+    bool sortKeys = false;
+
+    /**
+     * @brief Precompute upper, lower and title case variants of every cell instead of building
+     * them on first use (see Catalog::t_upper())
+     */
+    bool caseVariants = false;
+
+    /**
+     * @brief Key patterns of numeric code tables to index for t_code(), e.g. "errors.E#" for
+     * keys such as "errors.E1042"; '#' stands for the decimal code and must end the pattern
+     * (namespaces whose keys are plain numbers, such as compiled arrays, are indexed anyway)
+     */
+    std::vector<std::string> codeTables = {};
+
+    /**
+     * @brief Receives the duration of each build step ("utf8", "slab", "index", ...), if not nullptr
+     */
+    LoadStats *stats = nullptr;
+  };
+
+  /**
+   * @brief Hash a dot-separated key path (64-bit FNV-1a).
+   *
+   * The hash is incremental: hashing "a", then ".", then "b" with the running value
+   * gives the same result as hashing "a.b" in one call.
+   *
+   * @param path The bytes to hash
+   * @param seed Running hash value from a previous call
+   * @return std::uint64_t The updated hash
+   */
+  constexpr std::uint64_t hashPath(std::string_view path, std::uint64_t seed = 14695981039346656037ull)
+  {
+    for (char c : path)
+    {
+      seed ^= static_cast<unsigned char>(c);
+      seed *= 1099511628211ull;
+    }
+    return seed;
+  }
+
+  /**
+   * @brief Binds an enum type to the catalog keys of its enumerators (specialize per enum).
+   *
+   * The enumerators must be 0, 1, 2, ...; `names[i]` is the key of enumerator i below
+   * `prefix`. Once bound with Catalog::bindEnum(), Catalog::t_view(value, locale) is two
+   * array reads.
+   *
+   * Example usage:
+   * @code{.cpp}
+   * enum class OrderStatus { Pending, Shipped, Delivered };
+   *
+   * template <>
+   * struct i18n::EnumKeys<OrderStatus>
+   * {
+   *   static constexpr std::string_view prefix = "order.status";
+   *   static constexpr std::string_view names[] = {"pending", "shipped", "delivered"};
+   * };
+   * @endcode
+   *
+   * @tparam Enum The enum type
+   */
+  template <typename Enum>
+  struct EnumKeys;
+
+  namespace detail
+  {
+    /**
+     * @brief Hand out the next enum type index (shared by all enum types)
+     */
+    inline std::size_t nextEnumTypeIndex()
+    {
+      static std::atomic<std::size_t> next{0};
+      return next++;
+    }
+
+    /**
+     * @brief Process-wide index of an enum type among the types bound to catalogs
+     */
+    template <typename Enum>
+    std::size_t enumTypeIndex()
+    {
+      static const std::size_t index = nextEnumTypeIndex();
+      return index;
+    }
+  } // namespace detail
+
+  struct CatalogBuilder;
+
+  /**
+   * @brief Compiled, immutable translation catalog addressed by dense key and locale ids.
+   *
+   * All strings live in one shared byte pool. Each (key, locale) cell is a `std::string_view`
+   * in a slab ordered by the catalog's Layout. With Layout::KeyMajor (the default) every
+   * translation of one key sits next to each other in memory and row() hands them out as a
+   * single contiguous run; with Layout::LocaleMajor the same holds for column(). The layout is
+   * picked through CatalogOptions when compiling from JSON, is recorded in binary catalogs
+   * written by save(), and can be overridden again by load().
+   * Cells with no translation hold the #missing sentinel (a view with a null data pointer),
+   * which keeps them distinguishable from translations that are legitimately empty.
+   *
+   * Every string in a catalog is valid UTF-8: it is checked once while building or loading,
+   * and consumers need not validate it again. Each cell also carries its TextMetrics (code
+   * points, grapheme clusters, display width and direction), computed once when the catalog
+   * is built and stored in binary catalogs, so t_meta() and isAscii() are plain reads.
+   * Upper, lower and title case variants (t_upper(), t_lower(), t_title()) are built once per
+   * locale, on first use or at build time, and are then plain reads as well.
+   *
+   * String values are compiled, and so are the strings of arrays, whose elements become keys
+   * named by their index ("steps.0", "steps.1", ...). Other JSON value types are skipped.
+   *
+   * Namespaces whose keys are decimal codes (array elements, or keys matching a pattern such
+   * as "errors.E#") are additionally indexed as dense code tables, so t_code() turns a numeric
+   * code into a KeyId with an array index instead of formatting and hashing a path. Enum types
+   * bound with bindEnum() are translated the same way, by enumerator (see EnumKeys).
+   *
+   * Example usage:
+   * @code{.cpp}
+   * i18n::Catalog catalog(json);
+   *
+   * i18n::KeyId key = catalog.findKey("user.greeting");
+   * auto row = catalog.row(key);
+   * for (i18n::LocaleId locale = 0; locale < row.size(); ++locale)
+   * {
+   *   if (!i18n::Catalog::isMissing(row[locale]))
+   *   {
+   *     std::cout << catalog.localeCode(locale) << ": " << row[locale] << std::endl;
+   *   }
+   * }
+   * @endcode
+   *
+   * Lookups such as t_view() and t_array() accept any id and treat one past the end like
+   * invalidKey or invalidLocale. Raw accessors documented as taking "a valid" id (get(),
+   * row(), column(), ...) do not check it; debug builds assert() it.
+   *
+   * Copies are cheap: the byte pool is shared between copies and never modified.
+   *
+   * The byte pool and tables can be placed on a dedicated memory resource (for example an
+   * arena that lives as long as the catalog) through CatalogOptions::resource; copies keep
+   * their tables on the same resource.
+   */
+  struct Catalog
+  {
+  private:
+    friend struct CatalogBuilder;
+
+    struct Slot
+    {
+      std::uint64_t hash;
+      KeyId id;
+    };
+
+    /**
+     * @brief Case-mapped translations of one locale in one TextCase, indexed by KeyId, built once
+     */
+    struct CaseColumn
+    {
+      std::once_flag once;
+      std::shared_ptr<const std::pmr::vector<std::string_view>> cells;
+      std::shared_ptr<const std::pmr::vector<char>> bytes;
+    };
+
+    /**
+     * @brief Number of TextCase values, i.e. CaseColumns per locale
+     */
+    static constexpr std::size_t caseCount = 3;
+
+    /**
+     * @brief A namespace indexed by numeric code: #codeKeys[offset + code - first] for codes in
+     * [first, first + count), invalidKey for holes
+     */
+    struct CodeTable
+    {
+      std::string_view name;
+      std::int64_t first;
+      std::size_t offset;
+      std::size_t count;
+    };
+
+    /**
+     * @brief The elements of an array in one locale: #arrayCells[offset, offset + size)
+     */
+    struct ArrayRun
+    {
+      std::size_t offset = 0;
+      std::size_t size = 0;
+    };
+
+    /**
+     * @brief Position of a bound enum's block in #enumCells
+     */
+    struct EnumBinding
+    {
+      std::size_t offset = 0;
+      std::size_t count = 0;
+    };
+
+    /**
+     * @brief One key of a code table while the table is being built
+     */
+    struct CodeEntry
+    {
+      std::string_view name;
+      std::int64_t code;
+      KeyId key;
+    };
+
+    /**
+     * @brief Backing bytes for keys and values, shared between copies
+     */
+    std::shared_ptr<const char> pool;
+
+    /**
+     * @brief Number of bytes in #pool
+     */
+    std::size_t poolSize = 0;
+
+    /**
+     * @brief Cell order of #slab
+     */
+    Layout layout = Layout::KeyMajor;
+
+    /**
+     * @brief Locale codes indexed by LocaleId
+     */
+    std::pmr::vector<std::string_view> locales;
+
+    /**
+     * @brief Key paths indexed by KeyId
+     */
+    std::pmr::vector<std::string_view> keys;
+
+    /**
+     * @brief Open-addressing hash index from key path to KeyId (power-of-two capacity)
+     */
+    std::pmr::vector<Slot> index;
+
+    /**
+     * @brief Cell slab in #layout order, see cellIndex()
+     */
+    std::pmr::vector<std::string_view> slab;
+
+    /**
+     * @brief Per-cell TextMetrics, parallel to #slab
+     */
+    std::pmr::vector<TextMetrics> metrics;
+
+    /**
+     * @brief Backing bytes for #sortKeys, shared between copies
+     */
+    std::shared_ptr<const char> sortKeyPool;
+
+    /**
+     * @brief Per-cell collation sort keys, parallel to #slab; empty unless buildSortKeys() ran
+     */
+    std::pmr::vector<std::string_view> sortKeys;
+
+    /**
+     * @brief localeCount() * caseCount lazily built case columns, shared between copies
+     */
+    std::shared_ptr<CaseColumn[]> caseColumns;
+
+    /**
+     * @brief Dense numeric code tables, see t_code()
+     */
+    std::pmr::vector<CodeTable> codeTables;
+
+    /**
+     * @brief KeyIds of all code tables, one run per table
+     */
+    std::pmr::vector<KeyId> codeKeys;
+
+    /**
+     * @brief codeTables.size() * localeCount() runs, see buildArrays(); empty for tables that
+     * do not start at code 0
+     */
+    std::pmr::vector<ArrayRun> arrayRuns;
+
+    /**
+     * @brief Elements of all arrays, one contiguous run per (table, locale)
+     */
+    std::pmr::vector<std::string_view> arrayCells;
+
+    /**
+     * @brief Translations of the enums bound with bindEnum(), indexed by detail::enumTypeIndex();
+     * a count of 0 marks an unbound type
+     */
+    std::pmr::vector<EnumBinding> enumBindings;
+
+    /**
+     * @brief Cells of all bound enums, one localeCount() x count block per type
+     */
+    std::pmr::vector<std::string_view> enumCells;
+
+    /**
+     * @brief Locale used when a cell is missing, or invalidLocale for none
+     */
+    LocaleId fallback = invalidLocale;
+
+    /**
+     * @brief Position of the (key, locale) cell in a slab of the given shape and order
+     */
+    static std::size_t slabIndex(Layout order, std::size_t keyCount, std::size_t localeCount, KeyId key, LocaleId locale)
+    {
+      return order == Layout::KeyMajor
+                 ? static_cast<std::size_t>(key) * localeCount + locale
+                 : static_cast<std::size_t>(locale) * keyCount + key;
+    }
+
+    /**
+     * @brief Position of the (key, locale) cell in #slab; both ids must be in range
+     */
+    std::size_t cellIndex(KeyId key, LocaleId locale) const
+    {
+      assert(key < keys.size() && locale < locales.size());
+      return slabIndex(layout, keys.size(), locales.size(), key, locale);
+    }
+
+    /**
+     * @brief Rebuild #index from #keys
+     */
+    void buildIndex()
+    {
+      std::size_t capacity = 1;
+      while (capacity < keys.size() * 2)
+      {
+        capacity <<= 1;
+      }
+      index.assign(capacity, {0, invalidKey});
+      for (KeyId id = 0; id < keys.size(); ++id)
+      {
+        std::uint64_t hash = hashPath(keys[id]);
+        std::size_t i = static_cast<std::size_t>(hash) & (capacity - 1);
+        while (index[i].id != invalidKey)
+        {
+          i = (i + 1) & (capacity - 1);
+        }
+        index[i] = {hash, id};
+      }
+    }
+
+    /**
+     * @brief Reorder #slab into @p target layout
+     */
+    void relayout(Layout target)
+    {
+      if (target == layout)
+      {
+        return;
+      }
+
+      std::pmr::vector<std::string_view> reordered(slab.size(), slab.get_allocator());
+      std::pmr::vector<TextMetrics> reorderedMetrics(metrics.size(), metrics.get_allocator());
+      std::pmr::vector<std::string_view> reorderedSortKeys(sortKeys.size(), sortKeys.get_allocator());
+      for (KeyId key = 0; key < keys.size(); ++key)
+      {
+        for (LocaleId locale = 0; locale < locales.size(); ++locale)
+        {
+          std::size_t from = cellIndex(key, locale);
+          std::size_t to = slabIndex(target, keys.size(), locales.size(), key, locale);
+          reordered[to] = slab[from];
+          reorderedMetrics[to] = metrics[from];
+          if (!sortKeys.empty())
+          {
+            reorderedSortKeys[to] = sortKeys[from];
+          }
+        }
+      }
+      slab = std::move(reordered);
+      metrics = std::move(reorderedMetrics);
+      sortKeys = std::move(reorderedSortKeys);
+      layout = target;
+    }
+
+    /**
+     * @brief Check every locale code, key path and cell as UTF-8 (for data that was not built here)
+     *
+     * @throws std::runtime_error If a string is not valid UTF-8
+     */
+    void validate() const
+    {
+      for (const auto *strings : {&locales, &keys, &slab})
+      {
+        for (std::string_view text : *strings)
+        {
+          if (validateUtf8(text) != std::string_view::npos)
+          {
+            throw std::runtime_error("Invalid UTF-8 in catalog");
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Fill #metrics from #slab
+     */
+    void measure()
+    {
+      metrics.resize(slab.size());
+      for (std::size_t i = 0; i < slab.size(); ++i)
+      {
+        metrics[i] = measureText(slab[i]);
+      }
+    }
+
+    /**
+     * @brief Start with empty case columns for the current locales
+     */
+    void resetCaseColumns()
+    {
+      caseColumns = std::shared_ptr<CaseColumn[]>(new CaseColumn[locales.size() * caseCount]);
+    }
+
+    /**
+     * @brief Map every translation of @p locale (after fallback) to @p target case
+     *
+     * Translations the mapping leaves unchanged are not copied; the column points at the
+     * original text instead.
+     */
+    void fillCaseColumn(CaseColumn &column, LocaleId locale, TextCase target) const
+    {
+      std::pmr::memory_resource *memory = resource();
+      auto bytes = std::allocate_shared<std::pmr::vector<char>>(std::pmr::polymorphic_allocator<char>(memory));
+      auto cells = std::allocate_shared<std::pmr::vector<std::string_view>>(std::pmr::polymorphic_allocator<std::string_view>(memory));
+      cells->assign(keys.size(), missing);
+      std::pmr::vector<std::size_t> ends(keys.size(), std::string_view::npos, memory);
+
+      std::string mapped;
+      for (KeyId key = 0; key < keys.size(); ++key)
+      {
+        std::string_view text = t_view(key, locale);
+        if (isMissing(text))
+        {
+          continue;
+        }
+        mapped.clear();
+        appendCaseMapped(text, target, locales[locale], mapped);
+        if (mapped == text)
+        {
+          (*cells)[key] = text;
+        }
+        else
+        {
+          bytes->insert(bytes->end(), mapped.begin(), mapped.end());
+          ends[key] = bytes->size();
+        }
+      }
+
+      // Views into the copied bytes are taken once the buffer stops growing.
+      std::size_t begin = 0;
+      for (KeyId key = 0; key < keys.size(); ++key)
+      {
+        if (ends[key] != std::string_view::npos)
+        {
+          (*cells)[key] = std::string_view(bytes->data() + begin, ends[key] - begin);
+          begin = ends[key];
+        }
+      }
+      column.cells = std::move(cells);
+      column.bytes = std::move(bytes);
+    }
+
+    /**
+     * @brief The case column of a locale, built on first use
+     */
+    const CaseColumn &caseColumn(LocaleId locale, TextCase target) const
+    {
+      CaseColumn &column = caseColumns[locale * caseCount + static_cast<std::size_t>(target)];
+      std::call_once(column.once, [&]()
+                     { fillCaseColumn(column, locale, target); });
+      return column;
+    }
+
+    /**
+     * @brief Case variant of the translation t_view() returns
+     */
+    std::string_view caseVariant(KeyId key, LocaleId locale, TextCase target, std::string_view defaultValue) const
+    {
+      LocaleId rules = locale < locales.size() ? locale : fallback;
+      if (key >= keys.size() || rules == invalidLocale || !caseColumns)
+      {
+        return defaultValue;
+      }
+
+      std::string_view value = (*caseColumn(rules, target).cells)[key];
+      return isMissing(value) ? defaultValue : value;
+    }
+
+    /**
+     * @brief Slab position of the cell t_view() returns for (key, locale), or npos if there is none
+     *
+     * Out-of-range ids are treated like invalidKey and invalidLocale; one compare each.
+     */
+    std::size_t resolveCell(KeyId key, LocaleId locale) const
+    {
+      if (key >= keys.size())
+      {
+        return std::string_view::npos;
+      }
+
+      if (locale < locales.size())
+      {
+        std::size_t cell = cellIndex(key, locale);
+        if (!isMissing(slab[cell]))
+        {
+          return cell;
+        }
+      }
+
+      if (fallback != invalidLocale && fallback != locale)
+      {
+        I18N_PROBE3(catalog__fallback, key, locale, fallback);
+        std::size_t cell = cellIndex(key, fallback);
+        if (!isMissing(slab[cell]))
+        {
+          return cell;
+        }
+      }
+
+      return std::string_view::npos;
+    }
+
+    /**
+     * @brief Resolve the key whose path is @p segments joined with '.'
+     */
+    KeyId findSegments(const std::string_view *begin, const std::string_view *end) const
+    {
+      std::uint64_t hash = hashPath(begin != end ? *begin : std::string_view());
+      for (const std::string_view *segment = begin + (begin != end); segment < end; ++segment)
+      {
+        hash = hashPath(*segment, hashPath(".", hash));
+      }
+
+      return probe(hash, [&](KeyId id)
+                   {
+        std::string_view path = keys[id];
+        for (const std::string_view *segment = begin; segment != end; ++segment)
+        {
+          if (segment != begin)
+          {
+            if (path.empty() || path.front() != '.')
+            {
+              return false;
+            }
+            path.remove_prefix(1);
+          }
+          if (path.substr(0, segment->size()) != *segment)
+          {
+            return false;
+          }
+          path.remove_prefix(segment->size());
+        }
+        return path.empty(); });
+    }
+
+    /**
+     * @brief Parse a non-empty run of at most 18 decimal digits
+     */
+    static bool parseCode(std::string_view digits, std::int64_t &code)
+    {
+      if (digits.empty() || digits.size() > 18)
+      {
+        return false;
+      }
+      code = 0;
+      for (char c : digits)
+      {
+        if (c < '0' || c > '9')
+        {
+          return false;
+        }
+        code = code * 10 + (c - '0');
+      }
+      return true;
+    }
+
+    /**
+     * @brief Index of the code table named @p name in #codeTables, or npos
+     */
+    std::size_t findCodeTable(std::string_view name) const
+    {
+      // Tables are few, so a linear scan is cheaper than a map.
+      for (std::size_t i = 0; i < codeTables.size(); ++i)
+      {
+        if (codeTables[i].name == name)
+        {
+          return i;
+        }
+      }
+      return std::string_view::npos;
+    }
+
+    /**
+     * @brief Add a code table from entries of one namespace, sorted by code
+     *
+     * A table may waste at most 1024 slots or seven slots per code, whichever is larger, so
+     * a few far-apart codes do not allocate a huge array.
+     *
+     * @return An empty string on success, otherwise why the entries cannot form a table
+     */
+    std::string addCodeTable(const CodeEntry *begin, const CodeEntry *end)
+    {
+      std::size_t count = static_cast<std::size_t>(end - begin);
+      std::uint64_t span = static_cast<std::uint64_t>(end[-1].code - begin->code) + 1;
+      if (span > std::max<std::uint64_t>(count * 8, 1024))
+      {
+        return "is too sparse";
+      }
+      for (const CodeEntry *entry = begin + 1; entry != end; ++entry)
+      {
+        if (entry->code == entry[-1].code)
+        {
+          return "has code " + std::to_string(entry->code) + " twice";
+        }
+      }
+
+      std::size_t existing = findCodeTable(begin->name);
+      if (existing != std::string_view::npos)
+      {
+        CodeTable old = codeTables[existing];
+        auto from = codeKeys.begin() + static_cast<std::ptrdiff_t>(old.offset);
+        codeKeys.erase(from, from + static_cast<std::ptrdiff_t>(old.count));
+        codeTables.erase(codeTables.begin() + static_cast<std::ptrdiff_t>(existing));
+        for (CodeTable &table : codeTables)
+        {
+          if (table.offset > old.offset)
+          {
+            table.offset -= old.count;
+          }
+        }
+      }
+
+      std::size_t offset = codeKeys.size();
+      codeKeys.resize(offset + static_cast<std::size_t>(span), invalidKey);
+      for (const CodeEntry *entry = begin; entry != end; ++entry)
+      {
+        codeKeys[offset + static_cast<std::size_t>(entry->code - begin->code)] = entry->key;
+      }
+      codeTables.push_back({begin->name, begin->code, offset, static_cast<std::size_t>(span)});
+      return {};
+    }
+
+    /**
+     * @brief Index every namespace whose keys are plain decimal codes ("steps.0", "http.404")
+     *
+     * Namespaces that also have other keys are indexed over their numeric keys; namespaces
+     * too sparse for a dense table are left to findKey().
+     */
+    void detectCodeTables()
+    {
+      std::vector<CodeEntry> entries;
+      for (KeyId id = 0; id < keys.size(); ++id)
+      {
+        std::string_view path = keys[id];
+        std::size_t dot = path.rfind('.');
+        std::size_t start = dot == std::string_view::npos ? 0 : dot + 1;
+        std::int64_t code;
+        if (parseCode(path.substr(start), code))
+        {
+          entries.push_back({path.substr(0, dot == std::string_view::npos ? 0 : dot), code, id});
+        }
+      }
+      std::sort(entries.begin(), entries.end(), [](const CodeEntry &a, const CodeEntry &b)
+                { return a.name != b.name ? a.name < b.name : a.code < b.code; });
+
+      for (std::size_t begin = 0, end = 0; begin < entries.size(); begin = end)
+      {
+        while (end < entries.size() && entries[end].name == entries[begin].name)
+        {
+          ++end;
+        }
+        addCodeTable(entries.data() + begin, entries.data() + end);
+      }
+      buildArrays();
+    }
+
+    /**
+     * @brief Lay out the elements of every code table that starts at 0 as one run per locale
+     *
+     * A locale's run holds its elements up to the first one it lacks, so an array is never
+     * stitched together from two languages; locales without any element use the run of the
+     * fallback locale.
+     */
+    void buildArrays()
+    {
+      arrayRuns.assign(codeTables.size() * locales.size(), ArrayRun());
+      arrayCells.clear();
+      for (std::size_t table = 0; table < codeTables.size(); ++table)
+      {
+        const CodeTable &codes = codeTables[table];
+        if (codes.first != 0)
+        {
+          continue;
+        }
+
+        ArrayRun *runs = arrayRuns.data() + table * locales.size();
+        for (LocaleId locale = 0; locale < locales.size(); ++locale)
+        {
+          runs[locale].offset = arrayCells.size();
+          for (std::size_t i = 0; i < codes.count; ++i)
+          {
+            KeyId key = codeKeys[codes.offset + i];
+            if (key == invalidKey || isMissing(get(key, locale)))
+            {
+              break;
+            }
+            arrayCells.push_back(get(key, locale));
+          }
+          runs[locale].size = arrayCells.size() - runs[locale].offset;
+        }
+        for (LocaleId locale = 0; locale < locales.size(); ++locale)
+        {
+          if (runs[locale].size == 0 && fallback != invalidLocale)
+          {
+            runs[locale] = runs[fallback];
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Probe the hash index for @p hash, calling @p matches(KeyId) on every hash hit.
+     */
+    template <typename Matches>
+    KeyId probe(std::uint64_t hash, Matches &&matches) const
+    {
+      if (index.empty())
+      {
+        return invalidKey;
+      }
+
+      std::size_t mask = index.size() - 1;
+      for (std::size_t i = static_cast<std::size_t>(hash) & mask;; i = (i + 1) & mask)
+      {
+        const Slot &slot = index[i];
+        if (slot.id == invalidKey)
+        {
+          return invalidKey;
+        }
+        if (slot.hash == hash && matches(slot.id))
+        {
+          return slot.id;
+        }
+      }
+    }
+
+    /**
+     * @brief Construct an empty catalog whose tables allocate from @p resource
+     */
+    explicit Catalog(std::pmr::memory_resource *resource)
+        : locales(resource), keys(resource), index(resource), slab(resource), metrics(resource), sortKeys(resource),
+          codeTables(resource), codeKeys(resource), arrayRuns(resource), arrayCells(resource),
+          enumBindings(resource), enumCells(resource)
+    {
+    }
+
+    /**
+     * @brief Compile JSON through a CatalogBuilder (see the public constructor)
+     */
+    static Catalog compile(const nlohmann::json &json, const CatalogOptions &options);
+
+  public:
+    /**
+     * @brief Sentinel stored in cells that have no translation
+     */
+    static constexpr std::string_view missing{};
+
+    /**
+     * @brief Check whether a cell value is the #missing sentinel
+     *
+     * @param value A value returned by get(), row() or t_view()
+     * @return true if the cell has no translation
+     */
+    static constexpr bool isMissing(std::string_view value)
+    {
+      return value.data() == nullptr;
+    }
+
+    /**
+     * @brief Construct an empty catalog
+     */
+    Catalog() = default;
+
+    /**
+     * @brief Copy a catalog, sharing its byte pool and keeping its tables on the same memory resource
+     */
+    Catalog(const Catalog &other)
+        : pool(other.pool),
+          poolSize(other.poolSize),
+          layout(other.layout),
+          locales(other.locales, other.locales.get_allocator()),
+          keys(other.keys, other.keys.get_allocator()),
+          index(other.index, other.index.get_allocator()),
+          slab(other.slab, other.slab.get_allocator()),
+          metrics(other.metrics, other.metrics.get_allocator()),
+          sortKeyPool(other.sortKeyPool),
+          sortKeys(other.sortKeys, other.sortKeys.get_allocator()),
+          caseColumns(other.caseColumns),
+          codeTables(other.codeTables, other.codeTables.get_allocator()),
+          codeKeys(other.codeKeys, other.codeKeys.get_allocator()),
+          arrayRuns(other.arrayRuns, other.arrayRuns.get_allocator()),
+          arrayCells(other.arrayCells, other.arrayCells.get_allocator()),
+          enumBindings(other.enumBindings, other.enumBindings.get_allocator()),
+          enumCells(other.enumCells, other.enumCells.get_allocator()),
+          fallback(other.fallback)
+    {
+    }
+
+    Catalog(Catalog &&) noexcept = default;
+    Catalog &operator=(const Catalog &) = default;
+    Catalog &operator=(Catalog &&) = default;
+
+    /**
+     * @brief The memory resource holding the catalog's tables
+     */
+    std::pmr::memory_resource *resource() const
+    {
+      return slab.get_allocator().resource();
+    }
+
+    /**
+     * @brief Compile a catalog from a nlohmann::json object organized by locale
+     *
+     * The JSON object must have the same shape accepted by I18n: locale codes as keys
+     * and (nested) translation objects as values. Nested keys are joined with '.'.
+     *
+     * @param json A JSON object containing translation data organized by locale
+     * @param options Build settings such as the slab layout
+     * @throws std::runtime_error If the JSON is not an object or is empty
+     */
+    explicit Catalog(const nlohmann::json &json, const CatalogOptions &options = {});
+
+    /**
+     * @brief Number of locales in the catalog
+     */
+    std::size_t localeCount() const
+    {
+      return locales.size();
+    }
+
+    /**
+     * @brief Number of distinct keys across all locales
+     */
+    std::size_t keyCount() const
+    {
+      return keys.size();
+    }
+
+    /**
+     * @brief Get the code of a locale
+     *
+     * @param locale A valid LocaleId
+     * @return std::string_view The locale code (e.g., "en")
+     */
+    std::string_view localeCode(LocaleId locale) const
+    {
+      return locales[locale];
+    }
+
+    /**
+     * @brief Get the dot-separated path of a key
+     *
+     * @param key A valid KeyId
+     * @return std::string_view The key path (e.g., "user.greeting")
+     */
+    std::string_view keyName(KeyId key) const
+    {
+      return keys[key];
+    }
+
+    /**
+     * @brief Resolve a locale code to its id
+     *
+     * @param code The locale code (e.g., "en")
+     * @return LocaleId The id, or invalidLocale if the catalog has no such locale
+     */
+    LocaleId findLocale(std::string_view code) const
+    {
+      for (std::size_t i = 0; i < locales.size(); ++i)
+      {
+        if (locales[i] == code)
+        {
+          return static_cast<LocaleId>(i);
+        }
+      }
+      return invalidLocale;
+    }
+
+    /**
+     * @brief Resolve a dot-separated key path to its id
+     *
+     * Resolve keys once (e.g., at startup) and keep the KeyId for hot paths.
+     *
+     * @param path The dot-separated path (e.g., "user.greeting")
+     * @return KeyId The id, or invalidKey if no locale defines the key
+     */
+    KeyId findKey(std::string_view path) const
+    {
+      return probe(hashPath(path), [&](KeyId id)
+                   { return keys[id] == path; });
+    }
+
+    /**
+     * @brief Index the keys matching a code pattern as a code table for t_code()
+     *
+     * Builds do this for CatalogOptions::codeTables; call it after load() for patterns other
+     * than plain numeric keys, which loading indexes on its own. A table of the same name is
+     * replaced.
+     *
+     * @param pattern Namespace, '.', an optional key prefix and a trailing '#' for the code
+     *                (e.g., "errors.E#" for "errors.E1042", "errors.E0007", ...)
+     * @throws std::runtime_error If the pattern is malformed, two keys have the same code or
+     *                            the codes are too sparse for a dense table
+     */
+    void buildCodeTable(std::string_view pattern)
+    {
+      if (pattern.empty() || pattern.back() != '#')
+      {
+        throw std::runtime_error("Code table pattern must end with '#': " + std::string(pattern));
+      }
+      std::size_t dot = pattern.rfind('.');
+      std::size_t nameSize = dot == std::string_view::npos ? 0 : dot;
+      std::size_t prefixStart = dot == std::string_view::npos ? 0 : dot + 1;
+      std::string_view prefix = pattern.substr(prefixStart, pattern.size() - 1 - prefixStart);
+
+      std::vector<CodeEntry> entries;
+      for (KeyId id = 0; id < keys.size(); ++id)
+      {
+        std::string_view path = keys[id];
+        std::int64_t code;
+        if (path.size() > prefixStart + prefix.size() && path.compare(0, prefixStart + prefix.size(), pattern, 0, prefixStart + prefix.size()) == 0 &&
+            parseCode(path.substr(prefixStart + prefix.size()), code))
+        {
+          // The table name views the key, which lives in the pool rather than in the caller's pattern.
+          entries.push_back({path.substr(0, nameSize), code, id});
+        }
+      }
+      if (entries.empty())
+      {
+        return;
+      }
+
+      std::sort(entries.begin(), entries.end(), [](const CodeEntry &a, const CodeEntry &b)
+                { return a.code < b.code; });
+      std::string error = addCodeTable(entries.data(), entries.data() + entries.size());
+      if (!error.empty())
+      {
+        throw std::runtime_error("Code table '" + std::string(pattern) + "' " + error);
+      }
+      buildArrays();
+    }
+
+    /**
+     * @brief Resolve a numeric code of a code table to its key
+     *
+     * @param table Namespace of the table (e.g., "errors")
+     * @param code The code (e.g., 1042)
+     * @return KeyId The id, or invalidKey if the table or code does not exist
+     */
+    KeyId findCode(std::string_view table, std::int64_t code) const
+    {
+      std::size_t i = findCodeTable(table);
+      if (i == std::string_view::npos || code < codeTables[i].first ||
+          static_cast<std::uint64_t>(code - codeTables[i].first) >= codeTables[i].count)
+      {
+        return invalidKey;
+      }
+      return codeKeys[codeTables[i].offset + static_cast<std::size_t>(code - codeTables[i].first)];
+    }
+
+    /**
+     * @brief Look up the translation of a numeric code, with the same fallback as t_view()
+     *
+     * Example usage:
+     * @code{.cpp}
+     * // "errors": {"E1041": "...", "E1042": "Disk full"}, compiled with codeTables = {"errors.E#"}
+     * std::string_view message = catalog.t_code("errors", 1042, locale);
+     * @endcode
+     *
+     * @param table Namespace of the table (e.g., "errors", or "steps" for an array)
+     * @param code The code
+     * @param locale The LocaleId (invalidLocale is allowed)
+     * @param defaultValue Returned when the code or its translation does not exist
+     * @return std::string_view The translation, a view into catalog storage
+     */
+    std::string_view t_code(std::string_view table, std::int64_t code, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      return t_view(findCode(table, code), locale, defaultValue);
+    }
+
+    /**
+     * @brief Look up the translation of a numeric code by locale code
+     */
+    std::string_view t_code(std::string_view table, std::int64_t code, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_view(findCode(table, code), findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Get the elements of an array in one locale as a contiguous run
+     *
+     * Arrays are compiled into one run of views per locale, so this is a table read that
+     * neither copies nor allocates. A locale's run ends at its first missing element; a locale
+     * without any element gets the run of the fallback locale. Single elements resolve as
+     * keys too ("steps.2") and through t_code("steps", 2, locale).
+     *
+     * Example usage:
+     * @code{.cpp}
+     * for (std::string_view step : catalog.t_array("onboarding.steps", locale))
+     * {
+     *   render(step);
+     * }
+     * @endcode
+     *
+     * @param path The dot-separated path of the array (e.g., "calendar.months")
+     * @param locale The LocaleId (invalidLocale is allowed)
+     * @return Span<const std::string_view> The elements, views into catalog storage; empty if
+     *         there is no such array
+     */
+    Span<const std::string_view> t_array(std::string_view path, LocaleId locale) const
+    {
+      std::size_t table = findCodeTable(path);
+      LocaleId row = locale < locales.size() ? locale : fallback;
+      if (table == std::string_view::npos || row == invalidLocale)
+      {
+        return {};
+      }
+      const ArrayRun &run = arrayRuns[table * locales.size() + row];
+      return {arrayCells.data() + run.offset, run.size};
+    }
+
+    /**
+     * @brief Get the elements of an array by locale code
+     */
+    Span<const std::string_view> t_array(std::string_view path, std::string_view langCode) const
+    {
+      return t_array(path, findLocale(langCode));
+    }
+
+    /**
+     * @brief Resolve the keys of every enumerator of @p Enum in every locale, once
+     *
+     * Call it after building or loading the catalog for each enum type used with the enum
+     * overloads of t_view(). Translations are resolved with the same fallback as t_view(), so
+     * a lookup is an index into the type's table followed by an index into its cells.
+     * Copies of the catalog keep the bindings.
+     *
+     * @tparam Enum An enum type with an EnumKeys specialization
+     */
+    template <typename Enum>
+    void bindEnum()
+    {
+      using Keys = EnumKeys<Enum>;
+      constexpr std::size_t count = std::size(Keys::names);
+      static_assert(std::is_enum_v<Enum>, "bindEnum() requires an enum type");
+
+      std::size_t type = detail::enumTypeIndex<Enum>();
+      if (enumBindings.size() <= type)
+      {
+        enumBindings.resize(type + 1);
+      }
+      else if (enumBindings[type].count != 0)
+      {
+        return;
+      }
+
+      std::size_t offset = enumCells.size();
+      enumCells.resize(offset + locales.size() * count, missing);
+      for (std::size_t value = 0; value < count; ++value)
+      {
+        KeyId key = findKey({Keys::prefix, Keys::names[value]});
+        for (LocaleId locale = 0; locale < locales.size(); ++locale)
+        {
+          enumCells[offset + locale * count + value] = t_view(key, locale);
+        }
+      }
+      enumBindings[type] = {offset, count};
+    }
+
+    /**
+     * @brief Look up the translation of an enumerator, with the same fallback as t_view()
+     *
+     * Example usage:
+     * @code{.cpp}
+     * catalog.bindEnum<OrderStatus>();                         // once, after loading
+     * std::string_view label = catalog.t_view(OrderStatus::Shipped, locale);
+     * @endcode
+     *
+     * Types that were not bound are resolved through their key segments on every call.
+     *
+     * @param value An enumerator of an enum type with an EnumKeys specialization
+     * @param locale The LocaleId (invalidLocale is allowed)
+     * @param defaultValue Returned when the enumerator has no translation
+     * @return std::string_view The translation, a view into catalog storage
+     */
+    template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+    std::string_view t_view(Enum value, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      using Keys = EnumKeys<Enum>;
+      constexpr std::size_t count = std::size(Keys::names);
+      auto ordinal = static_cast<std::size_t>(value);
+      if (ordinal >= count)
+      {
+        return defaultValue;
+      }
+
+      std::size_t type = detail::enumTypeIndex<Enum>();
+      if (type >= enumBindings.size() || enumBindings[type].count == 0)
+      {
+        return t_view(findKey({Keys::prefix, Keys::names[ordinal]}), locale, defaultValue);
+      }
+
+      LocaleId row = locale < locales.size() ? locale : fallback;
+      if (row == invalidLocale)
+      {
+        return defaultValue;
+      }
+      std::string_view cell = enumCells[enumBindings[type].offset + row * count + ordinal];
+      return isMissing(cell) ? defaultValue : cell;
+    }
+
+    /**
+     * @brief Look up the translation of an enumerator by locale code
+     */
+    template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+    std::string_view t_view(Enum value, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_view(value, findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Resolve a key path given as segments, without joining them
+     *
+     * The segments are hashed one after another with hashPath(), which yields the hash of the
+     * dotted path, so dynamic keys need neither concatenation nor allocation.
+     *
+     * Example usage:
+     * @code{.cpp}
+     * i18n::KeyId key = catalog.findKey({"product", category, "title"});
+     * @endcode
+     *
+     * @param segments The path segments (e.g., {"user", "greeting"} for "user.greeting")
+     * @return KeyId The id, or invalidKey if no locale defines the key
+     */
+    KeyId findKey(std::initializer_list<std::string_view> segments) const
+    {
+      return findSegments(segments.begin(), segments.end());
+    }
+
+    /**
+     * @brief Resolve a key path given as a run of segments built at runtime
+     */
+    KeyId findKey(Span<const std::string_view> segments) const
+    {
+      return findSegments(segments.begin(), segments.end());
+    }
+
+    /**
+     * @brief Look up a translation by path segments and locale, like t_view(findKey(segments), locale)
+     */
+    std::string_view t_view(std::initializer_list<std::string_view> segments, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      return t_view(findKey(segments), locale, defaultValue);
+    }
+
+    /**
+     * @brief Look up a translation by path segments and locale code
+     */
+    std::string_view t_view(std::initializer_list<std::string_view> segments, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_view(findKey(segments), findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Get the raw cell for a key in one locale, without fallback
+     *
+     * @param key A valid KeyId
+     * @param locale A valid LocaleId
+     * @return std::string_view The translation, or #missing
+     */
+    std::string_view get(KeyId key, LocaleId locale) const
+    {
+      return slab[cellIndex(key, locale)];
+    }
+
+    /**
+     * @brief Check whether a cell is pure ASCII
+     *
+     * All cells are valid UTF-8; ASCII cells additionally have one byte per character and
+     * one column per character, so consumers can take a fast path without scanning them.
+     *
+     * @param key A valid KeyId
+     * @param locale A valid LocaleId
+     * @return true if the cell is ASCII or missing
+     */
+    bool isAscii(KeyId key, LocaleId locale) const
+    {
+      return metrics[cellIndex(key, locale)].ascii;
+    }
+
+    /**
+     * @brief Get the cell order of this catalog
+     */
+    Layout getLayout() const
+    {
+      return layout;
+    }
+
+    /**
+     * @brief Get the translations of one key in every locale
+     *
+     * The result is indexed by LocaleId and points straight into the slab. With
+     * Layout::KeyMajor the row is one contiguous block of memory; with Layout::LocaleMajor
+     * it is strided by keyCount(). Missing cells hold the #missing sentinel; no fallback is applied.
+     *
+     * @param key A valid KeyId
+     * @return StridedSpan<const std::string_view> One entry per locale
+     */
+    StridedSpan<const std::string_view> row(KeyId key) const
+    {
+      assert(key < keys.size());
+      if (layout == Layout::KeyMajor)
+      {
+        return {slab.data() + static_cast<std::size_t>(key) * locales.size(), locales.size(), 1};
+      }
+      return {slab.data() + key, locales.size(), keys.size()};
+    }
+
+    /**
+     * @brief Get the translations of every key in one locale
+     *
+     * The counterpart of row(): contiguous with Layout::LocaleMajor, strided by localeCount()
+     * with Layout::KeyMajor. Indexed by KeyId; no fallback is applied.
+     *
+     * @param locale A valid LocaleId
+     * @return StridedSpan<const std::string_view> One entry per key
+     */
+    StridedSpan<const std::string_view> column(LocaleId locale) const
+    {
+      assert(locale < locales.size());
+      if (layout == Layout::LocaleMajor)
+      {
+        return {slab.data() + static_cast<std::size_t>(locale) * keys.size(), keys.size(), 1};
+      }
+      return {slab.data() + locale, keys.size(), locales.size()};
+    }
+
+    /**
+     * @brief Look up a translation by id, falling back to English ("en") like I18n::get()
+     *
+     * Ids past keyCount() or localeCount() behave like invalidKey and invalidLocale.
+     *
+     * @param key The KeyId (invalidKey is allowed)
+     * @param locale The LocaleId (invalidLocale is allowed)
+     * @param defaultValue Returned when neither the locale nor the fallback has the key
+     * @return std::string_view The translation, a view into catalog storage
+     */
+    std::string_view t_view(KeyId key, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      std::size_t cell = resolveCell(key, locale);
+      return cell != std::string_view::npos ? slab[cell] : defaultValue;
+    }
+
+    /**
+     * @brief Look up a translation by path and locale code
+     *
+     * @param path The dot-separated path (e.g., "user.greeting")
+     * @param langCode The locale code (e.g., "en")
+     * @param defaultValue Returned when no translation is found
+     * @return std::string_view The translation, a view into catalog storage
+     */
+    std::string_view t_view(std::string_view path, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_view(findKey(path), findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Metrics of the translation t_view() returns, with the same fallback
+     *
+     * The metrics were computed when the catalog was built, so this is a table read.
+     *
+     * Example usage:
+     * @code{.cpp}
+     * i18n::TextMetrics meta = catalog.t_meta(key, locale);
+     * std::size_t padding = meta.width < columns ? columns - meta.width : 0;
+     * @endcode
+     *
+     * @param key The KeyId (invalidKey is allowed)
+     * @param locale The LocaleId (invalidLocale is allowed)
+     * @return TextMetrics The metrics, or those of an empty string when there is no translation
+     */
+    TextMetrics t_meta(KeyId key, LocaleId locale) const
+    {
+      std::size_t cell = resolveCell(key, locale);
+      return cell != std::string_view::npos ? metrics[cell] : TextMetrics{};
+    }
+
+    /**
+     * @brief Metrics of the translation for a path and locale code
+     *
+     * @param path The dot-separated path (e.g., "user.greeting")
+     * @param langCode The locale code (e.g., "en")
+     * @return TextMetrics The metrics, or those of an empty string when there is no translation
+     */
+    TextMetrics t_meta(std::string_view path, std::string_view langCode) const
+    {
+      return t_meta(findKey(path), findLocale(langCode));
+    }
+
+    /**
+     * @brief Look up a translation in upper case, with the same fallback as t_view()
+     *
+     * The case mapping follows the rules of @p locale (see appendCaseMapped()), e.g. Turkish
+     * "i" becomes U+0130. The first call for a locale maps all of its translations once
+     * (thread-safe); every later call is a plain read.
+     *
+     * @param key The KeyId (invalidKey is allowed)
+     * @param locale The LocaleId (invalidLocale is allowed)
+     * @param defaultValue Returned when neither the locale nor the fallback has the key
+     * @return std::string_view The upper-case translation, a view into catalog storage
+     */
+    std::string_view t_upper(KeyId key, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      return caseVariant(key, locale, TextCase::Upper, defaultValue);
+    }
+
+    /**
+     * @brief Look up a translation in upper case by path and locale code
+     */
+    std::string_view t_upper(std::string_view path, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_upper(findKey(path), findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Look up a translation in lower case, like t_upper()
+     */
+    std::string_view t_lower(KeyId key, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      return caseVariant(key, locale, TextCase::Lower, defaultValue);
+    }
+
+    /**
+     * @brief Look up a translation in lower case by path and locale code
+     */
+    std::string_view t_lower(std::string_view path, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_lower(findKey(path), findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Look up a translation in title case (first letter of each word), like t_upper()
+     */
+    std::string_view t_title(KeyId key, LocaleId locale, std::string_view defaultValue = {}) const
+    {
+      return caseVariant(key, locale, TextCase::Title, defaultValue);
+    }
+
+    /**
+     * @brief Look up a translation in title case by path and locale code
+     */
+    std::string_view t_title(std::string_view path, std::string_view langCode, std::string_view defaultValue = {}) const
+    {
+      return t_title(findKey(path), findLocale(langCode), defaultValue);
+    }
+
+    /**
+     * @brief Build the upper, lower and title case variants of every locale now rather than on first use
+     */
+    void buildCaseVariants() const
+    {
+      for (LocaleId locale = 0; locale < locales.size(); ++locale)
+      {
+        for (TextCase target : {TextCase::Upper, TextCase::Lower, TextCase::Title})
+        {
+          caseColumn(locale, target);
+        }
+      }
+    }
+
+    /**
+     * @brief Compute a collation sort key for every (key, locale) cell
+     *
+     * Each key is computed with the collation rules of its locale (see Collator) from the
+     * text t_view() returns for that cell, including fallback text, so sorting labels in one
+     * locale compares exactly what is displayed. Builds do this when CatalogOptions::sortKeys
+     * is set; call it after load() to enable sort_key() on a loaded catalog.
+     */
+    void buildSortKeys()
+    {
+      std::pmr::memory_resource *memory = resource();
+      auto owner = std::allocate_shared<std::pmr::vector<char>>(std::pmr::polymorphic_allocator<char>(memory));
+      std::pmr::vector<std::size_t> ends(slab.size(), memory);
+
+      for (LocaleId locale = 0; locale < locales.size(); ++locale)
+      {
+        Collator collator(locales[locale]);
+        for (KeyId key = 0; key < keys.size(); ++key)
+        {
+          collator.appendSortKey(t_view(key, locale), *owner);
+          ends[cellIndex(key, locale)] = owner->size();
+        }
+      }
+
+      // Cells were appended locale by locale; views are taken once the buffer stops growing.
+      sortKeys.assign(slab.size(), std::string_view());
+      std::size_t begin = 0;
+      for (LocaleId locale = 0; locale < locales.size(); ++locale)
+      {
+        for (KeyId key = 0; key < keys.size(); ++key)
+        {
+          std::size_t cell = cellIndex(key, locale);
+          sortKeys[cell] = std::string_view(owner->data() + begin, ends[cell] - begin);
+          begin = ends[cell];
+        }
+      }
+      sortKeyPool = std::shared_ptr<const char>(owner, owner->data());
+    }
+
+    /**
+     * @brief Check whether sort_key() is available
+     */
+    bool hasSortKeys() const
+    {
+      return !sortKeys.empty() || slab.empty();
+    }
+
+    /**
+     * @brief Collation sort key of the translation t_view() returns for (key, locale)
+     *
+     * Keys of one locale compare with memcmp (std::string_view::compare, operator<) in the
+     * locale's collation order, so sorting translated labels needs no comparator of its own.
+     *
+     * Example usage:
+     * @code{.cpp}
+     * std::sort(ids.begin(), ids.end(), [&](i18n::KeyId a, i18n::KeyId b)
+     *           { return catalog.sort_key(a, locale) < catalog.sort_key(b, locale); });
+     * @endcode
+     *
+     * @param key A valid KeyId
+     * @param locale A valid LocaleId
+     * @return std::string_view The binary sort key, or an empty view if sort keys were not built
+     */
+    std::string_view sort_key(KeyId key, LocaleId locale) const
+    {
+      return sortKeys.empty() ? std::string_view() : sortKeys[cellIndex(key, locale)];
+    }
+
+    /**
+     * @brief Write the catalog in the binary catalog format
+     *
+     * The file records the layout, so a catalog compiled once (e.g., by `i18n-tool compile`)
+     * loads back in the same cell order without re-parsing any JSON.
+     *
+     * @param filePath Destination path
+     * @throws std::runtime_error If the file cannot be written
+     */
+    void save(const std::string &filePath) const;
+
+    /**
+     * @brief Load a catalog written by save()
+     *
+     * @param filePath Path to the binary catalog
+     * @param layout Cell order to use instead of the one recorded in the file
+     * @param resource Memory resource for the file contents and tables; nullptr uses the default resource
+     * @return Catalog The loaded catalog
+     * @throws std::runtime_error If the file cannot be read or is not a valid binary catalog
+     */
+    static Catalog load(const std::string &filePath, std::optional<Layout> layout = std::nullopt, std::pmr::memory_resource *resource = nullptr);
+
+    /**
+     * @brief Load a catalog from bytes in the binary catalog format
+     *
+     * Strings are not copied: the catalog keeps @p bytes alive and points into it. They are
+     * validated as UTF-8 once, here, so the loaded catalog can be trusted like a built one;
+     * text metrics recorded by save() are taken as stored.
+     *
+     * @param bytes Buffer holding a complete binary catalog
+     * @param size Size of the buffer in bytes
+     * @param layout Cell order to use instead of the one recorded in the data
+     * @param resource Memory resource for the tables; nullptr uses the default resource
+     * @return Catalog The loaded catalog
+     * @throws std::runtime_error If the data is not a valid binary catalog or not valid UTF-8
+     */
+    static Catalog fromBytes(std::shared_ptr<const char> bytes, std::size_t size, std::optional<Layout> layout = std::nullopt, std::pmr::memory_resource *resource = nullptr);
+  };
+
+  /**
+   * @brief Incrementally assembles a Catalog, one (locale, key, value) entry at a time.
+   *
+   * Values are appended to a single byte pool and identical strings are stored once.
+   * Adding the same cell twice keeps the last value.
+   *
+   * Example usage:
+   * @code{.cpp}
+   * i18n::CatalogBuilder builder;
+   * builder.add("en", "greeting", "Hello");
+   * builder.add("id", "greeting", "Halo");
+   * i18n::Catalog catalog = builder.build();
+   * @endcode
+   */
+  struct CatalogBuilder
+  {
+  private:
+    static constexpr std::uint32_t noValue = std::numeric_limits<std::uint32_t>::max();
+
+    struct Cell
+    {
+      std::uint32_t offset = noValue;
+      std::uint32_t length = 0;
+    };
+
+    std::pmr::vector<char> bytes;
+    std::vector<Cell> localeNames;
+    std::vector<Cell> keyNames;
+    std::vector<std::vector<Cell>> cells;
+    std::unordered_map<std::uint64_t, std::vector<KeyId>> keyIds;
+    std::unordered_map<std::uint64_t, std::vector<Cell>> interned;
+
+    std::string_view view(Cell cell) const
+    {
+      return {bytes.data() + cell.offset, cell.length};
+    }
+
+    Cell append(std::string_view text)
+    {
+      if (bytes.size() + text.size() >= noValue)
+      {
+        throw std::runtime_error("Catalog exceeds 4 GiB of string data");
+      }
+      Cell cell{static_cast<std::uint32_t>(bytes.size()), static_cast<std::uint32_t>(text.size())};
+      bytes.insert(bytes.end(), text.begin(), text.end());
+      return cell;
+    }
+
+    Cell intern(std::string_view text)
+    {
+      auto &bucket = interned[hashPath(text)];
+      for (const Cell &cell : bucket)
+      {
+        if (view(cell) == text)
+        {
+          return cell;
+        }
+      }
+      bucket.push_back(append(text));
+      return bucket.back();
+    }
+
+    /**
+     * @brief Validate every distinct string as UTF-8, repairing or rejecting invalid values
+     */
+    void checkUtf8(InvalidUtf8 policy)
+    {
+      for (const auto *names : {&localeNames, &keyNames})
+      {
+        for (const Cell &name : *names)
+        {
+          if (validateUtf8(view(name)) != std::string_view::npos)
+          {
+            throw std::runtime_error("Invalid UTF-8 in " + std::string(names == &localeNames ? "locale code" : "key path") +
+                                     " '" + std::string(view(name)) + "'");
+          }
+        }
+      }
+
+      // Interned values are shared between cells, so each distinct string is checked once.
+      std::unordered_map<std::uint64_t, Cell> checked;
+      for (LocaleId locale = 0; locale < cells.size(); ++locale)
+      {
+        auto &column = cells[locale];
+        for (KeyId key = 0; key < column.size(); ++key)
+        {
+          Cell &cell = column[key];
+          if (cell.offset == noValue)
+          {
+            continue;
+          }
+
+          auto [it, inserted] = checked.try_emplace((std::uint64_t{cell.offset} << 32) | cell.length, cell);
+          if (inserted)
+          {
+            std::string_view text = view(cell);
+            std::size_t error = validateUtf8(text);
+            if (error != std::string_view::npos)
+            {
+              if (policy == InvalidUtf8::Reject)
+              {
+                throw std::runtime_error("Invalid UTF-8 at byte " + std::to_string(error) + " of '" +
+                                         std::string(view(keyNames[key])) + "' in locale '" +
+                                         std::string(view(localeNames[locale])) + "'");
+              }
+              it->second = intern(repairUtf8(text));
+            }
+          }
+          cell = it->second;
+        }
+      }
+    }
+
+    void addTree(LocaleId locale, const nlohmann::json &node, std::string &path)
+    {
+      for (auto &[key, value] : node.items())
+      {
+        std::size_t length = path.size();
+        if (!path.empty())
+        {
+          path += '.';
+        }
+        path += key;
+
+        if (value.is_object() || value.is_array())
+        {
+          addTree(locale, value, path);
+        }
+        else if (value.is_string())
+        {
+          set(addKey(path), locale, value.get_ref<const std::string &>());
+        }
+
+        path.resize(length);
+      }
+    }
+
+  public:
+    /**
+     * @brief Register a locale (idempotent)
+     *
+     * @param code The locale code (e.g., "en")
+     * @return LocaleId The id of the locale
+     */
+    LocaleId addLocale(std::string_view code)
+    {
+      // Locale codes are few, so a linear scan is cheaper than a map.
+      for (std::size_t i = 0; i < localeNames.size(); ++i)
+      {
+        if (view(localeNames[i]) == code)
+        {
+          return static_cast<LocaleId>(i);
+        }
+      }
+      localeNames.push_back(append(code));
+      cells.emplace_back(keyNames.size());
+      return static_cast<LocaleId>(localeNames.size() - 1);
+    }
+
+    /**
+     * @brief Register a key path (idempotent)
+     *
+     * @param path The dot-separated path (e.g., "user.greeting")
+     * @return KeyId The id of the key; ids are assigned in first-seen order
+     */
+    KeyId addKey(std::string_view path)
+    {
+      auto &bucket = keyIds[hashPath(path)];
+      for (KeyId id : bucket)
+      {
+        if (view(keyNames[id]) == path)
+        {
+          return id;
+        }
+      }
+
+      KeyId id = static_cast<KeyId>(keyNames.size());
+      keyNames.push_back(append(path));
+      bucket.push_back(id);
+      return id;
+    }
+
+    /**
+     * @brief Set the translation of a key in a locale
+     *
+     * @param key An id returned by addKey()
+     * @param locale An id returned by addLocale()
+     * @param value The translated text
+     */
+    void set(KeyId key, LocaleId locale, std::string_view value)
+    {
+      auto &column = cells[locale];
+      if (column.size() <= key)
+      {
+        column.resize(keyNames.size());
+      }
+      column[key] = intern(value);
+    }
+
+    /**
+     * @brief Add one entry, registering its locale and key as needed
+     *
+     * @param locale The locale code (e.g., "en")
+     * @param path The dot-separated key path (e.g., "user.greeting")
+     * @param value The translated text
+     */
+    void add(std::string_view locale, std::string_view path, std::string_view value)
+    {
+      LocaleId localeId = addLocale(locale);
+      set(addKey(path), localeId, value);
+    }
+
+    /**
+     * @brief Add every string leaf (including array elements) of a JSON object organized by locale
+     *
+     * @param json A JSON object with locale codes as keys and translation objects as values
+     * @throws std::runtime_error If the JSON is not an object
+     */
+    void addJson(const nlohmann::json &json)
+    {
+      if (!json.is_object())
+      {
+        throw std::runtime_error("JSON must be an object");
+      }
+
+      std::string path;
+      for (auto &[code, tree] : json.items())
+      {
+        LocaleId locale = addLocale(code);
+        if (tree.is_object())
+        {
+          addTree(locale, tree, path);
+        }
+      }
+    }
+
+    /**
+     * @brief Produce the immutable catalog
+     *
+     * The builder is left empty and can be reused.
+     *
+     * @param options Build settings such as the slab layout, memory resource and UTF-8 policy
+     * @return Catalog The compiled catalog
+     * @throws std::runtime_error If a string is not valid UTF-8 and cannot be repaired
+     */
+    Catalog build(const CatalogOptions &options = {})
+    {
+      LoadStats *stats = options.stats;
+      {
+        detail::PhaseTimer timer(stats, "utf8");
+        timer.bytes = bytes.size();
+        checkUtf8(options.invalidUtf8);
+      }
+
+      std::pmr::memory_resource *resource = options.resource ? options.resource : std::pmr::get_default_resource();
+      Catalog catalog(resource);
+      catalog.layout = options.layout;
+
+      {
+        detail::PhaseTimer timer(stats, "slab");
+
+        // Keep at least one byte so empty translations never get a null data pointer.
+        // The pool moves as-is on the default resource and is copied once onto any other.
+        bytes.push_back('\0');
+        auto owner = std::allocate_shared<std::pmr::vector<char>>(std::pmr::polymorphic_allocator<char>(resource), std::move(bytes));
+        catalog.pool = std::shared_ptr<const char>(owner, owner->data());
+        catalog.poolSize = owner->size();
+        timer.bytes = catalog.poolSize;
+        const char *base = owner->data();
+        auto resolve = [base](Cell cell)
+        {
+          return cell.offset == noValue ? Catalog::missing : std::string_view(base + cell.offset, cell.length);
+        };
+
+        for (const Cell &name : localeNames)
+        {
+          catalog.locales.push_back(resolve(name));
+        }
+        for (const Cell &name : keyNames)
+        {
+          catalog.keys.push_back(resolve(name));
+        }
+
+        catalog.slab.assign(keyNames.size() * localeNames.size(), Catalog::missing);
+        for (LocaleId locale = 0; locale < localeNames.size(); ++locale)
+        {
+          const auto &column = cells[locale];
+          for (KeyId key = 0; key < column.size(); ++key)
+          {
+            catalog.slab[catalog.cellIndex(key, locale)] = resolve(column[key]);
+          }
+        }
+      }
+
+      {
+        detail::PhaseTimer timer(stats, "index");
+        catalog.buildIndex();
+      }
+      {
+        detail::PhaseTimer timer(stats, "metrics");
+        catalog.measure();
+      }
+      catalog.fallback = catalog.findLocale("en");
+      {
+        detail::PhaseTimer timer(stats, "code tables");
+        catalog.detectCodeTables();
+        for (const std::string &pattern : options.codeTables)
+        {
+          catalog.buildCodeTable(pattern);
+        }
+      }
+      if (options.sortKeys)
+      {
+        detail::PhaseTimer timer(stats, "sort keys");
+        catalog.buildSortKeys();
+      }
+      catalog.resetCaseColumns();
+      if (options.caseVariants)
+      {
+        detail::PhaseTimer timer(stats, "case variants");
+        catalog.buildCaseVariants();
+      }
+
+      *this = CatalogBuilder();
+      return catalog;
+    }
+  };
+
+  inline Catalog::Catalog(const nlohmann::json &json, const CatalogOptions &options) : Catalog(compile(json, options)) {}
+
+  inline Catalog Catalog::compile(const nlohmann::json &json, const CatalogOptions &options)
+  {
+    if (!json.is_object())
+    {
+      throw std::runtime_error("JSON must be an object");
+    }
+
+    if (json.empty())
+    {
+      throw std::runtime_error("JSON object is empty");
+    }
+
+    CatalogBuilder builder;
+    builder.addJson(json);
+    return builder.build(options);
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief Binary catalog format, version 2 (all integers are native-endian uint32)
+     *
+     * | Offset | Field                                                       |
+     * |--------|-------------------------------------------------------------|
+     * | 0      | magic "I18NCAT" + NUL                                       |
+     * | 8      | version                                                     |
+     * | 12     | byte-order mark 0x01020304                                  |
+     * | 16     | layout                                                      |
+     * | 20     | locale count L                                              |
+     * | 24     | key count K                                                 |
+     * | 28     | pool offset from start of file                              |
+     * | 32     | pool size                                                   |
+     * | 36     | reserved (0)                                                |
+     * | 40     | L locale cells, K key cells, K*L value cells in layout order |
+     * | ...    | K*L value metrics in layout order (version 2)               |
+     *
+     * Each cell is a (offset into pool, length) pair; missing values use offset 0xFFFFFFFF.
+     * Each metrics record is (code points, graphemes, width, flags), where flags holds the
+     * TextDirection in bits 0-1 and the ASCII flag in bit 2. Version 1 files have no metrics
+     * section; they still load, and their metrics are computed on load.
+     */
+    struct BinaryFormat
+    {
+      static constexpr char magic[8] = {'I', '1', '8', 'N', 'C', 'A', 'T', '\0'};
+      static constexpr std::uint32_t version = 2;
+      static constexpr std::uint32_t oldestVersion = 1;
+      static constexpr std::size_t metricsSize = 16;
+      static constexpr std::uint32_t byteOrder = 0x01020304;
+      static constexpr std::uint32_t noValue = std::numeric_limits<std::uint32_t>::max();
+      static constexpr std::size_t headerSize = 40;
+    };
+
+    inline void writeU32(std::ostream &out, std::uint32_t value)
+    {
+      out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    inline std::uint32_t readU32(const char *data)
+    {
+      std::uint32_t value;
+      std::memcpy(&value, data, sizeof(value));
+      return value;
+    }
+  } // namespace detail
+
+  inline void Catalog::save(const std::string &filePath) const
+  {
+    using Format = detail::BinaryFormat;
+
+    std::size_t cellCount = locales.size() + keys.size() + slab.size();
+    std::size_t poolOffset = Format::headerSize + cellCount * 8 + slab.size() * Format::metricsSize;
+    if (poolOffset + poolSize >= Format::noValue)
+    {
+      throw std::runtime_error("Catalog too large for the binary format: " + filePath);
+    }
+
+    std::ofstream ofs(filePath, std::ios::binary);
+    if (!ofs.is_open())
+    {
+      throw std::runtime_error("Could not open file: " + filePath);
+    }
+
+    ofs.write(Format::magic, sizeof(Format::magic));
+    detail::writeU32(ofs, Format::version);
+    detail::writeU32(ofs, Format::byteOrder);
+    detail::writeU32(ofs, static_cast<std::uint32_t>(layout));
+    detail::writeU32(ofs, static_cast<std::uint32_t>(locales.size()));
+    detail::writeU32(ofs, static_cast<std::uint32_t>(keys.size()));
+    detail::writeU32(ofs, static_cast<std::uint32_t>(poolOffset));
+    detail::writeU32(ofs, static_cast<std::uint32_t>(poolSize));
+    detail::writeU32(ofs, 0);
+
+    auto writeCell = [&](std::string_view cell)
+    {
+      detail::writeU32(ofs, isMissing(cell) ? Format::noValue : static_cast<std::uint32_t>(cell.data() - pool.get()));
+      detail::writeU32(ofs, static_cast<std::uint32_t>(cell.size()));
+    };
+    for (std::string_view cell : locales)
+    {
+      writeCell(cell);
+    }
+    for (std::string_view cell : keys)
+    {
+      writeCell(cell);
+    }
+    for (std::string_view cell : slab)
+    {
+      writeCell(cell);
+    }
+    for (const TextMetrics &cell : metrics)
+    {
+      detail::writeU32(ofs, cell.codePoints);
+      detail::writeU32(ofs, cell.graphemes);
+      detail::writeU32(ofs, cell.width);
+      detail::writeU32(ofs, static_cast<std::uint32_t>(cell.direction) | (cell.ascii ? 4u : 0u));
+    }
+
+    ofs.write(pool.get(), static_cast<std::streamsize>(poolSize));
+    if (!ofs)
+    {
+      throw std::runtime_error("Could not write file: " + filePath);
+    }
+  }
+
+  inline Catalog Catalog::fromBytes(std::shared_ptr<const char> bytes, std::size_t size, std::optional<Layout> layout, std::pmr::memory_resource *resource)
+  {
+    using Format = detail::BinaryFormat;
+
+    const char *data = bytes.get();
+    if (size < Format::headerSize || std::memcmp(data, Format::magic, sizeof(Format::magic)) != 0)
+    {
+      throw std::runtime_error("Not a binary catalog");
+    }
+    std::uint32_t version = detail::readU32(data + 8);
+    if (version < Format::oldestVersion || version > Format::version)
+    {
+      throw std::runtime_error("Unsupported binary catalog version");
+    }
+    if (detail::readU32(data + 12) != Format::byteOrder)
+    {
+      throw std::runtime_error("Binary catalog was written with a different byte order");
+    }
+
+    std::uint32_t storedLayout = detail::readU32(data + 16);
+    std::uint64_t locales64 = detail::readU32(data + 20);
+    std::uint64_t keys64 = detail::readU32(data + 24);
+    std::uint64_t poolOffset64 = detail::readU32(data + 28);
+    std::uint64_t poolBytes64 = detail::readU32(data + 32);
+
+    // The counts are untrusted: bound them by the bytes actually present before multiplying,
+    // so no product can wrap. Each value cell takes 8 bytes plus one metrics record (version 2).
+    // The product of two u32 values fits in 64 bits; only the size of the value section could not.
+    std::uint64_t available = size - Format::headerSize;
+    std::uint64_t valueBytes = 8 + (version >= 2 ? Format::metricsSize : 0);
+    std::uint64_t values64 = locales64 * keys64;
+    if (storedLayout > static_cast<std::uint32_t>(Layout::LocaleMajor) ||
+        locales64 + keys64 > available / 8 ||
+        values64 > (available - (locales64 + keys64) * 8) / valueBytes ||
+        poolOffset64 != Format::headerSize + (locales64 + keys64) * 8 + values64 * valueBytes ||
+        poolOffset64 + poolBytes64 > size)
+    {
+      throw std::runtime_error("Corrupt binary catalog");
+    }
+
+    std::size_t localeCount = static_cast<std::size_t>(locales64);
+    std::size_t keyCount = static_cast<std::size_t>(keys64);
+    std::size_t poolOffset = static_cast<std::size_t>(poolOffset64);
+    std::size_t poolBytes = static_cast<std::size_t>(poolBytes64);
+    std::size_t cellCount = localeCount + keyCount + keyCount * localeCount;
+    std::size_t metricsBytes = version >= 2 ? keyCount * localeCount * Format::metricsSize : 0;
+
+    Catalog catalog(resource ? resource : std::pmr::get_default_resource());
+    catalog.pool = std::shared_ptr<const char>(bytes, data + poolOffset);
+    catalog.poolSize = poolBytes;
+    catalog.layout = static_cast<Layout>(storedLayout);
+
+    const char *base = data + poolOffset;
+    const char *cells = data + Format::headerSize;
+    auto readCell = [&](std::size_t i)
+    {
+      std::uint32_t offset = detail::readU32(cells + i * 8);
+      std::uint32_t length = detail::readU32(cells + i * 8 + 4);
+      if (offset == Format::noValue)
+      {
+        return missing;
+      }
+      if (static_cast<std::size_t>(offset) + length > poolBytes)
+      {
+        throw std::runtime_error("Corrupt binary catalog");
+      }
+      return std::string_view(base + offset, length);
+    };
+
+    std::size_t cell = 0;
+    catalog.locales.reserve(localeCount);
+    for (std::size_t i = 0; i < localeCount; ++i)
+    {
+      catalog.locales.push_back(readCell(cell++));
+    }
+    catalog.keys.reserve(keyCount);
+    for (std::size_t i = 0; i < keyCount; ++i)
+    {
+      catalog.keys.push_back(readCell(cell++));
+    }
+    catalog.slab.resize(keyCount * localeCount);
+    for (auto &value : catalog.slab)
+    {
+      value = readCell(cell++);
+    }
+
+    if (metricsBytes == 0)
+    {
+      catalog.validate();
+      catalog.measure();
+    }
+    else
+    {
+      const char *record = cells + cellCount * 8;
+      catalog.metrics.resize(catalog.slab.size());
+      for (auto &cellMetrics : catalog.metrics)
+      {
+        std::uint32_t flags = detail::readU32(record + 12);
+        if ((flags & 3u) > static_cast<std::uint32_t>(TextDirection::RightToLeft))
+        {
+          throw std::runtime_error("Corrupt binary catalog");
+        }
+        cellMetrics = {detail::readU32(record), detail::readU32(record + 4), detail::readU32(record + 8),
+                   static_cast<TextDirection>(flags & 3u), (flags & 4u) != 0};
+        record += Format::metricsSize;
+      }
+      catalog.validate();
+    }
+
+    catalog.buildIndex();
+    catalog.fallback = catalog.findLocale("en");
+    catalog.detectCodeTables();
+    if (layout)
+    {
+      catalog.relayout(*layout);
+    }
+    catalog.resetCaseColumns();
+    return catalog;
+  }
+
+  inline Catalog Catalog::load(const std::string &filePath, std::optional<Layout> layout, std::pmr::memory_resource *resource)
+  {
+    std::ifstream ifs(filePath, std::ios::binary);
+    if (!ifs.is_open())
+    {
+      throw std::runtime_error("Could not open file: " + filePath);
+    }
+
+    ifs.seekg(0, std::ios::end);
+    std::streamoff size = ifs.tellg();
+    if (size <= 0)
+    {
+      throw std::runtime_error("File is empty: " + filePath);
+    }
+    ifs.seekg(0, std::ios::beg);
+
+    if (!resource)
+    {
+      resource = std::pmr::get_default_resource();
+    }
+    auto owner = std::allocate_shared<std::pmr::vector<char>>(std::pmr::polymorphic_allocator<char>(resource), static_cast<std::size_t>(size));
+    if (!ifs.read(owner->data(), size))
+    {
+      throw std::runtime_error("Could not read file: " + filePath);
+    }
+
+    try
+    {
+      return fromBytes(std::shared_ptr<const char>(owner, owner->data()), static_cast<std::size_t>(size), layout, resource);
+    }
+    catch (const std::runtime_error &e)
+    {
+      throw std::runtime_error(std::string(e.what()) + ": " + filePath);
+    }
+  }
+} // namespace i18n
+
+#endif // I18N_CATALOG_HPP
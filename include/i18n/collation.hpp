@@ -0,0 +1,500 @@
+#ifndef I18N_COLLATION_HPP
+#define I18N_COLLATION_HPP
+
+#include "unicode.hpp"
+#include "unicode_tables.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace i18n
+{
+  namespace detail
+  {
+    /**
+     * @brief One collation element: primary (base letter), secondary (accents) and tertiary (case) weight
+     */
+    struct CollationElement
+    {
+      std::uint16_t primary;
+      std::uint8_t secondary;
+      std::uint8_t tertiary;
+    };
+
+    /**
+     * @brief Secondary and tertiary weight of an unaccented lowercase letter
+     */
+    constexpr std::uint8_t commonWeight = 0x05;
+
+    /**
+     * @brief Tertiary weight of an uppercase letter
+     */
+    constexpr std::uint8_t upperWeight = 0x06;
+
+    /**
+     * @brief Tertiary weight of letter variants and expansions such as sharp s, final sigma and ae
+     */
+    constexpr std::uint8_t variantWeight = 0x07;
+
+    /**
+     * @brief Secondary weight of letters with a stroke or bar (o, l, d with stroke, ...), after all accents
+     */
+    constexpr std::uint8_t strokeWeight = 0x80;
+
+    /**
+     * @brief Primary weights: punctuation and symbols sort before digits, digits before letters,
+     * and letters of each script follow in alphabet order, 8 apart so that tailorings can insert
+     * letters in between. Code points without a weight get implicit weights after all letters.
+     */
+    constexpr std::uint16_t symbolPrimary = 0x0100;
+    constexpr std::uint16_t punctuationPrimary = 0x0200;
+    constexpr std::uint16_t digitPrimary = 0x0800;
+    constexpr std::uint16_t latinPrimary = 0x1000;
+    constexpr std::uint16_t greekPrimary = 0x1200;
+    constexpr std::uint16_t cyrillicPrimary = 0x1400;
+    constexpr std::uint16_t implicitPrimary = 0xFB00;
+    constexpr std::uint16_t letterStep = 8;
+
+    /**
+     * @brief Cyrillic letters in collation order (Russian, Ukrainian, Belarusian, Serbian, Macedonian)
+     */
+    inline constexpr std::u32string_view cyrillicAlphabet =
+        U"\u0430\u0431\u0432\u0433\u0491\u0434\u0452\u0435\u0454\u0436\u0437\u0455"
+        U"\u0438\u0456\u0439\u0458\u043A\u043B\u0459\u043C\u043D\u045A\u043E\u043F"
+        U"\u0440\u0441\u0442\u045B\u0443\u0444\u0445\u0446\u0447\u045F\u0448\u0449"
+        U"\u044A\u044B\u044C\u044D\u044E\u044F";
+
+    /**
+     * @brief A letter that a locale sorts as a separate letter rather than as an accented variant
+     */
+    struct TailoredLetter
+    {
+      /**
+       * @brief Lowercase base letter
+       */
+      char32_t base;
+
+      /**
+       * @brief Combining mark that makes the letter distinct, or 0 for the bare base letter
+       */
+      char32_t mark;
+
+      /**
+       * @brief The letter it sorts after
+       */
+      char32_t after;
+
+      /**
+       * @brief Position after @ref after (1-7)
+       */
+      std::uint16_t step;
+    };
+
+    /**
+     * @brief Collation rules of one group of languages
+     */
+    struct Tailoring
+    {
+      /**
+       * @brief Language subtags the rules apply to, space-separated
+       */
+      std::string_view languages;
+
+      const TailoredLetter *letters;
+      std::size_t count;
+
+      /**
+       * @brief Whether I/dotless i and dotted I/i are case pairs (Turkish, Azerbaijani)
+       */
+      bool dottedI;
+    };
+
+    inline constexpr TailoredLetter swedishLetters[] = {
+        {U'a', 0x030A, U'z', 1}, {U'a', 0x0308, U'z', 2}, {U'o', 0x0308, U'z', 3}};
+    inline constexpr TailoredLetter danishLetters[] = {
+        {0x00E6, 0, U'z', 1}, {0x00F8, 0, U'z', 2}, {U'a', 0x030A, U'z', 3}};
+    inline constexpr TailoredLetter spanishLetters[] = {{U'n', 0x0303, U'n', 1}};
+    inline constexpr TailoredLetter turkishLetters[] = {
+        {U'c', 0x0327, U'c', 1}, {U'g', 0x0306, U'g', 1}, {0x0131, 0, U'h', 7},
+        {U'o', 0x0308, U'o', 1}, {U's', 0x0327, U's', 1}, {U'u', 0x0308, U'u', 1}};
+    inline constexpr TailoredLetter polishLetters[] = {
+        {U'a', 0x0328, U'a', 1}, {U'c', 0x0301, U'c', 1}, {U'e', 0x0328, U'e', 1},
+        {0x0142, 0, U'l', 1}, {U'n', 0x0301, U'n', 1}, {U'o', 0x0301, U'o', 1},
+        {U's', 0x0301, U's', 1}, {U'z', 0x0301, U'z', 1}, {U'z', 0x0307, U'z', 2}};
+    inline constexpr TailoredLetter czechLetters[] = {
+        {U'c', 0x030C, U'c', 1}, {U'r', 0x030C, U'r', 1}, {U's', 0x030C, U's', 1}, {U'z', 0x030C, U'z', 1}};
+
+    inline constexpr Tailoring tailorings[] = {
+        {"sv fi", swedishLetters, std::size(swedishLetters), false},
+        {"da nb nn no", danishLetters, std::size(danishLetters), false},
+        {"es", spanishLetters, std::size(spanishLetters), false},
+        {"tr az", turkishLetters, std::size(turkishLetters), true},
+        {"pl", polishLetters, std::size(polishLetters), false},
+        {"cs sk", czechLetters, std::size(czechLetters), false}};
+
+    /**
+     * @brief Find the tailoring for a locale code such as "sv" or "tr-TR", or nullptr for the root order
+     */
+    inline const Tailoring *findTailoring(std::string_view locale)
+    {
+      std::string language(locale.substr(0, locale.find_first_of("-_")));
+      for (char &c : language)
+      {
+        c = c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+      }
+
+      for (const Tailoring &tailoring : tailorings)
+      {
+        std::string_view names = tailoring.languages;
+        while (!names.empty())
+        {
+          std::size_t end = std::min(names.find(' '), names.size());
+          if (names.substr(0, end) == language)
+          {
+            return &tailoring;
+          }
+          names.remove_prefix(std::min(end + 1, names.size()));
+        }
+      }
+      return nullptr;
+    }
+
+    /**
+     * @brief The generated decomposition of @p cp, or nullptr
+     */
+    inline const LetterDecomposition *findDecomposition(char32_t cp)
+    {
+      std::size_t low = 0;
+      std::size_t high = std::size(letterDecompositions);
+      while (low < high)
+      {
+        std::size_t mid = (low + high) / 2;
+        if (letterDecompositions[mid].codePoint < cp)
+        {
+          low = mid + 1;
+        }
+        else
+        {
+          high = mid;
+        }
+      }
+      return low < std::size(letterDecompositions) && letterDecompositions[low].codePoint == cp ? &letterDecompositions[low] : nullptr;
+    }
+
+    /**
+     * @brief Primary weight of a lowercase letter of one of the alphabets, or 0
+     */
+    inline std::uint16_t letterPrimary(char32_t letter)
+    {
+      if (letter >= U'a' && letter <= U'z')
+      {
+        return static_cast<std::uint16_t>(latinPrimary + (letter - U'a') * letterStep);
+      }
+      if (letter == 0x00FE) // thorn, after z
+      {
+        return static_cast<std::uint16_t>(latinPrimary + 26 * letterStep);
+      }
+      if (letter >= 0x03B1 && letter <= 0x03C9 && letter != 0x03C2)
+      {
+        return static_cast<std::uint16_t>(greekPrimary + (letter - 0x03B1) * letterStep);
+      }
+      std::size_t index = cyrillicAlphabet.find(letter);
+      if (index != std::u32string_view::npos)
+      {
+        return static_cast<std::uint16_t>(cyrillicPrimary + index * letterStep);
+      }
+      return 0;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Compact, table-driven collation producing binary sort keys.
+   *
+   * Strings are compared on three levels, as in the Unicode Collation Algorithm: base letters
+   * first, then accents, then case ("role" < "Role" < "r&ocirc;le" < "roles"). Latin, Greek and
+   * Cyrillic letters use alphabet order, with locale tailorings for languages that sort some
+   * accented letters as separate letters (Swedish, Finnish, Danish, Norwegian, Spanish,
+   * Turkish, Azerbaijani, Polish, Czech, Slovak). Other scripts sort by code point. Contractions
+   * such as Czech "ch" are not modelled.
+   *
+   * A sort key compares with memcmp (or std::string_view::compare) in the same order as the
+   * strings collate, so it can be computed once and reused for every sort.
+   *
+   * Example usage:
+   * @code{.cpp}
+   * i18n::Collator collator("sv");
+   * bool before = collator.sortKey("zebra") < collator.sortKey("\xC3\xA5ngest");   // true in Swedish
+   * @endcode
+   */
+  struct Collator
+  {
+  private:
+    const detail::Tailoring *tailoring = nullptr;
+
+    /**
+     * @brief Emit the collation elements of a letter given as lowercase base, marks and case
+     */
+    template <typename Emit>
+    void letterElements(char32_t base, char32_t mark1, char32_t mark2, bool upper, Emit &&emit) const
+    {
+      using namespace detail;
+      std::uint8_t tertiary = upper ? upperWeight : commonWeight;
+
+      if (tailoring)
+      {
+        for (std::size_t i = 0; i < tailoring->count; ++i)
+        {
+          const TailoredLetter &letter = tailoring->letters[i];
+          if (letter.base == base && (letter.mark == 0 || letter.mark == mark1))
+          {
+            emit({static_cast<std::uint16_t>(letterPrimary(letter.after) + letter.step), commonWeight, tertiary});
+            if (letter.mark != 0)
+            {
+              mark1 = mark2;
+              mark2 = 0;
+            }
+            for (char32_t mark : {mark1, mark2})
+            {
+              if (mark != 0)
+              {
+                emit({0, static_cast<std::uint8_t>(0x10 + (mark - 0x0300)), 0});
+              }
+            }
+            return;
+          }
+        }
+      }
+
+      // Letters without a decomposition: expansions and stroked variants of alphabet letters.
+      std::uint8_t secondary = commonWeight;
+      switch (base)
+      {
+      case 0x00DF: // sharp s
+        emit({letterPrimary(U's'), commonWeight, variantWeight});
+        base = U's';
+        tertiary = variantWeight;
+        break;
+      case 0x00E6: // ae
+        emit({letterPrimary(U'a'), commonWeight, variantWeight});
+        base = U'e';
+        tertiary = variantWeight;
+        break;
+      case 0x0153: // oe
+        emit({letterPrimary(U'o'), commonWeight, variantWeight});
+        base = U'e';
+        tertiary = variantWeight;
+        break;
+      case 0x0133: // ij
+        emit({letterPrimary(U'i'), commonWeight, tertiary});
+        base = U'j';
+        break;
+      case 0x03C2: // final sigma
+        base = 0x03C3;
+        tertiary = variantWeight;
+        break;
+      case 0x00F8: // o with stroke
+        base = U'o';
+        secondary = strokeWeight;
+        break;
+      case 0x0111: // d with stroke
+      case 0x00F0: // eth
+        base = U'd';
+        secondary = strokeWeight;
+        break;
+      case 0x0142: // l with stroke
+        base = U'l';
+        secondary = strokeWeight;
+        break;
+      case 0x0127: // h with stroke
+        base = U'h';
+        secondary = strokeWeight;
+        break;
+      case 0x0167: // t with stroke
+        base = U't';
+        secondary = strokeWeight;
+        break;
+      case 0x0131: // dotless i
+        base = U'i';
+        secondary = strokeWeight;
+        break;
+      default:
+        break;
+      }
+
+      emit({letterPrimary(base), commonWeight, tertiary});
+      if (secondary != commonWeight)
+      {
+        emit({0, secondary, 0});
+      }
+      for (char32_t mark : {mark1, mark2})
+      {
+        if (mark != 0)
+        {
+          emit({0, static_cast<std::uint8_t>(0x10 + (mark - 0x0300)), 0});
+        }
+      }
+    }
+
+    /**
+     * @brief Emit the collation elements of one code point
+     */
+    template <typename Emit>
+    void elements(char32_t cp, Emit &&emit) const
+    {
+      using namespace detail;
+
+      if (cp < 0x20 || (cp >= 0x7F && cp < 0xA0) || cp == 0x00AD ||
+          (cp >= 0x200B && cp <= 0x200F) || (cp >= 0x2028 && cp <= 0x202E) || (cp >= 0x2060 && cp <= 0x206F) ||
+          cp == 0xFEFF)
+      {
+        return; // controls and format characters are ignorable
+      }
+      if (cp >= U'0' && cp <= U'9')
+      {
+        emit({static_cast<std::uint16_t>(digitPrimary + (cp - U'0') * letterStep), commonWeight, commonWeight});
+        return;
+      }
+
+      bool dottedI = tailoring && tailoring->dottedI;
+      if (cp >= U'A' && cp <= U'Z')
+      {
+        letterElements(dottedI && cp == U'I' ? 0x0131 : cp - U'A' + U'a', 0, 0, true, emit);
+        return;
+      }
+      if (cp == 0x0130) // capital I with dot above
+      {
+        letterElements(U'i', dottedI ? 0 : 0x0307, 0, true, emit);
+        return;
+      }
+      if (cp < 0x100 && !(cp >= U'a' && cp <= U'z') && (cp < 0xC0 || cp == 0xD7 || cp == 0xF7))
+      {
+        emit({static_cast<std::uint16_t>(symbolPrimary + cp), commonWeight, commonWeight});
+        return;
+      }
+      if (cp >= 0x0300 && cp <= 0x036F)
+      {
+        emit({0, static_cast<std::uint8_t>(0x10 + (cp - 0x0300)), 0});
+        return;
+      }
+      if (cp >= 0x2000 && cp <= 0x20FF)
+      {
+        emit({static_cast<std::uint16_t>(punctuationPrimary + (cp - 0x2000)), commonWeight, commonWeight});
+        return;
+      }
+      if (const LetterDecomposition *letter = findDecomposition(cp))
+      {
+        letterElements(letter->base, letter->mark1, letter->mark2, letter->upper, emit);
+        return;
+      }
+      if (letterPrimary(cp) != 0)
+      {
+        letterElements(cp, 0, 0, false, emit);
+        return;
+      }
+      switch (cp)
+      {
+      case 0x00DF:
+      case 0x00E6:
+      case 0x0153:
+      case 0x0133:
+      case 0x03C2:
+      case 0x00F8:
+      case 0x0111:
+      case 0x00F0:
+      case 0x0142:
+      case 0x0127:
+      case 0x0167:
+      case 0x0131:
+        letterElements(cp, 0, 0, false, emit);
+        return;
+      default:
+        break;
+      }
+
+      // Implicit weights in code point order, as the Unicode Collation Algorithm assigns to unlisted characters.
+      emit({static_cast<std::uint16_t>(implicitPrimary + (cp >> 15)), commonWeight, commonWeight});
+      emit({static_cast<std::uint16_t>((cp & 0x7FFF) | 0x8000), 0, 0});
+    }
+
+  public:
+    /**
+     * @brief Collator for the root order (no tailoring)
+     */
+    Collator() = default;
+
+    /**
+     * @brief Collator for a locale code such as "de", "sv-SE" or "tr"
+     */
+    explicit Collator(std::string_view locale) : tailoring(detail::findTailoring(locale)) {}
+
+    /**
+     * @brief Append the sort key of @p text to @p key
+     *
+     * The key holds all primary weights (2 bytes each), a 0x0000 separator, the secondary
+     * weights, a 0x00 separator and the tertiary weights, so the most significant differences
+     * are compared first.
+     *
+     * @param text Valid UTF-8
+     * @param key Byte container with push_back() (std::string, std::vector<char>, ...)
+     */
+    template <typename Bytes>
+    void appendSortKey(std::string_view text, Bytes &key) const
+    {
+      std::string secondaries;
+      std::string tertiaries;
+      std::size_t i = 0;
+      while (i < text.size())
+      {
+        elements(detail::decodeUtf8(text, i), [&](detail::CollationElement element)
+                 {
+          if (element.primary != 0)
+          {
+            key.push_back(static_cast<char>(element.primary >> 8));
+            key.push_back(static_cast<char>(element.primary & 0xFF));
+          }
+          if (element.secondary != 0)
+          {
+            secondaries.push_back(static_cast<char>(element.secondary));
+          }
+          if (element.tertiary != 0)
+          {
+            tertiaries.push_back(static_cast<char>(element.tertiary));
+          } });
+      }
+
+      key.push_back('\0');
+      key.push_back('\0');
+      key.insert(key.end(), secondaries.begin(), secondaries.end());
+      key.push_back('\0');
+      key.insert(key.end(), tertiaries.begin(), tertiaries.end());
+    }
+
+    /**
+     * @brief The sort key of @p text
+     *
+     * @param text Valid UTF-8
+     * @return std::string Binary key; compare keys with std::string::compare or operator<
+     */
+    std::string sortKey(std::string_view text) const
+    {
+      std::string key;
+      appendSortKey(text, key);
+      return key;
+    }
+
+    /**
+     * @brief Compare two strings in this collator's order
+     *
+     * @return Negative, zero or positive like std::string::compare
+     */
+    int compare(std::string_view a, std::string_view b) const
+    {
+      return sortKey(a).compare(sortKey(b));
+    }
+  };
+} // namespace i18n
+
+#endif // I18N_COLLATION_HPP
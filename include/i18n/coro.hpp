@@ -0,0 +1,176 @@
+#ifndef I18N_CORO_HPP
+#define I18N_CORO_HPP
+
+/**
+ * @file coro.hpp
+ * @brief C++20 awaitables for loading catalogs and translation data off the calling thread.
+ *
+ * Opt-in: define I18N_ENABLE_COROUTINES and compile as C++20. Without the macro this header
+ * is empty, so C++17 builds that include it are unaffected.
+ *
+ * Each awaitable hands the blocking work (file reads, JSON parsing, catalog compilation) to
+ * a caller-supplied executor and suspends the coroutine; the executor's thread resumes it
+ * when the work is done. An executor is any callable that takes a `void()` task and runs it
+ * exactly once, typically by posting it to a thread pool:
+ *
+ * @code{.cpp}
+ * auto pool = [&](auto task) { workers.post(std::move(task)); };
+ *
+ * Task<void> refresh(SharedI18n &i18n)
+ * {
+ *   co_await i18n::reload(i18n, "translations.json", pool);  // the reactor thread never parses
+ *   co_await i18n::loadShard(i18n, "de", "de.json", pool);
+ *   i18n::Catalog catalog = co_await i18n::loadCatalog("catalog.i18nc", pool);
+ * }
+ * @endcode
+ *
+ * The coroutine continues on the executor's worker thread, not on the thread that awaited
+ * (such as an event loop's reactor thread): everything after the co_await, up to the next
+ * suspension, runs on the worker. Code that must run on the reactor has to be posted back to
+ * it explicitly, e.g. by awaiting a hop to the reactor's own executor.
+ *
+ * New data is published atomically (with the SharedSnapshot threading policy), so lookups
+ * made after the co_await returns, on any thread, see it; lookups in flight keep the
+ * snapshot they started with.
+ */
+
+#if defined(I18N_ENABLE_COROUTINES)
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "I18N_ENABLE_COROUTINES requires C++20 coroutine support"
+#endif
+
+#include "catalog.hpp"
+#include "i18n.hpp"
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace i18n
+{
+  namespace detail
+  {
+    /**
+     * @brief Awaitable that runs @p Work on an executor and resumes the awaiting coroutine there
+     *
+     * @tparam Work Callable run once on the executor; its result is the result of co_await
+     * @tparam Executor Callable taking a `void()` task
+     */
+    template <typename Work, typename Executor>
+    struct Offload
+    {
+    private:
+      using Result = std::invoke_result_t<Work &>;
+      using Slot = std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>>;
+
+      Work work;
+      Executor executor;
+      Slot result{};
+      std::exception_ptr error;
+
+    public:
+      Offload(Work task, Executor runner) : work(std::move(task)), executor(std::move(runner)) {}
+
+      bool await_ready() const noexcept
+      {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<> handle)
+      {
+        executor([this, handle]()
+                 {
+          try
+          {
+            if constexpr (std::is_void_v<Result>)
+            {
+              work();
+            }
+            else
+            {
+              result.emplace(work());
+            }
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+          handle.resume(); });
+      }
+
+      Result await_resume()
+      {
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+        if constexpr (!std::is_void_v<Result>)
+        {
+          return std::move(*result);
+        }
+      }
+    };
+
+    template <typename Work, typename Executor>
+    Offload<std::decay_t<Work>, std::decay_t<Executor>> offload(Work &&work, Executor &&executor)
+    {
+      return {std::forward<Work>(work), std::forward<Executor>(executor)};
+    }
+  } // namespace detail
+
+  /**
+   * @brief Awaitable Catalog::load(): read a binary catalog on @p executor
+   *
+   * @param filePath Path to the binary catalog
+   * @param executor Callable that runs a `void()` task, e.g. on a thread pool
+   * @return An awaitable yielding the Catalog; co_await rethrows load errors
+   */
+  template <typename Executor>
+  auto loadCatalog(std::string filePath, Executor &&executor)
+  {
+    return detail::offload([filePath = std::move(filePath)]()
+                           { return Catalog::load(filePath); },
+                           std::forward<Executor>(executor));
+  }
+
+  /**
+   * @brief Awaitable basic_i18n::load(): replace all translation data with a JSON file, parsed on @p executor
+   *
+   * @param i18n The object to update; must outlive the co_await. Lookups from other threads
+   *             during the load require a concurrent ThreadingPolicy (SharedSnapshot).
+   * @param filePath Path to the JSON file
+   * @param executor Callable that runs a `void()` task
+   * @return An awaitable; co_await rethrows load errors, after which the old data stays in use
+   */
+  template <typename I18nType, typename Executor>
+  auto reload(I18nType &i18n, std::string filePath, Executor &&executor)
+  {
+    return detail::offload([&i18n, filePath = std::move(filePath)]()
+                           { i18n.load(filePath); },
+                           std::forward<Executor>(executor));
+  }
+
+  /**
+   * @brief Awaitable basic_i18n::loadShard(): fetch one locale's translations on @p executor
+   *
+   * @param i18n The object to update; must outlive the co_await
+   * @param langCode The language code the file provides (e.g., "de")
+   * @param filePath Path to the locale's JSON file
+   * @param executor Callable that runs a `void()` task
+   * @return An awaitable; co_await rethrows load errors
+   */
+  template <typename I18nType, typename Executor>
+  auto loadShard(I18nType &i18n, std::string langCode, std::string filePath, Executor &&executor)
+  {
+    return detail::offload([&i18n, langCode = std::move(langCode), filePath = std::move(filePath)]()
+                           { i18n.loadShard(langCode, filePath); },
+                           std::forward<Executor>(executor));
+  }
+} // namespace i18n
+
+#endif // I18N_ENABLE_COROUTINES
+
+#endif // I18N_CORO_HPP
@@ -0,0 +1,879 @@
+#ifndef I18N_EXCHANGE_HPP
+#define I18N_EXCHANGE_HPP
+
+#include "catalog.hpp"
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @file exchange.hpp
+ * @brief Streaming CSV and XLIFF import/export for translation vendors.
+ *
+ * Readers pull one character at a time from the stream buffer and hand out one entry at a
+ * time, so memory stays bounded by the longest row or trans-unit no matter how large the
+ * file is. No nlohmann::json DOM is built; import goes straight into a CatalogBuilder.
+ *
+ * Example usage:
+ * @code{.cpp}
+ * i18n::CatalogBuilder builder;
+ * std::ifstream csv("vendor.csv", std::ios::binary);
+ * i18n::importCsv(csv, builder);
+ * std::ifstream xlf("vendor-de.xlf", std::ios::binary);
+ * i18n::importXliff(xlf, builder);
+ * i18n::Catalog catalog = builder.build();
+ *
+ * std::ofstream out("export.csv", std::ios::binary);
+ * i18n::exportCsv(catalog, out);
+ * @endcode
+ */
+
+namespace i18n
+{
+  namespace detail
+  {
+    /**
+     * @brief RFC 4180 record reader (quoted fields, doubled quotes, embedded newlines, CRLF).
+     */
+    struct CsvReader
+    {
+    private:
+      std::streambuf *buffer;
+      std::size_t line = 1;
+
+    public:
+      explicit CsvReader(std::istream &in) : buffer(in.rdbuf())
+      {
+        // Skip a UTF-8 byte order mark.
+        if (buffer->sgetc() == 0xEF)
+        {
+          buffer->sbumpc();
+          if (buffer->sbumpc() != 0xBB || buffer->sbumpc() != 0xBF)
+          {
+            throw std::runtime_error("CSV: invalid byte order mark");
+          }
+        }
+      }
+
+      std::size_t currentLine() const
+      {
+        return line;
+      }
+
+      /**
+       * @brief Read the next record
+       *
+       * Field strings are reused between calls so steady-state reading does not allocate.
+       *
+       * @param fields Receives the field values
+       * @param quoted Receives whether each field was quoted (an empty quoted field is an empty string, not a missing one)
+       * @param count Receives the number of fields in the record
+       * @return false at end of input
+       */
+      bool next(std::vector<std::string> &fields, std::vector<bool> &quoted, std::size_t &count)
+      {
+        using Traits = std::streambuf::traits_type;
+        count = 0;
+        if (Traits::eq_int_type(buffer->sgetc(), Traits::eof()))
+        {
+          return false;
+        }
+
+        for (;;)
+        {
+          if (fields.size() <= count)
+          {
+            fields.emplace_back();
+            quoted.push_back(false);
+          }
+          std::string &field = fields[count];
+          field.clear();
+          quoted[count] = false;
+          ++count;
+
+          int c = buffer->sbumpc();
+          if (c == '"')
+          {
+            quoted[count - 1] = true;
+            for (;;)
+            {
+              c = buffer->sbumpc();
+              if (Traits::eq_int_type(c, Traits::eof()))
+              {
+                throw std::runtime_error("CSV: unterminated quoted field at line " + std::to_string(line));
+              }
+              if (c == '"')
+              {
+                if (buffer->sgetc() != '"')
+                {
+                  break;
+                }
+                buffer->sbumpc();
+              }
+              else if (c == '\n')
+              {
+                ++line;
+              }
+              field.push_back(static_cast<char>(c));
+            }
+            c = buffer->sbumpc();
+          }
+          else
+          {
+            while (!Traits::eq_int_type(c, Traits::eof()) && c != ',' && c != '\n' && c != '\r')
+            {
+              field.push_back(static_cast<char>(c));
+              c = buffer->sbumpc();
+            }
+          }
+
+          if (c == ',')
+          {
+            continue;
+          }
+          if (c == '\r' && buffer->sgetc() == '\n')
+          {
+            buffer->sbumpc();
+          }
+          if (c == '\r' || c == '\n')
+          {
+            ++line;
+          }
+          else if (!Traits::eq_int_type(c, Traits::eof()))
+          {
+            throw std::runtime_error("CSV: unexpected character after quoted field at line " + std::to_string(line));
+          }
+          return true;
+        }
+      }
+    };
+
+    /**
+     * @brief Append @p text to @p out as a CSV field, quoting only when needed
+     */
+    inline void writeCsvField(std::ostream &out, std::string_view text, bool missing)
+    {
+      if (missing)
+      {
+        return;
+      }
+
+      bool quote = text.empty() || text.front() == ' ' || text.back() == ' ' ||
+                   text.find_first_of(",\"\r\n") != std::string_view::npos;
+      if (!quote)
+      {
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        return;
+      }
+
+      out.put('"');
+      for (char c : text)
+      {
+        if (c == '"')
+        {
+          out.put('"');
+        }
+        out.put(c);
+      }
+      out.put('"');
+    }
+
+    /**
+     * @brief Minimal pull tokenizer for the XML subset used by XLIFF files.
+     *
+     * Handles elements, attributes, character and entity references, CDATA sections,
+     * comments, processing instructions and DOCTYPE declarations. Namespace prefixes are
+     * stripped from element and attribute names.
+     */
+    struct XmlReader
+    {
+      enum class Kind
+      {
+        StartTag,
+        EndTag,
+        Text,
+        End
+      };
+
+    private:
+      std::streambuf *buffer;
+      bool pendingEnd = false;
+
+      using Traits = std::streambuf::traits_type;
+
+      int get()
+      {
+        int c = buffer->sbumpc();
+        if (Traits::eq_int_type(c, Traits::eof()))
+        {
+          throw std::runtime_error("XML: unexpected end of input");
+        }
+        return c;
+      }
+
+      /**
+       * @brief Consume exactly @p literal
+       *
+       * @throws std::runtime_error If the input continues with anything else
+       */
+      void expect(std::string_view literal, const char *what)
+      {
+        for (char c : literal)
+        {
+          if (get() != static_cast<unsigned char>(c))
+          {
+            throw std::runtime_error(std::string("XML: malformed ") + what);
+          }
+        }
+      }
+
+      /**
+       * @brief Consume input up to and including @p terminator, appending it to @p out when given
+       */
+      void readUntil(std::string_view terminator, std::string *out = nullptr)
+      {
+        std::string window;
+        while (window.size() < terminator.size() || window.compare(window.size() - terminator.size(), terminator.size(), terminator) != 0)
+        {
+          window.push_back(static_cast<char>(get()));
+          if (!out && window.size() > terminator.size())
+          {
+            window.erase(window.begin());
+          }
+        }
+        if (out)
+        {
+          out->append(window, 0, window.size() - terminator.size());
+        }
+      }
+
+      static void appendUtf8(std::string &out, unsigned long cp)
+      {
+        if (cp < 0x80)
+        {
+          out.push_back(static_cast<char>(cp));
+        }
+        else if (cp < 0x800)
+        {
+          out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+          out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+          out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+          out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+          out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+          out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+          out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+          out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+          out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+      }
+
+      /**
+       * @brief Code point of a character reference (`#123` or `#x7B`, without `&` and `;`)
+       *
+       * @throws std::runtime_error On missing or invalid digits, NUL, surrogates and values above U+10FFFF
+       */
+      static unsigned long parseCharReference(const std::string &name)
+      {
+        bool hex = name[1] == 'x' || name[1] == 'X';
+        std::size_t start = hex ? 2 : 1;
+        unsigned long cp = 0;
+        for (std::size_t i = start; i < name.size(); ++i)
+        {
+          char c = name[i];
+          unsigned long digit;
+          if (c >= '0' && c <= '9')
+            digit = static_cast<unsigned long>(c - '0');
+          else if (hex && c >= 'a' && c <= 'f')
+            digit = static_cast<unsigned long>(c - 'a' + 10);
+          else if (hex && c >= 'A' && c <= 'F')
+            digit = static_cast<unsigned long>(c - 'A' + 10);
+          else
+            throw std::runtime_error("XML: invalid character reference &" + name + ";");
+          // Stop accumulating once out of range so long digit runs cannot overflow.
+          cp = cp > 0x10FFFF ? cp : cp * (hex ? 16 : 10) + digit;
+        }
+        if (name.size() == start || cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        {
+          throw std::runtime_error("XML: invalid character reference &" + name + ";");
+        }
+        return cp;
+      }
+
+      void readEntity(std::string &out)
+      {
+        std::string name;
+        for (int c = get(); c != ';'; c = get())
+        {
+          if (name.size() > 10)
+          {
+            throw std::runtime_error("XML: malformed entity reference");
+          }
+          name.push_back(static_cast<char>(c));
+        }
+
+        if (name == "lt")
+          out.push_back('<');
+        else if (name == "gt")
+          out.push_back('>');
+        else if (name == "amp")
+          out.push_back('&');
+        else if (name == "quot")
+          out.push_back('"');
+        else if (name == "apos")
+          out.push_back('\'');
+        else if (!name.empty() && name[0] == '#')
+        {
+          appendUtf8(out, parseCharReference(name));
+        }
+        else
+        {
+          throw std::runtime_error("XML: unknown entity &" + name + ";");
+        }
+      }
+
+      static std::string localName(std::string name)
+      {
+        std::size_t colon = name.find(':');
+        return colon == std::string::npos ? name : name.substr(colon + 1);
+      }
+
+      static bool isSpace(int c)
+      {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+      }
+
+    public:
+      /**
+       * @brief Element name of the current StartTag/EndTag token
+       */
+      std::string name;
+
+      /**
+       * @brief Character data of the current Text token
+       */
+      std::string text;
+
+      /**
+       * @brief Attributes of the current StartTag token
+       */
+      std::vector<std::pair<std::string, std::string>> attributes;
+
+      explicit XmlReader(std::istream &in) : buffer(in.rdbuf()) {}
+
+      /**
+       * @brief Value of an attribute of the current start tag, or an empty string
+       */
+      std::string attribute(std::string_view key) const
+      {
+        for (const auto &[attrName, value] : attributes)
+        {
+          if (attrName == key)
+          {
+            return value;
+          }
+        }
+        return {};
+      }
+
+      /**
+       * @brief Advance to the next token
+       *
+       * Self-closing elements produce a StartTag immediately followed by an EndTag.
+       */
+      Kind next()
+      {
+        if (pendingEnd)
+        {
+          pendingEnd = false;
+          return Kind::EndTag;
+        }
+
+        text.clear();
+        for (;;)
+        {
+          int c = buffer->sgetc();
+          if (Traits::eq_int_type(c, Traits::eof()))
+          {
+            return text.empty() ? Kind::End : Kind::Text;
+          }
+
+          if (c != '<')
+          {
+            buffer->sbumpc();
+            if (c == '&')
+            {
+              readEntity(text);
+            }
+            else
+            {
+              text.push_back(static_cast<char>(c));
+            }
+            continue;
+          }
+
+          if (!text.empty())
+          {
+            return Kind::Text;
+          }
+
+          buffer->sbumpc();
+          c = get();
+          if (c == '?')
+          {
+            readUntil("?>");
+            continue;
+          }
+          if (c == '!')
+          {
+            if (buffer->sgetc() == '-')
+            {
+              readUntil("-->");
+            }
+            else if (buffer->sgetc() == '[')
+            {
+              expect("[CDATA[", "CDATA section");
+              readUntil("]]>", &text);
+              if (!text.empty())
+              {
+                return Kind::Text;
+              }
+            }
+            else
+            {
+              readUntil(">");
+            }
+            continue;
+          }
+
+          bool end = c == '/';
+          if (end)
+          {
+            c = get();
+          }
+
+          name.clear();
+          while (!isSpace(c) && c != '>' && c != '/')
+          {
+            name.push_back(static_cast<char>(c));
+            c = get();
+          }
+          name = localName(std::move(name));
+
+          if (end)
+          {
+            while (c != '>')
+            {
+              c = get();
+            }
+            return Kind::EndTag;
+          }
+
+          attributes.clear();
+          for (;;)
+          {
+            while (isSpace(c))
+            {
+              c = get();
+            }
+            if (c == '>')
+            {
+              return Kind::StartTag;
+            }
+            if (c == '/')
+            {
+              if (get() != '>')
+              {
+                throw std::runtime_error("XML: malformed empty element <" + name + ">");
+              }
+              pendingEnd = true;
+              return Kind::StartTag;
+            }
+
+            std::string attrName;
+            while (c != '=' && !isSpace(c))
+            {
+              attrName.push_back(static_cast<char>(c));
+              c = get();
+            }
+            while (c != '=')
+            {
+              c = get();
+            }
+            do
+            {
+              c = get();
+            } while (isSpace(c));
+            if (c != '"' && c != '\'')
+            {
+              throw std::runtime_error("XML: unquoted attribute value in <" + name + ">");
+            }
+
+            int quote = c;
+            std::string value;
+            for (c = get(); c != quote; c = get())
+            {
+              if (c == '&')
+              {
+                readEntity(value);
+              }
+              else
+              {
+                value.push_back(static_cast<char>(c));
+              }
+            }
+            attributes.emplace_back(localName(std::move(attrName)), std::move(value));
+            c = get();
+          }
+        }
+      }
+    };
+
+    /**
+     * @brief Append @p text to @p out with XML special characters escaped
+     *
+     * Tab, line feed and carriage return are written as character references so they survive
+     * attribute and line-end normalization. XML 1.0 cannot represent any other C0 control
+     * character, not even as a reference.
+     *
+     * @throws std::runtime_error If @p text contains a C0 control character other than those three
+     */
+    inline void writeXmlEscaped(std::ostream &out, std::string_view text)
+    {
+      std::size_t start = 0;
+      for (std::size_t i = 0; i < text.size(); ++i)
+      {
+        const char *entity = nullptr;
+        switch (text[i])
+        {
+        case '\t':
+          entity = "&#9;";
+          break;
+        case '\n':
+          entity = "&#10;";
+          break;
+        case '\r':
+          entity = "&#13;";
+          break;
+        case '<':
+          entity = "&lt;";
+          break;
+        case '>':
+          entity = "&gt;";
+          break;
+        case '&':
+          entity = "&amp;";
+          break;
+        case '"':
+          entity = "&quot;";
+          break;
+        default:
+          if (static_cast<unsigned char>(text[i]) < 0x20)
+          {
+            throw std::runtime_error("XML: control character " + std::to_string(static_cast<int>(text[i])) + " cannot be written");
+          }
+          continue;
+        }
+        out.write(text.data() + start, static_cast<std::streamsize>(i - start));
+        out << entity;
+        start = i + 1;
+      }
+      out.write(text.data() + start, static_cast<std::streamsize>(text.size() - start));
+    }
+  } // namespace detail
+
+  /**
+   * @brief Stream every translation in a CSV file to a callback
+   *
+   * The first record is the header: the first column holds key paths, every further column
+   * is named after a locale (e.g. `key,en,id`). Each following record yields one call per
+   * non-empty cell. An unquoted empty cell means "no translation"; a quoted empty cell
+   * (`""`) is an empty translation.
+   *
+   * @tparam Fn Callable as `fn(std::string_view locale, std::string_view key, std::string_view value)`
+   * @param in Input stream, opened in binary mode
+   * @param fn Receives each entry; views are only valid during the call
+   * @throws std::runtime_error On malformed CSV or records wider than the header
+   */
+  template <typename Fn>
+  void readCsv(std::istream &in, Fn &&fn)
+  {
+    detail::CsvReader reader(in);
+    std::vector<std::string> header;
+    std::vector<bool> headerQuoted;
+    std::size_t columns = 0;
+    if (!reader.next(header, headerQuoted, columns))
+    {
+      throw std::runtime_error("CSV: missing header row");
+    }
+    header.resize(columns);
+
+    std::vector<std::string> fields;
+    std::vector<bool> quoted;
+    std::size_t count = 0;
+    for (std::size_t line = reader.currentLine(); reader.next(fields, quoted, count); line = reader.currentLine())
+    {
+      if (count == 1 && fields[0].empty())
+      {
+        continue;
+      }
+      if (count > columns)
+      {
+        throw std::runtime_error("CSV: record at line " + std::to_string(line) + " has more fields than the header");
+      }
+      for (std::size_t i = 1; i < count; ++i)
+      {
+        if (quoted[i] || !fields[i].empty())
+        {
+          fn(std::string_view(header[i]), std::string_view(fields[0]), std::string_view(fields[i]));
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Import a CSV file (see readCsv()) straight into a catalog builder
+   *
+   * @param in Input stream, opened in binary mode
+   * @param builder Receives every entry
+   */
+  inline void importCsv(std::istream &in, CatalogBuilder &builder)
+  {
+    readCsv(in, [&](std::string_view locale, std::string_view key, std::string_view value)
+            { builder.add(locale, key, value); });
+  }
+
+  /**
+   * @brief Write a catalog as CSV, one record per key
+   *
+   * The header is `key` followed by every locale code. Missing cells are written as empty
+   * unquoted fields so the file round-trips through readCsv().
+   *
+   * @param catalog The catalog to export
+   * @param out Output stream, opened in binary mode
+   */
+  inline void exportCsv(const Catalog &catalog, std::ostream &out)
+  {
+    out << "key";
+    for (LocaleId locale = 0; locale < catalog.localeCount(); ++locale)
+    {
+      out.put(',');
+      detail::writeCsvField(out, catalog.localeCode(locale), false);
+    }
+    out << "\r\n";
+
+    for (KeyId key = 0; key < catalog.keyCount(); ++key)
+    {
+      detail::writeCsvField(out, catalog.keyName(key), false);
+      for (std::string_view value : catalog.row(key))
+      {
+        out.put(',');
+        detail::writeCsvField(out, value, Catalog::isMissing(value));
+      }
+      out << "\r\n";
+    }
+  }
+
+  /**
+   * @brief Stream every translation in an XLIFF 1.2 or 2.0 file to a callback
+   *
+   * Each `<trans-unit>` (1.2) or `<unit>` (2.0) yields its `<target>` under the file's
+   * target language and, when @p includeSource is set, its `<source>` under the source
+   * language. Keys come from the `resname` (1.2) or `name` (2.0) attribute, falling back to
+   * `id`. Inline markup inside source/target is dropped and only its text is kept.
+   *
+   * @tparam Fn Callable as `fn(std::string_view locale, std::string_view key, std::string_view value)`
+   * @param in Input stream, opened in binary mode
+   * @param fn Receives each entry; views are only valid during the call
+   * @param includeSource Also report source-language text
+   * @throws std::runtime_error On malformed XML or units outside a language-tagged file
+   */
+  template <typename Fn>
+  void readXliff(std::istream &in, Fn &&fn, bool includeSource = true)
+  {
+    using Kind = detail::XmlReader::Kind;
+    enum class Capture
+    {
+      None,
+      Source,
+      Target
+    };
+
+    detail::XmlReader reader(in);
+    std::string sourceLanguage;
+    std::string targetLanguage;
+    std::string key;
+    std::string source;
+    std::string target;
+    bool inUnit = false;
+    bool hasSource = false;
+    bool hasTarget = false;
+    Capture capture = Capture::None;
+
+    for (Kind kind = reader.next(); kind != Kind::End; kind = reader.next())
+    {
+      if (kind == Kind::Text)
+      {
+        if (capture == Capture::Source)
+        {
+          source += reader.text;
+        }
+        else if (capture == Capture::Target)
+        {
+          target += reader.text;
+        }
+        continue;
+      }
+
+      const std::string &name = reader.name;
+      if (kind == Kind::StartTag)
+      {
+        if (name == "xliff" || name == "file")
+        {
+          std::string src = reader.attribute(name == "xliff" ? "srcLang" : "source-language");
+          std::string trg = reader.attribute(name == "xliff" ? "trgLang" : "target-language");
+          sourceLanguage = src.empty() ? sourceLanguage : src;
+          targetLanguage = trg.empty() ? targetLanguage : trg;
+        }
+        else if (name == "trans-unit" || name == "unit")
+        {
+          key = reader.attribute(name == "unit" ? "name" : "resname");
+          if (key.empty())
+          {
+            key = reader.attribute("id");
+          }
+          source.clear();
+          target.clear();
+          inUnit = true;
+          hasSource = hasTarget = false;
+        }
+        else if (inUnit && capture == Capture::None && name == "source")
+        {
+          capture = Capture::Source;
+          hasSource = true;
+        }
+        else if (inUnit && capture == Capture::None && name == "target")
+        {
+          capture = Capture::Target;
+          hasTarget = true;
+        }
+        continue;
+      }
+
+      if ((name == "source" && capture == Capture::Source) || (name == "target" && capture == Capture::Target))
+      {
+        capture = Capture::None;
+      }
+      else if (inUnit && (name == "trans-unit" || name == "unit"))
+      {
+        inUnit = false;
+        if (key.empty())
+        {
+          throw std::runtime_error("XLIFF: unit without id");
+        }
+        if (includeSource && hasSource)
+        {
+          if (sourceLanguage.empty())
+          {
+            throw std::runtime_error("XLIFF: unit '" + key + "' has no source language");
+          }
+          fn(std::string_view(sourceLanguage), std::string_view(key), std::string_view(source));
+        }
+        if (hasTarget)
+        {
+          if (targetLanguage.empty())
+          {
+            throw std::runtime_error("XLIFF: unit '" + key + "' has no target language");
+          }
+          fn(std::string_view(targetLanguage), std::string_view(key), std::string_view(target));
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Import an XLIFF file (see readXliff()) straight into a catalog builder
+   *
+   * @param in Input stream, opened in binary mode
+   * @param builder Receives every entry
+   * @param includeSource Also import source-language text
+   */
+  inline void importXliff(std::istream &in, CatalogBuilder &builder, bool includeSource = true)
+  {
+    readXliff(in, [&](std::string_view locale, std::string_view key, std::string_view value)
+              { builder.add(locale, key, value); },
+              includeSource);
+  }
+
+  /**
+   * @brief Write one source/target locale pair of a catalog as an XLIFF 1.2 file
+   *
+   * Every key with a source text becomes a `<trans-unit>` whose `id` and `resname` are the
+   * key path; its `<target>` is omitted when the target locale has no translation yet.
+   *
+   * @param catalog The catalog to export
+   * @param out Output stream, opened in binary mode
+   * @param sourceLocale Locale code of the source text (e.g., "en")
+   * @param targetLocale Locale code of the translations (e.g., "id")
+   * @throws std::runtime_error If either locale is not in the catalog, or a text holds a
+   *         control character XML cannot represent
+   */
+  inline void exportXliff(const Catalog &catalog, std::ostream &out, std::string_view sourceLocale, std::string_view targetLocale)
+  {
+    LocaleId source = catalog.findLocale(sourceLocale);
+    LocaleId target = catalog.findLocale(targetLocale);
+    if (source == invalidLocale || target == invalidLocale)
+    {
+      throw std::runtime_error("Locale not found: " + std::string(source == invalidLocale ? sourceLocale : targetLocale));
+    }
+
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<xliff version=\"1.2\" xmlns=\"urn:oasis:names:tc:xliff:document:1.2\">\n"
+        << "  <file source-language=\"";
+    detail::writeXmlEscaped(out, sourceLocale);
+    out << "\" target-language=\"";
+    detail::writeXmlEscaped(out, targetLocale);
+    out << "\" datatype=\"plaintext\" original=\"catalog\">\n"
+        << "    <body>\n";
+
+    for (KeyId key = 0; key < catalog.keyCount(); ++key)
+    {
+      std::string_view sourceText = catalog.get(key, source);
+      if (Catalog::isMissing(sourceText))
+      {
+        continue;
+      }
+
+      out << "      <trans-unit id=\"";
+      detail::writeXmlEscaped(out, catalog.keyName(key));
+      out << "\" resname=\"";
+      detail::writeXmlEscaped(out, catalog.keyName(key));
+      out << "\">\n        <source>";
+      detail::writeXmlEscaped(out, sourceText);
+      out << "</source>\n";
+
+      std::string_view targetText = catalog.get(key, target);
+      if (!Catalog::isMissing(targetText))
+      {
+        out << "        <target>";
+        detail::writeXmlEscaped(out, targetText);
+        out << "</target>\n";
+      }
+      out << "      </trans-unit>\n";
+    }
+
+    out << "    </body>\n"
+        << "  </file>\n"
+        << "</xliff>\n";
+  }
+} // namespace i18n
+
+#endif // I18N_EXCHANGE_HPP
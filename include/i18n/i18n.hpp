@@ -2,276 +2,668 @@
 #define I18N_HPP
 
 #include "core.hpp"
+#include "load_stats.hpp"
+#include "mo.hpp"
+#include "policies.hpp"
+#include "trace.hpp"
 #include <iostream>
-#include <sstream>
+#include <future>
+#include <memory>
+#include <memory_resource>
 #include <fstream>
+#include <type_traits>
+#include <utility>
 
-/**
- * @brief Internationalization (i18n) struct for managing translations.
- *
- * This struct utilizes the nlohmann::json library to handle translation data.
- * It supports multiple locales and provides methods for loading and accessing translations.
- *
- * Example usage:
- * @code{.cpp}
- * #include <nlohmann/json.hpp>
- * #include <i18n/i18n.hpp>
- *
- * // Create translations JSON
- * nlohmann::json json = {
- *   {"en", {{"greeting", "Hello"}}},
- *   {"id", {{"greeting", "Halo"}}}
- * };
- *
- * // Initialize with JSON object
- * I18n i18n(json);
- *
- * // Or initialize from file
- * I18n i18n_from_file("path/to/translations.json");
- *
- * // Get translation in English
- * std::string greeting_en = i18n.t("greeting", "en");
- * std::cout << greeting_en << std::endl; // Output: Hello
- * 
- * // Get translation in Indonesian
- * std::string greeting_id = i18n.t("greeting", "id");
- * std::cout << greeting_id << std::endl; // Output: Halo
- * @endcode
- */
-struct I18n
+namespace i18n
 {
-private:
-  /**
-   * @brief JSON object containing all translation data organized by locale
-   */
-  nlohmann::json translations;
-  
-  /**
-   * @brief List of available locale codes
-   */
-  std::vector<std::string> locales;
-
   /**
-   * @brief Resolve a dot-separated path in a nlohmann::json object.
+   * @brief Internationalization (i18n) struct for managing translations, configured by policies.
    *
-   * This function navigates through a JSON object using a dot-separated path
-   * and returns a pointer to the corresponding JSON value. If the path does not
-   * exist, it returns nullptr.
+   * Each aspect of lookup that used to be fixed is a template parameter:
+   * - @p StoragePolicy holds the translation data and resolves paths (JsonStorage)
+   * - @p FallbackPolicy selects the fallback locale and the "not found" text (EnglishFallback, NoFallback)
+   * - @p DiagnosticsPolicy reports paths that exist in only one locale (StderrDiagnostics, NoDiagnostics)
+   * - @p ThreadingPolicy guards the storage against concurrent modification (SingleThreaded, SharedSnapshot)
    *
-   * @param source The source JSON object to navigate.
-   * @param path The dot-separated path to resolve (e.g., "user.name.first").
-   * @return A pointer to the resolved JSON value, or nullptr if the path does not exist.
+   * Disabled policies are removed with `if constexpr`, so e.g. `basic_i18n<JsonStorage, NoFallback,
+   * NoDiagnostics>` compiles down to a single path resolution per lookup. `I18n` is the
+   * configuration with the original behaviour.
+   *
+   * @tparam StoragePolicy See BasicJsonStorage for the required interface
+   * @tparam FallbackPolicy See EnglishFallback
+   * @tparam DiagnosticsPolicy See StderrDiagnostics
+   * @tparam ThreadingPolicy See SingleThreaded
    */
-  const nlohmann::json *resolvePath(const nlohmann::json &source, const std::string &path)
+  template <typename StoragePolicy = JsonStorage,
+            typename FallbackPolicy = EnglishFallback,
+            typename DiagnosticsPolicy = StderrDiagnostics,
+            typename ThreadingPolicy = SingleThreaded>
+  struct basic_i18n
   {
-    const nlohmann::json *current = &source;
-    std::stringstream ss(path);
-    std::string segment;
+  public:
+    using storage_type = StoragePolicy;
+    using json_type = typename StoragePolicy::json_type;
+
+  private:
+    using holder_type = typename ThreadingPolicy::template holder<StoragePolicy>;
+
+    /**
+     * @brief The translation data, owned according to the threading policy
+     */
+    holder_type storage;
 
-    while (std::getline(ss, segment, '.'))
+    /**
+     * @brief Check if content is available in other locales.
+     *
+     * This function checks if a given path has non-null content in any locale
+     * other than the specified current language.
+     *
+     * @param data The storage snapshot to search.
+     * @param path The dot-separated path to check (e.g., "user.name.first").
+     * @param currentLang The current language code to exclude from the check (e.g., "en").
+     * @return true if content is available in other locales, false otherwise.
+     */
+    static bool isContentAvailableInOtherLocales(const StoragePolicy &data, std::string_view path, std::string_view currentLang)
     {
-      if (!current->is_object() || !current->contains(segment))
+      for (const auto &locale : data.locales())
       {
-        return nullptr;
+        if (locale != currentLang && (data.find(locale, path) || (data.hasMo() && data.findMo(locale, path))))
+        {
+          return true;
+        }
       }
-      current = &((*current)[segment]);
+      return false;
     }
 
-    return current;
-  }
-
-  /**
-   * @brief Check if content is available in other locales.
-   *
-   * This function checks if a given path has non-null content in any locale
-   * other than the specified current language.
-   *
-   * @param path The dot-separated path to check (e.g., "user.name.first").
-   * @param currentLang The current language code to exclude from the check (e.g., "en").
-   * @return true if content is available in other locales, false otherwise.
-   */
-  bool isContentAvailableInOtherLocales(const std::string &path, const std::string &currentLang)
-  {
-    for (const auto &locale : locales)
+    /**
+     * @brief Read and parse a translation file.
+     *
+     * @param filePath Path to the JSON file.
+     * @param resource Memory resource for the storage's bookkeeping.
+     * @param stats Receives the "open", "size check" and "parse" phases, if not nullptr.
+     * @return Storage holding the parsed translation data.
+     * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+     */
+    static StoragePolicy readFile(const std::string &filePath, std::pmr::memory_resource *resource, LoadStats *stats = nullptr)
     {
-      if (locale != currentLang)
+      std::ifstream ifs;
       {
-        const nlohmann::json *node = resolvePath(translations[locale], path);
-        if (node && !node->is_null())
+        detail::PhaseTimer timer(stats, "open");
+        ifs.open(filePath);
+      }
+      if (!ifs.is_open())
+      {
+        throw std::runtime_error("Could not open file: " + filePath);
+      }
+
+      std::size_t size = 0;
+      {
+        detail::PhaseTimer timer(stats, "size check");
+
+        // if file is empty, throw error
+        if (ifs.peek() == std::ifstream::traits_type::eof())
         {
-          return true;
+          throw std::runtime_error("File is empty: " + filePath);
+        }
+
+        // if file size is 0, throw error
+        ifs.seekg(0, std::ios::end);
+        std::streamoff end = ifs.tellg();
+        if (end == 0)
+        {
+          throw std::runtime_error("File is empty: " + filePath);
         }
+        ifs.seekg(0, std::ios::beg);
+        size = end > 0 ? static_cast<std::size_t>(end) : 0;
+        timer.bytes = size;
       }
-    }
-    return false;
-  }
 
-public:
-  /**
-   * @brief Default construct a new I18n object
-   */
-  I18n() = default;
+      // if file is not valid json, throw error
+      try
+      {
+        detail::PhaseTimer timer(stats, "parse");
+        timer.bytes = size;
+        return makeStorage(ifs, resource, stats);
+      }
+      catch (const typename json_type::parse_error &e)
+      {
+        throw std::runtime_error("Invalid JSON in file: " + filePath + "\n" + e.what());
+      }
+    }
 
-  /**
-   * @brief Construct a new I18n object from a file path
-   * 
-   * Loads translation data from a JSON file. The file must contain a valid JSON object
-   * with locale codes as keys and translation objects as values.
-   * 
-   * @param filePath Path to the JSON file containing translations
-   * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
-   */
-  I18n(const std::string &filePath)
-  {
-    std::ifstream ifs(filePath);
-    if (!ifs.is_open())
+    /**
+     * @brief Construct the storage from @p source, passing @p stats on if the storage accepts it.
+     */
+    template <typename Source>
+    static StoragePolicy makeStorage(Source &source, std::pmr::memory_resource *resource, LoadStats *stats)
     {
-      throw std::runtime_error("Could not open file: " + filePath);
+      if constexpr (std::is_constructible_v<StoragePolicy, Source &, std::pmr::memory_resource *, LoadStats *>)
+      {
+        return StoragePolicy(source, resource, stats);
+      }
+      else
+      {
+        return StoragePolicy(source, resource);
+      }
     }
 
-    // if file is empty, throw error
-    if (ifs.peek() == std::ifstream::traits_type::eof())
+    /**
+     * @brief Check that translation data is a non-empty object.
+     *
+     * @param json The translation data.
+     * @return The same object.
+     * @throws std::runtime_error If the JSON is not an object or is empty
+     */
+    static const json_type &validate(const json_type &json)
     {
-      throw std::runtime_error("File is empty: " + filePath);
+      // if json is not an object, throw error
+      if (!json.is_object())
+      {
+        throw std::runtime_error("JSON must be an object");
+      }
+
+      // if json is empty, throw error
+      if (json.empty())
+      {
+        throw std::runtime_error("JSON object is empty");
+      }
+
+      return json;
     }
 
-    // if file size is 0, throw error
-    ifs.seekg(0, std::ios::end);
-    if (ifs.tellg() == 0)
+    /**
+     * @brief Check that translation data is a non-empty object, passing it on for a move.
+     */
+    static json_type &&validate(json_type &&json)
     {
-      throw std::runtime_error("File is empty: " + filePath);
+      validate(static_cast<const json_type &>(json));
+      return std::move(json);
     }
 
-    // if file is not valid json, throw error
-    try
+    /**
+     * @brief Validate and copy a JSON object into new storage, timing both steps.
+     */
+    static StoragePolicy copyJson(const json_type &json, std::pmr::memory_resource *resource, LoadStats &stats)
     {
-      nlohmann::json j = nlohmann::json::parse(ifs);
-      translations = j;
-      for (auto &[key, value] : j.items())
       {
-        locales.push_back(key);
+        detail::PhaseTimer timer(&stats, "validate");
+        validate(json);
       }
+      detail::PhaseTimer timer(&stats, "copy");
+      return makeStorage(json, resource, &stats);
     }
-    catch (const nlohmann::json::parse_error &e)
+
+    /**
+     * @brief Find the text of a path in one locale: a JSON string, else a gettext translation.
+     */
+    static std::optional<std::string_view> findText(const StoragePolicy &data, std::string_view path, std::string_view locale)
     {
-      throw std::runtime_error("Invalid JSON in file: " + filePath + "\n" + e.what());
+      if (const json_type *node = data.find(locale, path))
+      {
+        if (node->is_string())
+        {
+          return std::string_view(node->template get_ref<const typename json_type::string_t &>());
+        }
+        return std::nullopt;
+      }
+      return data.hasMo() ? data.findMo(locale, path) : std::nullopt;
     }
-  }
 
-  /**
-   * @brief Construct a new I18n object from a nlohmann::json object
-   * 
-   * Initializes the I18n system with pre-loaded translation data. The JSON object must
-   * have locale codes as keys (e.g., "en", "id") and translation objects as values.
-   * 
-   * @param json A JSON object containing translation data organized by locale
-   * @throws std::runtime_error If the JSON is not an object or is empty
-   */
-  I18n(const nlohmann::json &json)
-  {
-    // if json is not an object, throw error
-    if (!json.is_object())
+  public:
+    /**
+     * @brief Default construct a new I18n object
+     */
+    basic_i18n() = default;
+
+    /**
+     * @brief Construct a new I18n object from a file path
+     *
+     * Loads translation data from a JSON file. The file must contain a valid JSON object
+     * with locale codes as keys and translation objects as values.
+     *
+     * @param filePath Path to the JSON file containing translations
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+     */
+    basic_i18n(const std::string &filePath, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : storage(readFile(filePath, resource)) {}
+
+    /**
+     * @brief Construct a new I18n object from a file path given as a string literal
+     *
+     * @param filePath Path to the JSON file containing translations
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+     */
+    basic_i18n(const char *filePath, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : basic_i18n(std::string(filePath), resource) {}
+
+    /**
+     * @brief Construct a new I18n object from a JSON object
+     *
+     * Initializes the I18n system with pre-loaded translation data. The JSON object must
+     * have locale codes as keys (e.g., "en", "id") and translation objects as values.
+     *
+     * @param json A JSON object containing translation data organized by locale
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the JSON is not an object or is empty
+     */
+    basic_i18n(const json_type &json, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : storage(StoragePolicy(validate(json), resource)) {}
+
+    /**
+     * @brief Construct a new I18n object from a JSON object, taking over its data
+     *
+     * The tree is moved into storage that accepts it by rvalue, and copied otherwise.
+     *
+     * @param json A JSON object containing translation data organized by locale
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the JSON is not an object or is empty
+     */
+    basic_i18n(json_type &&json, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : storage(StoragePolicy(validate(std::move(json)), resource)) {}
+
+    /**
+     * @brief Construct a new I18n object from a file path, recording where the time goes
+     *
+     * @param filePath Path to the JSON file containing translations
+     * @param stats Receives the phases of the load (see LoadStats)
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+     */
+    basic_i18n(const std::string &filePath, LoadStats &stats, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : storage(readFile(filePath, resource, &stats)) {}
+
+    /**
+     * @brief Construct a new I18n object from a file path given as a string literal, recording where the time goes
+     *
+     * @param filePath Path to the JSON file containing translations
+     * @param stats Receives the phases of the load (see LoadStats)
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+     */
+    basic_i18n(const char *filePath, LoadStats &stats, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : basic_i18n(std::string(filePath), stats, resource) {}
+
+    /**
+     * @brief Construct a new I18n object from a JSON object, recording where the time goes
+     *
+     * @param json A JSON object containing translation data organized by locale
+     * @param stats Receives the "validate" and "copy" phases (see LoadStats)
+     * @param resource Memory resource for the storage's long-lived bookkeeping (locale list, gettext registry)
+     * @throws std::runtime_error If the JSON is not an object or is empty
+     */
+    basic_i18n(const json_type &json, LoadStats &stats, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : storage(copyJson(json, resource, stats)) {}
+
+    /**
+     * @brief Destroy the I18n object
+     */
+    ~basic_i18n() = default;
+
+    /**
+     * @brief Copy and move operations
+     *
+     * Moving transfers the translation tree without copying it, so pointers into the data
+     * returned by getTranslations() stay valid in the moved-to object.
+     */
+    basic_i18n(const basic_i18n &) = default;
+    basic_i18n(basic_i18n &&) noexcept = default;
+    basic_i18n &operator=(const basic_i18n &) = default;
+    basic_i18n &operator=(basic_i18n &&) noexcept = default;
+
+    /**
+     * @brief Get the raw translation data
+     *
+     * Gives read-only access to the loaded JSON tree, organized by locale. Intended for
+     * tooling that needs to walk every entry (statistics, linting, export).
+     *
+     * @return const json_type& The translation data
+     * @note With a concurrent threading policy the reference stays valid only until the next
+     *       modification of this object
+     */
+    const json_type &getTranslations() const
     {
-      throw std::runtime_error("JSON must be an object");
+      return storage.snapshot()->tree();
     }
 
-    // if json is empty, throw error
-    if (json.empty())
+    /**
+     * @brief Get the list of available locale codes
+     *
+     * @return const std::pmr::vector<std::pmr::string>& Locale codes in the order they appear in the source data
+     * @note With a concurrent threading policy the reference stays valid only until the next
+     *       modification of this object
+     */
+    const std::pmr::vector<std::pmr::string> &getLocales() const
     {
-      throw std::runtime_error("JSON object is empty");
+      return storage.snapshot()->locales();
     }
 
-    translations = json;
-    for (auto &[key, value] : json.items())
+    /**
+     * @brief Replace all translation data with the contents of a JSON file
+     *
+     * The file is parsed before anything is replaced, so on failure the current data stays
+     * in place. Gettext catalogs loaded with loadMo() are dropped with the old data.
+     *
+     * @param filePath Path to the JSON file containing translations
+     * @param resource Memory resource for the new storage's long-lived bookkeeping
+     * @param stats Receives the phases of the load, ending with "publish", if not nullptr
+     * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+     */
+    void load(const std::string &filePath, std::pmr::memory_resource *resource = std::pmr::get_default_resource(), LoadStats *stats = nullptr)
     {
-      locales.push_back(key);
+      I18N_PROBE1(reload__begin, filePath.c_str());
+      try
+      {
+        StoragePolicy next = readFile(filePath, resource, stats);
+        detail::PhaseTimer timer(stats, "publish");
+        storage.replace(std::move(next));
+      }
+      catch (...)
+      {
+        I18N_PROBE2(reload__end, filePath.c_str(), 0);
+        throw;
+      }
+      I18N_PROBE2(reload__end, filePath.c_str(), 1);
     }
-  }
-
-  /**
-   * @brief Destroy the I18n object
-   */
-  ~I18n() = default;
-
-  /**
-   * @brief Get a translation value with type conversion
-   * 
-   * Retrieves a translated value from the translation data for the specified path and language code.
-   * If the requested translation is not found or is null, it falls back to the English ("en") translation.
-   * If no valid translation is found, returns the provided default value.
-   * 
-   * @tparam T The type to convert the translation value to (e.g., std::string, int, bool)
-   * @param path The dot-separated path to the translation key (e.g., "user.greeting")
-   * @param langCode The language code to retrieve the translation for (e.g., "en", "id")
-   * @param defaultValue The value to return if no translation is found
-   * @return T The translated value cast to type T, or the default value if not found
-   * 
-   * @note Prints a warning to stderr if content is not available in any locale except the current one
-   * @note Falls back to English ("en") if the requested language is not found
-   */
-  template <typename T>
-  T get(const std::string &path, std::string langCode, T defaultValue)
-  {
-    const nlohmann::json *node = nullptr;
-    const nlohmann::json *fallback = nullptr;
 
-    if (translations.contains(langCode))
+    /**
+     * @brief Load a JSON file on a background thread and switch to it once it is parsed
+     *
+     * The work of load() (reading, parsing and validating the file) runs on a new thread.
+     * Until it finishes, lookups keep answering from the current data: the defaults of an
+     * empty object, or a small bootstrap catalog it was constructed with. The parsed data is
+     * then published in one atomic step, so each lookup sees either the old or the new data.
+     * Requires a concurrent ThreadingPolicy (SharedSnapshot).
+     *
+     * Example usage:
+     * @code{.cpp}
+     * using SharedI18n = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback,
+     *                                     i18n::StderrDiagnostics, i18n::SharedSnapshot>;
+     *
+     * SharedI18n i18n(bootstrap);                  // a few strings embedded in the binary
+     * auto ready = i18n.load_async("translations.json");
+     * startHealthChecks(i18n);                     // answered from the bootstrap data meanwhile
+     * ready.get();                                 // rethrows if the file could not be loaded
+     * @endcode
+     *
+     * @param filePath Path to the JSON file containing translations
+     * @param resource Memory resource for the new storage's long-lived bookkeeping
+     * @param stats Receives the phases of the load, if not nullptr; read it only after the
+     *              future is ready
+     * @return std::future<void> Ready once the new data is in use; holds the exception of a
+     *         failed load, in which case the current data stays in place
+     * @note Like any std::async future, the result waits for the load when it is destroyed;
+     *       keep it no longer than this object, and do not discard it if the call must not block
+     */
+    std::future<void> load_async(std::string filePath, std::pmr::memory_resource *resource = std::pmr::get_default_resource(), LoadStats *stats = nullptr)
     {
-      node = resolvePath(translations[langCode], path);
+      static_assert(ThreadingPolicy::concurrent, "load_async() requires a concurrent ThreadingPolicy such as SharedSnapshot");
+      return std::async(std::launch::async, [this, filePath = std::move(filePath), resource, stats]()
+                        { load(filePath, resource, stats); });
     }
 
-    if (!isContentAvailableInOtherLocales(path, langCode))
+    /**
+     * @brief Load the translations of one locale from its own JSON file (a shard)
+     *
+     * Large deployments can ship one file per locale and fetch each on first demand. The
+     * file holds the locale's translation object, e.g. `{"greeting": "Hallo"}`; it replaces
+     * any translations the locale already had and leaves the other locales untouched.
+     *
+     * @param langCode The language code the file provides (e.g., "de")
+     * @param filePath Path to the JSON file
+     * @throws std::runtime_error If the file cannot be opened, is empty, or is not a non-empty JSON object
+     */
+    void loadShard(const std::string &langCode, const std::string &filePath)
     {
-      std::cerr << "Warning: Content for path '" << path << "' is not available in any locale except '" << langCode << "'." << std::endl;
+      I18N_PROBE2(shard__load, langCode.c_str(), filePath.c_str());
+      StoragePolicy shard = readFile(filePath, std::pmr::get_default_resource());
+      validate(shard.tree());
+      storage.update([&](StoragePolicy &data)
+                     { data.setLocale(langCode, shard.tree()); });
     }
 
-    if (langCode != "en" && translations.contains("en"))
+    /**
+     * @brief Load a gettext `.mo` catalog for a locale
+     *
+     * The file is memory-mapped and queried in place through its hash table, so loading is
+     * cheap regardless of catalog size. Lookups use the msgid as the path; JSON translations
+     * of the same locale take precedence. Loading a second catalog for the same locale
+     * replaces the first.
+     *
+     * @param langCode The language code the catalog provides (e.g., "ru")
+     * @param filePath Path to the compiled `.mo` file
+     * @throws std::runtime_error If the file cannot be mapped or is not a valid `.mo` file
+     */
+    void loadMo(const std::string &langCode, const std::string &filePath)
     {
-      fallback = resolvePath(translations["en"], path);
+      auto catalog = std::make_shared<const MoCatalog>(filePath);
+      storage.update([&](StoragePolicy &data)
+                     { data.addMo(langCode, std::move(catalog)); });
     }
 
-    const nlohmann::json *target = node && !node->is_null() ? node : fallback;
-    if (!target || target->is_null())
+    /**
+     * @brief Get a translation value with type conversion
+     *
+     * Retrieves a translated value from the translation data for the specified path and language code.
+     * If the requested translation is not found or is null, it falls back to the English ("en") translation.
+     * If no valid translation is found, returns the provided default value.
+     *
+     * @tparam T The type to convert the translation value to (e.g., std::string, int, bool)
+     * @param path The dot-separated path to the translation key (e.g., "messages.welcome")
+     * @param langCode The language code to retrieve the translation for (e.g., "en", "id")
+     * @param defaultValue The value to return if no translation is found
+     * @return T The translated value cast to type T, or the default value if not found
+     *
+     * @note Prints a warning to stderr if content is not available in any locale except the current one
+     * @note Falls back to English ("en") if the requested language is not found
+     * @note For string-like T, gettext catalogs added with loadMo() are searched after the JSON
+     *       data of the same locale, with @p path used as the msgid
+     * @note The warning and the fallback follow DiagnosticsPolicy and FallbackPolicy
+     */
+    template <typename T>
+    T get(const std::string &path, std::string langCode, T defaultValue) const
     {
+      I18N_PROBE2(get__entry, path.c_str(), langCode.c_str());
+      const auto data = storage.snapshot();
+      const json_type *node = data->find(langCode, path);
+
+      if constexpr (DiagnosticsPolicy::enabled)
+      {
+        if (!isContentAvailableInOtherLocales(*data, path, langCode))
+        {
+          DiagnosticsPolicy::contentOnlyIn(path, langCode);
+        }
+      }
+
+      // gettext catalogs hold strings only; they answer after the JSON data of the same locale
+      constexpr bool fromMo = std::is_constructible_v<T, std::string_view>;
+      if constexpr (fromMo)
+      {
+        if (!node && data->hasMo())
+        {
+          if (auto text = data->findMo(langCode, path))
+          {
+            I18N_PROBE3(get__return, path.c_str(), langCode.c_str(), 1);
+            return T(*text);
+          }
+        }
+      }
+
+      if constexpr (FallbackPolicy::enabled)
+      {
+        if (!node && langCode != FallbackPolicy::locale)
+        {
+          I18N_PROBE2(fallback, path.c_str(), FallbackPolicy::locale);
+          node = data->find(FallbackPolicy::locale, path);
+          if constexpr (fromMo)
+          {
+            if (!node && data->hasMo())
+            {
+              if (auto text = data->findMo(FallbackPolicy::locale, path))
+              {
+                I18N_PROBE3(get__return, path.c_str(), langCode.c_str(), 1);
+                return T(*text);
+              }
+            }
+          }
+        }
+      }
+
+      if (node)
+      {
+        try
+        {
+          T value = node->template get<T>();
+          I18N_PROBE3(get__return, path.c_str(), langCode.c_str(), 1);
+          return value;
+        }
+        catch (const typename json_type::exception &)
+        {
+        }
+      }
+
+      I18N_PROBE2(default, path.c_str(), langCode.c_str());
+      I18N_PROBE3(get__return, path.c_str(), langCode.c_str(), 0);
       return defaultValue;
     }
 
-    try
+    /**
+     * @brief Translate a key to a value (shorthand method)
+     *
+     * This is a convenience method that wraps the `get()` method with a more intuitive name
+     * for translation operations. It retrieves a translated value for the specified path and language.
+     * Automatically provides a default "Content not found" message for string types when no default is specified.
+     *
+     * @param path The dot-separated path to the translation key (e.g., "messages.welcome")
+     * @param langCode The language code (defaults to "en")
+     * @param defaultValue The fallback value if translation is not found (defaults to T{}, or "Content not found" for strings)
+     * @return T The translated value, or the default value if not found
+     *
+     * @note For string types, if no default value is provided, returns FallbackPolicy::notFound
+     *       ("Content not found" by default) instead of an empty string
+     * @note A memory resource pointer as third argument selects the std::pmr::string overload
+     */
+    template <typename T = std::string, typename = std::enable_if_t<!std::is_convertible_v<T, std::pmr::memory_resource *>>>
+    T t(const std::string &path, std::string langCode = "en", T defaultValue = T{}) const
     {
-      return target->get<T>();
+      if constexpr (std::is_same_v<T, std::string>)
+      {
+        if (defaultValue.empty())
+        {
+          defaultValue = FallbackPolicy::notFound;
+        }
+      }
+      return get<T>(path, langCode, defaultValue);
     }
-    catch (const nlohmann::json::exception &)
+
+    /**
+     * @brief Translate a key into a string allocated from a caller-supplied memory resource
+     *
+     * Intended for request handlers that allocate from a per-request arena: the lookup
+     * itself does not allocate, and the only allocation is the returned string, made from
+     * @p resource. Follows the same locale, gettext and fallback order as get().
+     *
+     * @param path The dot-separated path to the translation key (e.g., "messages.welcome")
+     * @param langCode The language code (e.g., "en")
+     * @param resource The memory resource for the result (e.g., a std::pmr::monotonic_buffer_resource)
+     * @return std::pmr::string The first string translation found, or FallbackPolicy::notFound
+     */
+    std::pmr::string t(std::string_view path, std::string_view langCode, std::pmr::memory_resource *resource) const
     {
-      return defaultValue;
+      const auto data = storage.snapshot();
+
+      if constexpr (DiagnosticsPolicy::enabled)
+      {
+        if (!isContentAvailableInOtherLocales(*data, path, langCode))
+        {
+          DiagnosticsPolicy::contentOnlyIn(path, langCode);
+        }
+      }
+
+      std::optional<std::string_view> text = findText(*data, path, langCode);
+      if constexpr (FallbackPolicy::enabled)
+      {
+        if (!text && langCode != FallbackPolicy::locale)
+        {
+          text = findText(*data, path, FallbackPolicy::locale);
+        }
+      }
+      return std::pmr::string(text ? *text : std::string_view(FallbackPolicy::notFound), resource);
     }
-  }
 
-  /**
-   * @brief Translate a key to a value (shorthand method)
-   * 
-   * This is a convenience method that wraps the `get()` method with a more intuitive name
-   * for translation operations. It retrieves a translated value for the specified path and language.
-   * Automatically provides a default "Content not found" message for string types when no default is specified.
-   * 
-   * @param path The dot-separated path to the translation key (e.g., "messages.welcome")
-   * @param langCode The language code (defaults to "en")
-   * @param defaultValue The fallback value if translation is not found (defaults to T{}, or "Content not found" for strings)
-   * @return T The translated value, or the default value if not found
-   * 
-   * @note For string types, if no default value is provided, returns "Content not found" instead of an empty string
-   */
-  template <typename T = std::string>
-  T t(const std::string &path, std::string langCode = "en", T defaultValue = T{})
-  {
-    if constexpr (std::is_same_v<T, std::string>)
+    /**
+     * @brief Translate a message with plural forms (ngettext)
+     *
+     * Selects the plural form for @p n using the Plural-Forms rule of the gettext catalog
+     * loaded for @p langCode, then for the fallback locale. Messages without a plural entry
+     * are looked up with t().
+     *
+     * @param msgid The singular untranslated message
+     * @param n The count that selects the plural form
+     * @param langCode The language code (defaults to "en")
+     * @param defaultValue The fallback value if no translation is found
+     * @return std::string The selected plural form, or the result of t()
+     */
+    std::string tn(const std::string &msgid, unsigned long n, std::string langCode = "en", std::string defaultValue = "") const
     {
-      if (defaultValue.empty())
+      const auto data = storage.snapshot();
+      if (const MoCatalog *catalog = data->mo(langCode))
+      {
+        if (auto text = catalog->findPlural(msgid, n))
+        {
+          return std::string(*text);
+        }
+      }
+      if constexpr (FallbackPolicy::enabled)
       {
-        defaultValue = "Content not found";
+        if (const MoCatalog *catalog = data->mo(FallbackPolicy::locale))
+        {
+          if (auto text = catalog->findPlural(msgid, n))
+          {
+            return std::string(*text);
+          }
+        }
       }
+      return t<std::string>(msgid, langCode, defaultValue);
     }
-    return get<T>(path, langCode, defaultValue);
-  }
-};
+  };
+} // namespace i18n
+
+/**
+ * @brief Internationalization (i18n) struct for managing translations.
+ *
+ * This struct utilizes the nlohmann::json library to handle translation data.
+ * It supports multiple locales and provides methods for loading and accessing translations.
+ * It is i18n::basic_i18n with the default policies: a JSON DOM, English fallback, stderr
+ * warnings and no synchronization.
+ *
+ * Example usage:
+ * @code{.cpp}
+ * #include <nlohmann/json.hpp>
+ * #include <i18n/i18n.hpp>
+ *
+ * // Create translations JSON
+ * nlohmann::json json = {
+ *   {"en", {{"greeting", "Hello"}}},
+ *   {"id", {{"greeting", "Halo"}}}
+ * };
+ *
+ * // Initialize with JSON object
+ * I18n i18n(json);
+ *
+ * // Or initialize from file
+ * I18n i18n_from_file("path/to/translations.json");
+ *
+ * // Get translation in English
+ * std::string greeting_en = i18n.t("greeting", "en");
+ * std::cout << greeting_en << std::endl; // Output: Hello
+ *
+ * // Get translation in Indonesian
+ * std::string greeting_id = i18n.t("greeting", "id");
+ * std::cout << greeting_id << std::endl; // Output: Halo
+ * @endcode
+ */
+using I18n = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::StderrDiagnostics, i18n::SingleThreaded>;
 
-#endif // I18N_HPP
\ No newline at end of file
+#endif // I18N_HPP
@@ -0,0 +1,211 @@
+#ifndef I18N_C_H
+#define I18N_C_H
+
+/**
+ * @file i18n_c.h
+ * @brief C interface to compiled catalogs (i18n::Catalog) for FFI consumers.
+ *
+ * Catalogs are opaque handles; keys and locales are the catalog's dense integer ids. Lookups
+ * return an i18n_string that points straight into catalog storage, so callers in Go, Rust,
+ * Python, ... can read translations without copying them across the boundary. The pointed-to
+ * bytes are valid UTF-8, are not NUL-terminated, and stay valid until the catalog is freed.
+ *
+ * Functions never throw or abort; failures are reported through return values, with a
+ * message available from i18n_last_error(). A catalog handle is immutable and may be shared
+ * between threads; to switch to newer data, open a new catalog and free the old one once no
+ * reader uses it.
+ *
+ * Example usage:
+ * @code{.c}
+ * i18n_catalog *catalog = NULL;
+ * if (i18n_catalog_open("catalog.i18nc", &catalog) != 0)
+ * {
+ *   fprintf(stderr, "%s\n", i18n_last_error());
+ *   return 1;
+ * }
+ *
+ * i18n_key key = i18n_find_key(catalog, "user.greeting", 13);
+ * i18n_locale locale = i18n_find_locale(catalog, "de", 2);
+ * i18n_string text = i18n_t(catalog, key, locale);
+ * if (text.data)
+ * {
+ *   printf("%.*s\n", (int)text.size, text.data);
+ * }
+ * i18n_catalog_free(catalog);
+ * @endcode
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(I18N_C_SHARED)
+#if defined(I18N_C_BUILDING)
+#define I18N_C_API __declspec(dllexport)
+#else
+#define I18N_C_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__) || defined(__clang__)
+#define I18N_C_API __attribute__((visibility("default")))
+#else
+#define I18N_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Opaque handle to a compiled catalog
+   */
+  typedef struct i18n_catalog i18n_catalog;
+
+  /**
+   * @brief Dense key id (i18n::KeyId)
+   */
+  typedef uint32_t i18n_key;
+
+  /**
+   * @brief Dense locale id (i18n::LocaleId)
+   */
+  typedef uint32_t i18n_locale;
+
+  /**
+   * @brief Returned by i18n_find_key() for unknown keys; accepted by every lookup
+   */
+#define I18N_INVALID_KEY ((i18n_key)UINT32_MAX)
+
+  /**
+   * @brief Returned by i18n_find_locale() for unknown locales; accepted by every lookup
+   */
+#define I18N_INVALID_LOCALE ((i18n_locale)UINT32_MAX)
+
+  /**
+   * @brief A view into catalog storage; @c data is NULL when there is no translation
+   */
+  typedef struct i18n_string
+  {
+    const char *data;
+    size_t size;
+  } i18n_string;
+
+  /**
+   * @brief Version of this interface; changes only when existing functions change
+   */
+#define I18N_C_ABI_VERSION 1
+
+  /**
+   * @brief The I18N_C_ABI_VERSION the library was built with
+   */
+  I18N_C_API uint32_t i18n_abi_version(void);
+
+  /**
+   * @brief Message describing the last failure on the calling thread
+   *
+   * @return A NUL-terminated string, valid until the next failing call on this thread
+   */
+  I18N_C_API const char *i18n_last_error(void);
+
+  /**
+   * @brief Open a binary catalog written by i18n::Catalog::save() or `i18n-tool compile`
+   *
+   * @param path NUL-terminated file path
+   * @param out Receives the catalog handle on success
+   * @return 0 on success, -1 on failure (see i18n_last_error())
+   */
+  I18N_C_API int i18n_catalog_open(const char *path, i18n_catalog **out);
+
+  /**
+   * @brief Compile a catalog from a JSON document organized by locale, as accepted by I18n
+   *
+   * @param json The JSON text (need not be NUL-terminated)
+   * @param size Size of @p json in bytes
+   * @param out Receives the catalog handle on success
+   * @return 0 on success, -1 on failure (see i18n_last_error())
+   */
+  I18N_C_API int i18n_catalog_from_json(const char *json, size_t size, i18n_catalog **out);
+
+  /**
+   * @brief Load a binary catalog from memory; the bytes are copied
+   *
+   * @param bytes Contents of a binary catalog
+   * @param size Size of @p bytes
+   * @param out Receives the catalog handle on success
+   * @return 0 on success, -1 on failure (see i18n_last_error())
+   */
+  I18N_C_API int i18n_catalog_from_bytes(const void *bytes, size_t size, i18n_catalog **out);
+
+  /**
+   * @brief Release a catalog; every i18n_string obtained from it becomes invalid (NULL is allowed)
+   */
+  I18N_C_API void i18n_catalog_free(i18n_catalog *catalog);
+
+  /**
+   * @brief Number of locales in the catalog
+   */
+  I18N_C_API size_t i18n_locale_count(const i18n_catalog *catalog);
+
+  /**
+   * @brief Number of keys in the catalog
+   */
+  I18N_C_API size_t i18n_key_count(const i18n_catalog *catalog);
+
+  /**
+   * @brief Resolve a locale code (e.g., "en") to its id, or I18N_INVALID_LOCALE
+   */
+  I18N_C_API i18n_locale i18n_find_locale(const i18n_catalog *catalog, const char *code, size_t size);
+
+  /**
+   * @brief Resolve a dot-separated key path to its id, or I18N_INVALID_KEY
+   *
+   * Resolve keys once and keep the id for hot paths.
+   */
+  I18N_C_API i18n_key i18n_find_key(const i18n_catalog *catalog, const char *path, size_t size);
+
+  /**
+   * @brief Code of a locale, or a NULL string if @p locale is out of range
+   */
+  I18N_C_API i18n_string i18n_locale_code(const i18n_catalog *catalog, i18n_locale locale);
+
+  /**
+   * @brief Path of a key, or a NULL string if @p key is out of range
+   */
+  I18N_C_API i18n_string i18n_key_name(const i18n_catalog *catalog, i18n_key key);
+
+  /**
+   * @brief Translation of a key, falling back to English ("en") like i18n::Catalog::t_view()
+   *
+   * @return The translation, or a NULL string if neither the locale nor the fallback has one
+   */
+  I18N_C_API i18n_string i18n_t(const i18n_catalog *catalog, i18n_key key, i18n_locale locale);
+
+  /**
+   * @brief Translation of a key in one locale, without fallback
+   */
+  I18N_C_API i18n_string i18n_get(const i18n_catalog *catalog, i18n_key key, i18n_locale locale);
+
+  /**
+   * @brief Translation of a numeric code in a code table (see i18n::Catalog::t_code())
+   *
+   * @param table Namespace of the table (e.g., "errors")
+   * @param size Size of @p table in bytes
+   */
+  I18N_C_API i18n_string i18n_t_code(const i18n_catalog *catalog, const char *table, size_t size, int64_t code, i18n_locale locale);
+
+  /**
+   * @brief Elements of an array in one locale (see i18n::Catalog::t_array())
+   *
+   * @param path Dot-separated path of the array
+   * @param size Size of @p path in bytes
+   * @param out Receives up to @p capacity elements (may be NULL when @p capacity is 0)
+   * @param capacity Number of entries @p out can hold
+   * @return The number of elements, which may exceed @p capacity
+   */
+  I18N_C_API size_t i18n_t_array(const i18n_catalog *catalog, const char *path, size_t size, i18n_locale locale,
+                                 i18n_string *out, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I18N_C_H */
@@ -0,0 +1,208 @@
+#ifndef I18N_LOAD_STATS_HPP
+#define I18N_LOAD_STATS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace i18n
+{
+  /**
+   * @brief One timed step of loading or compiling translation data
+   */
+  struct LoadPhase
+  {
+    /**
+     * @brief Phase name, e.g. "parse" (a string literal)
+     */
+    const char *name = "";
+
+    /**
+     * @brief Start of the phase, relative to the start of the first recorded phase
+     */
+    std::chrono::nanoseconds start{0};
+
+    /**
+     * @brief Duration of the phase
+     */
+    std::chrono::nanoseconds duration{0};
+
+    /**
+     * @brief Bytes the phase processed (0 where it does not apply)
+     */
+    std::size_t bytes = 0;
+  };
+
+  /**
+   * @brief Where startup time goes: per-phase durations and byte counts of a load.
+   *
+   * Pass a LoadStats to the loading constructors of basic_i18n, to basic_i18n::load(), or
+   * through CatalogOptions::stats, and read it once the load returns. Phases are recorded in
+   * the order they finish and may nest (e.g. "locales" runs inside "parse"); writeChromeTrace()
+   * shows the nesting on a timeline.
+   *
+   * | Phase         | Recorded by                   | Bytes            |
+   * |---------------|-------------------------------|------------------|
+   * | open          | file loads                    |                  |
+   * | size check    | file loads                    | file size        |
+   * | parse         | file loads (includes reading) | file size        |
+   * | validate      | JSON object loads             |                  |
+   * | copy          | JSON object loads             |                  |
+   * | locales       | JSON storage                  |                  |
+   * | publish       | basic_i18n::load()            |                  |
+   * | utf8          | Catalog builds                | string pool size |
+   * | slab          | Catalog builds                |                  |
+   * | index         | Catalog builds                |                  |
+   * | metrics       | Catalog builds                |                  |
+   * | code tables   | Catalog builds                |                  |
+   * | sort keys     | Catalog builds (if enabled)   |                  |
+   * | case variants | Catalog builds (if enabled)   |                  |
+   *
+   * Example usage:
+   * @code{.cpp}
+   * i18n::LoadStats stats;
+   * I18n i18n("translations.json", stats);
+   * for (const i18n::LoadPhase &phase : stats.phases)
+   * {
+   *   std::cout << phase.name << ": " << phase.duration.count() << " ns\n";
+   * }
+   * std::ofstream("startup.json") << stats.chromeTrace();   // open in chrome://tracing or Perfetto
+   * @endcode
+   */
+  struct LoadStats
+  {
+  private:
+    std::chrono::steady_clock::time_point origin;
+
+    /**
+     * @brief @p value in microseconds with three decimals, whatever the flags of the stream
+     */
+    static std::string microseconds(std::chrono::nanoseconds value)
+    {
+      auto ns = static_cast<unsigned long long>(std::max<std::chrono::nanoseconds::rep>(value.count(), 0));
+      std::string fraction = std::to_string(ns % 1000);
+      return std::to_string(ns / 1000) + "." + std::string(3 - fraction.size(), '0') + fraction;
+    }
+
+  public:
+    /**
+     * @brief Recorded phases, in the order they finished
+     */
+    std::vector<LoadPhase> phases;
+
+    /**
+     * @brief Record a phase that ran from @p begin to @p end
+     */
+    void record(const char *name, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end, std::size_t bytes = 0)
+    {
+      if (phases.empty())
+      {
+        origin = begin;
+      }
+      else if (begin < origin)
+      {
+        // An enclosing phase finishes after the phases nested in it but started before them.
+        for (LoadPhase &phase : phases)
+        {
+          phase.start += origin - begin;
+        }
+        origin = begin;
+      }
+      phases.push_back({name, begin - origin, end - begin, bytes});
+    }
+
+    /**
+     * @brief Time from the start of the first phase to the end of the last
+     */
+    std::chrono::nanoseconds total() const
+    {
+      std::chrono::nanoseconds end{0};
+      for (const LoadPhase &phase : phases)
+      {
+        end = std::max(end, phase.start + phase.duration);
+      }
+      return end;
+    }
+
+    /**
+     * @brief Forget all phases
+     */
+    void clear()
+    {
+      phases.clear();
+    }
+
+    /**
+     * @brief Write the phases as Chrome trace-event JSON (chrome://tracing, Perfetto)
+     *
+     * Each phase becomes a complete ("X") event on one track, with its byte count in `args`.
+     * Times are microseconds with nanosecond decimals; numbers are formatted independently of
+     * the flags, precision and locale of @p out.
+     */
+    void writeChromeTrace(std::ostream &out) const
+    {
+      out << "{\"traceEvents\":[";
+      for (std::size_t i = 0; i < phases.size(); ++i)
+      {
+        const LoadPhase &phase = phases[i];
+        out << (i ? "," : "") << "\n{\"name\":\"" << phase.name << "\",\"cat\":\"i18n\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+            << ",\"ts\":" << microseconds(phase.start)
+            << ",\"dur\":" << microseconds(phase.duration)
+            << ",\"args\":{\"bytes\":" << std::to_string(phase.bytes) << "}}";
+      }
+      out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    /**
+     * @brief The phases as Chrome trace-event JSON, see writeChromeTrace()
+     */
+    std::string chromeTrace() const
+    {
+      std::ostringstream out;
+      writeChromeTrace(out);
+      return out.str();
+    }
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Records the enclosing scope as a phase of a LoadStats; does nothing without one
+     */
+    struct PhaseTimer
+    {
+    private:
+      LoadStats *stats;
+      const char *name;
+      std::chrono::steady_clock::time_point begin;
+
+    public:
+      /**
+       * @brief Bytes to record with the phase
+       */
+      std::size_t bytes = 0;
+
+      PhaseTimer(LoadStats *target, const char *phase)
+          : stats(target), name(phase), begin(target ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+      {
+      }
+
+      PhaseTimer(const PhaseTimer &) = delete;
+      PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+      ~PhaseTimer()
+      {
+        if (stats)
+        {
+          stats->record(name, begin, std::chrono::steady_clock::now(), bytes);
+        }
+      }
+    };
+  } // namespace detail
+} // namespace i18n
+
+#endif // I18N_LOAD_STATS_HPP
@@ -0,0 +1,173 @@
+#ifndef I18N_MAPPED_FILE_HPP
+#define I18N_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace i18n
+{
+  /**
+   * @brief Read-only memory mapping of a whole file.
+   *
+   * Pages are loaded lazily by the OS, so opening a large file costs only the mapping
+   * itself. The mapping is released when the object is destroyed; it can be moved but
+   * not copied.
+   */
+  struct MappedFile
+  {
+  private:
+    const char *bytes = nullptr;
+    std::size_t length = 0;
+#if defined(_WIN32)
+    HANDLE mapping = nullptr;
+#endif
+
+    void release()
+    {
+      if (!bytes)
+      {
+        return;
+      }
+#if defined(_WIN32)
+      UnmapViewOfFile(bytes);
+      CloseHandle(mapping);
+      mapping = nullptr;
+#else
+      munmap(const_cast<char *>(bytes), length);
+#endif
+      bytes = nullptr;
+      length = 0;
+    }
+
+  public:
+    /**
+     * @brief Construct an empty mapping
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Map a file into memory
+     *
+     * @param filePath Path of the file to map
+     * @throws std::runtime_error If the file cannot be opened, is empty, or cannot be mapped
+     */
+    explicit MappedFile(const std::string &filePath)
+    {
+#if defined(_WIN32)
+      HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+      {
+        throw std::runtime_error("Could not open file: " + filePath);
+      }
+
+      LARGE_INTEGER size;
+      if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+      {
+        CloseHandle(file);
+        throw std::runtime_error("File is empty: " + filePath);
+      }
+
+      mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      CloseHandle(file);
+      if (!mapping)
+      {
+        throw std::runtime_error("Could not map file: " + filePath);
+      }
+
+      bytes = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+      if (!bytes)
+      {
+        CloseHandle(mapping);
+        mapping = nullptr;
+        throw std::runtime_error("Could not map file: " + filePath);
+      }
+      length = static_cast<std::size_t>(size.QuadPart);
+#else
+      int fd = ::open(filePath.c_str(), O_RDONLY);
+      if (fd < 0)
+      {
+        throw std::runtime_error("Could not open file: " + filePath);
+      }
+
+      struct stat info;
+      if (fstat(fd, &info) != 0 || info.st_size == 0)
+      {
+        ::close(fd);
+        throw std::runtime_error("File is empty: " + filePath);
+      }
+
+      void *address = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (address == MAP_FAILED)
+      {
+        throw std::runtime_error("Could not map file: " + filePath);
+      }
+
+      bytes = static_cast<const char *>(address);
+      length = static_cast<std::size_t>(info.st_size);
+#endif
+    }
+
+    MappedFile(MappedFile &&other) noexcept
+    {
+      *this = std::move(other);
+    }
+
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+      if (this != &other)
+      {
+        release();
+        std::swap(bytes, other.bytes);
+        std::swap(length, other.length);
+#if defined(_WIN32)
+        std::swap(mapping, other.mapping);
+#endif
+      }
+      return *this;
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Unmap the file
+     */
+    ~MappedFile()
+    {
+      release();
+    }
+
+    /**
+     * @brief First byte of the mapping, or nullptr when empty
+     */
+    const char *data() const
+    {
+      return bytes;
+    }
+
+    /**
+     * @brief Size of the mapping in bytes
+     */
+    std::size_t size() const
+    {
+      return length;
+    }
+  };
+} // namespace i18n
+
+#endif // I18N_MAPPED_FILE_HPP
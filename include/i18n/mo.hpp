@@ -0,0 +1,692 @@
+#ifndef I18N_MO_HPP
+#define I18N_MO_HPP
+
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n
+{
+  /**
+   * @brief Compiled gettext `plural=` expression from a Plural-Forms header.
+   *
+   * Supports the C expression subset used by gettext: the variable `n`, integer literals,
+   * parentheses, `! * / % + - < <= > >= == != && ||` and the `?:` conditional.
+   */
+  struct PluralRule
+  {
+  private:
+    enum class Op : std::uint8_t
+    {
+      N,
+      Number,
+      Not,
+      Negate,
+      Mul,
+      Div,
+      Mod,
+      Add,
+      Sub,
+      Less,
+      LessEqual,
+      Greater,
+      GreaterEqual,
+      Equal,
+      NotEqual,
+      And,
+      Or,
+      Conditional
+    };
+
+    struct Node
+    {
+      Op op;
+      unsigned long value;
+      int operands[3];
+    };
+
+    std::vector<Node> nodes;
+    int root = -1;
+    unsigned long forms = 2;
+
+    // Headers come from untrusted files: bound the parser's recursion (nested parentheses,
+    // unary operators and conditionals) and the tree size, which bounds evaluate()'s recursion.
+    // Real rules use a handful of levels and a few dozen nodes.
+    static constexpr int maxDepth = 64;
+    static constexpr std::size_t maxNodes = 1024;
+
+    struct Parser
+    {
+      std::string_view text;
+      std::size_t pos;
+      std::vector<Node> &nodes;
+      int depth = 0;
+
+      void skipSpace()
+      {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r'))
+        {
+          ++pos;
+        }
+      }
+
+      bool accept(std::string_view token)
+      {
+        skipSpace();
+        if (text.substr(pos, token.size()) == token)
+        {
+          pos += token.size();
+          return true;
+        }
+        return false;
+      }
+
+      int add(Op op, int a = -1, int b = -1, int c = -1, unsigned long value = 0)
+      {
+        if (nodes.size() >= maxNodes)
+        {
+          fail();
+        }
+        nodes.push_back({op, value, {a, b, c}});
+        return static_cast<int>(nodes.size() - 1);
+      }
+
+      [[noreturn]] void fail() const
+      {
+        throw std::runtime_error("Invalid plural expression: " + std::string(text));
+      }
+
+      void enter()
+      {
+        if (++depth > maxDepth)
+        {
+          fail();
+        }
+      }
+
+      int primary()
+      {
+        skipSpace();
+        if (accept("("))
+        {
+          enter();
+          int inner = conditional();
+          if (!accept(")"))
+          {
+            fail();
+          }
+          --depth;
+          return inner;
+        }
+        if (accept("n"))
+        {
+          return add(Op::N);
+        }
+        if (pos < text.size() && text[pos] >= '0' && text[pos] <= '9')
+        {
+          unsigned long value = 0;
+          while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9')
+          {
+            value = value * 10 + static_cast<unsigned long>(text[pos++] - '0');
+          }
+          return add(Op::Number, -1, -1, -1, value);
+        }
+        fail();
+      }
+
+      int unary()
+      {
+        if (accept("!"))
+        {
+          enter();
+          int operand = unary();
+          --depth;
+          return add(Op::Not, operand);
+        }
+        if (accept("-"))
+        {
+          enter();
+          int operand = unary();
+          --depth;
+          return add(Op::Negate, operand);
+        }
+        return primary();
+      }
+
+      int multiplicative()
+      {
+        int left = unary();
+        for (;;)
+        {
+          if (accept("*"))
+            left = add(Op::Mul, left, unary());
+          else if (accept("/"))
+            left = add(Op::Div, left, unary());
+          else if (accept("%"))
+            left = add(Op::Mod, left, unary());
+          else
+            return left;
+        }
+      }
+
+      int additive()
+      {
+        int left = multiplicative();
+        for (;;)
+        {
+          if (accept("+"))
+            left = add(Op::Add, left, multiplicative());
+          else if (accept("-"))
+            left = add(Op::Sub, left, multiplicative());
+          else
+            return left;
+        }
+      }
+
+      int relational()
+      {
+        int left = additive();
+        for (;;)
+        {
+          if (accept("<="))
+            left = add(Op::LessEqual, left, additive());
+          else if (accept(">="))
+            left = add(Op::GreaterEqual, left, additive());
+          else if (accept("<"))
+            left = add(Op::Less, left, additive());
+          else if (accept(">"))
+            left = add(Op::Greater, left, additive());
+          else
+            return left;
+        }
+      }
+
+      int equality()
+      {
+        int left = relational();
+        for (;;)
+        {
+          if (accept("=="))
+            left = add(Op::Equal, left, relational());
+          else if (accept("!="))
+            left = add(Op::NotEqual, left, relational());
+          else
+            return left;
+        }
+      }
+
+      int logicalAnd()
+      {
+        int left = equality();
+        while (accept("&&"))
+        {
+          left = add(Op::And, left, equality());
+        }
+        return left;
+      }
+
+      int logicalOr()
+      {
+        int left = logicalAnd();
+        while (accept("||"))
+        {
+          left = add(Op::Or, left, logicalAnd());
+        }
+        return left;
+      }
+
+      int conditional()
+      {
+        int condition = logicalOr();
+        if (!accept("?"))
+        {
+          return condition;
+        }
+        enter();
+        int whenTrue = conditional();
+        if (!accept(":"))
+        {
+          fail();
+        }
+        int whenFalse = conditional();
+        --depth;
+        return add(Op::Conditional, condition, whenTrue, whenFalse);
+      }
+    };
+
+    unsigned long evaluate(int index, unsigned long n) const
+    {
+      const Node &node = nodes[static_cast<std::size_t>(index)];
+      auto a = [&]()
+      { return evaluate(node.operands[0], n); };
+      auto b = [&]()
+      { return evaluate(node.operands[1], n); };
+
+      switch (node.op)
+      {
+      case Op::N:
+        return n;
+      case Op::Number:
+        return node.value;
+      case Op::Not:
+        return !a();
+      case Op::Negate:
+        return 0 - a();
+      case Op::Mul:
+        return a() * b();
+      case Op::Div:
+      {
+        unsigned long divisor = b();
+        return divisor ? a() / divisor : 0;
+      }
+      case Op::Mod:
+      {
+        unsigned long divisor = b();
+        return divisor ? a() % divisor : 0;
+      }
+      case Op::Add:
+        return a() + b();
+      case Op::Sub:
+        return a() - b();
+      case Op::Less:
+        return a() < b();
+      case Op::LessEqual:
+        return a() <= b();
+      case Op::Greater:
+        return a() > b();
+      case Op::GreaterEqual:
+        return a() >= b();
+      case Op::Equal:
+        return a() == b();
+      case Op::NotEqual:
+        return a() != b();
+      case Op::And:
+        return a() && b();
+      case Op::Or:
+        return a() || b();
+      case Op::Conditional:
+        return a() ? b() : evaluate(node.operands[2], n);
+      }
+      return 0;
+    }
+
+  public:
+    /**
+     * @brief The gettext default rule: two forms, `plural=(n != 1)`
+     */
+    PluralRule() : PluralRule(2, "n != 1") {}
+
+    /**
+     * @brief Compile a rule
+     *
+     * @param nplurals Number of plural forms
+     * @param expression The `plural=` expression (e.g., "(n != 1)")
+     * @throws std::runtime_error If the expression cannot be parsed
+     */
+    PluralRule(unsigned long nplurals, std::string_view expression) : forms(nplurals ? nplurals : 1)
+    {
+      Parser parser{expression, 0, nodes};
+      root = parser.conditional();
+      parser.skipSpace();
+      if (parser.pos != expression.size())
+      {
+        parser.fail();
+      }
+    }
+
+    /**
+     * @brief Parse the Plural-Forms line of a gettext header
+     *
+     * @param header The PO/MO header (the translation of the empty msgid)
+     * @return PluralRule The declared rule, or the default rule when the header has none
+     * @throws std::runtime_error If the Plural-Forms line is malformed
+     */
+    static PluralRule fromHeader(std::string_view header)
+    {
+      std::size_t line = header.find("Plural-Forms:");
+      if (line == std::string_view::npos)
+      {
+        return PluralRule();
+      }
+      std::string_view value = header.substr(line + 13);
+      value = value.substr(0, value.find('\n'));
+
+      std::size_t nplurals = value.find("nplurals=");
+      std::size_t plural = value.find("plural=", nplurals == std::string_view::npos ? 0 : nplurals + 9);
+      if (nplurals == std::string_view::npos || plural == std::string_view::npos)
+      {
+        throw std::runtime_error("Invalid Plural-Forms header: " + std::string(value));
+      }
+
+      unsigned long count = std::strtoul(std::string(value.substr(nplurals + 9)).c_str(), nullptr, 10);
+      std::string_view expression = value.substr(plural + 7);
+      expression = expression.substr(0, expression.find(';'));
+      return PluralRule(count, expression);
+    }
+
+    /**
+     * @brief Number of plural forms
+     */
+    unsigned long count() const
+    {
+      return forms;
+    }
+
+    /**
+     * @brief Index of the plural form to use for @p n, clamped to count() - 1
+     */
+    unsigned long index(unsigned long n) const
+    {
+      unsigned long form = evaluate(root, n);
+      return form < forms ? form : forms - 1;
+    }
+  };
+
+  /**
+   * @brief GNU gettext `.mo` catalog served directly from a memory-mapped file.
+   *
+   * Lookups use the hash table that msgfmt embeds in the file, so opening a catalog costs
+   * one mmap plus parsing the Plural-Forms header; nothing is copied or indexed at load
+   * time. Files without a hash table fall back to binary search over the sorted originals.
+   * Both byte orders are accepted.
+   *
+   * Example usage:
+   * @code{.cpp}
+   * i18n::MoCatalog mo("locale/de/LC_MESSAGES/app.mo");
+   * std::string_view text = mo.find("Open file").value_or("Open file");
+   * std::string_view files = mo.findPlural("%d file", 3).value_or("%d files");
+   * @endcode
+   */
+  struct MoCatalog
+  {
+  private:
+    MappedFile file;
+    bool swapped = false;
+    std::uint32_t count = 0;
+    std::uint32_t originals = 0;
+    std::uint32_t translations = 0;
+    std::uint32_t hashSize = 0;
+    std::uint32_t hashOffset = 0;
+    PluralRule plural;
+
+    std::uint32_t read(std::size_t offset) const
+    {
+      if (offset + 4 > file.size())
+      {
+        throw std::runtime_error("Corrupt .mo file");
+      }
+      std::uint32_t value;
+      std::memcpy(&value, file.data() + offset, sizeof(value));
+      if (swapped)
+      {
+        value = (value >> 24) | ((value >> 8) & 0xFF00) | ((value << 8) & 0xFF0000) | (value << 24);
+      }
+      return value;
+    }
+
+    /**
+     * @brief String @p index of the table at @p table, including embedded NULs (plural forms)
+     */
+    std::string_view entry(std::uint32_t table, std::uint32_t index) const
+    {
+      std::uint32_t length = read(table + static_cast<std::size_t>(index) * 8);
+      std::uint32_t offset = read(table + static_cast<std::size_t>(index) * 8 + 4);
+      if (static_cast<std::size_t>(offset) + length > file.size())
+      {
+        throw std::runtime_error("Corrupt .mo file");
+      }
+      return {file.data() + offset, length};
+    }
+
+    /**
+     * @brief The msgid part of an original string (before any plural msgid)
+     */
+    static std::string_view key(std::string_view original)
+    {
+      return original.substr(0, original.find('\0'));
+    }
+
+    /**
+     * @brief gettext's hashpjw over the concatenation of @p parts
+     */
+    template <std::size_t N>
+    static std::uint64_t hash(const std::string_view (&parts)[N])
+    {
+      std::uint64_t value = 0;
+      for (std::string_view part : parts)
+      {
+        for (char c : part)
+        {
+          value = (value << 4) + static_cast<unsigned char>(c);
+          std::uint64_t high = value & (~std::uint64_t{0} << 28);
+          if (high)
+          {
+            value ^= high >> 24;
+            value ^= high;
+          }
+        }
+      }
+      return value;
+    }
+
+    /**
+     * @brief Locate the string index whose msgid equals the concatenation of @p parts
+     */
+    template <std::size_t N>
+    std::optional<std::uint32_t> locate(const std::string_view (&parts)[N]) const
+    {
+      auto equals = [&](std::string_view original)
+      {
+        for (std::string_view part : parts)
+        {
+          if (original.substr(0, part.size()) != part)
+          {
+            return false;
+          }
+          original.remove_prefix(part.size());
+        }
+        return original.empty();
+      };
+
+      if (hashSize > 2)
+      {
+        std::uint64_t value = hash(parts);
+        std::uint32_t index = static_cast<std::uint32_t>(value % hashSize);
+        std::uint32_t increment = static_cast<std::uint32_t>(1 + value % (hashSize - 2));
+        for (std::uint32_t probes = 0; probes < hashSize; ++probes)
+        {
+          std::uint32_t slot = read(hashOffset + static_cast<std::size_t>(index) * 4);
+          if (slot == 0)
+          {
+            return std::nullopt;
+          }
+          if (slot <= count && equals(key(entry(originals, slot - 1))))
+          {
+            return slot - 1;
+          }
+          index = index >= hashSize - increment ? index - (hashSize - increment) : index + increment;
+        }
+        return std::nullopt;
+      }
+
+      // msgfmt sorts originals, so files without a hash table can be bisected.
+      std::uint32_t low = 0;
+      std::uint32_t high = count;
+      while (low < high)
+      {
+        std::uint32_t mid = low + (high - low) / 2;
+        std::string_view original = key(entry(originals, mid));
+        if (equals(original))
+        {
+          return mid;
+        }
+
+        std::size_t consumed = 0;
+        int order = 0;
+        for (std::string_view part : parts)
+        {
+          order = original.substr(std::min(consumed, original.size()), part.size()).compare(part);
+          consumed += part.size();
+          if (order != 0)
+          {
+            break;
+          }
+        }
+        if (order == 0)
+        {
+          order = 1; // original is longer than the key
+        }
+        if (order < 0)
+        {
+          low = mid + 1;
+        }
+        else
+        {
+          high = mid;
+        }
+      }
+      return std::nullopt;
+    }
+
+    /**
+     * @brief Plural form @p which of the translation at @p index
+     */
+    std::optional<std::string_view> form(std::optional<std::uint32_t> index, unsigned long which) const
+    {
+      if (!index)
+      {
+        return std::nullopt;
+      }
+
+      std::string_view forms = entry(translations, *index);
+      for (unsigned long i = which; i > 0; --i)
+      {
+        std::size_t end = forms.find('\0');
+        if (end == std::string_view::npos)
+        {
+          break;
+        }
+        forms.remove_prefix(end + 1);
+      }
+      return forms.substr(0, forms.find('\0'));
+    }
+
+  public:
+    /**
+     * @brief Map and validate a `.mo` file
+     *
+     * @param filePath Path to the `.mo` file
+     * @throws std::runtime_error If the file cannot be mapped or is not a valid `.mo` file
+     */
+    explicit MoCatalog(const std::string &filePath) : file(filePath)
+    {
+      if (file.size() < 28)
+      {
+        throw std::runtime_error("Not a .mo file: " + filePath);
+      }
+
+      std::uint32_t magic;
+      std::memcpy(&magic, file.data(), sizeof(magic));
+      if (magic == 0xde120495)
+      {
+        swapped = true;
+      }
+      else if (magic != 0x950412de)
+      {
+        throw std::runtime_error("Not a .mo file: " + filePath);
+      }
+
+      if ((read(4) >> 16) > 1)
+      {
+        throw std::runtime_error("Unsupported .mo revision: " + filePath);
+      }
+
+      count = read(8);
+      originals = read(12);
+      translations = read(16);
+      hashSize = read(20);
+      hashOffset = read(24);
+      if (static_cast<std::size_t>(originals) + static_cast<std::size_t>(count) * 8 > file.size() ||
+          static_cast<std::size_t>(translations) + static_cast<std::size_t>(count) * 8 > file.size() ||
+          static_cast<std::size_t>(hashOffset) + static_cast<std::size_t>(hashSize) * 4 > file.size())
+      {
+        throw std::runtime_error("Corrupt .mo file: " + filePath);
+      }
+
+      plural = PluralRule::fromHeader(header());
+    }
+
+    /**
+     * @brief Number of messages, including the header entry
+     */
+    std::size_t size() const
+    {
+      return count;
+    }
+
+    /**
+     * @brief The catalog header (translation of the empty msgid), or an empty view
+     */
+    std::string_view header() const
+    {
+      const std::string_view parts[] = {std::string_view()};
+      std::optional<std::uint32_t> index = locate(parts);
+      return index ? entry(translations, *index) : std::string_view();
+    }
+
+    /**
+     * @brief The plural rule declared in the header
+     */
+    const PluralRule &pluralRule() const
+    {
+      return plural;
+    }
+
+    /**
+     * @brief Look up the translation of a msgid (gettext)
+     *
+     * @param msgid The untranslated message
+     * @return The translation (first form for plural entries), or std::nullopt if absent
+     */
+    std::optional<std::string_view> find(std::string_view msgid) const
+    {
+      const std::string_view parts[] = {msgid};
+      return form(locate(parts), 0);
+    }
+
+    /**
+     * @brief Look up the translation of a msgid in a context (pgettext)
+     *
+     * @param context The msgctxt
+     * @param msgid The untranslated message
+     * @return The translation, or std::nullopt if absent
+     */
+    std::optional<std::string_view> find(std::string_view context, std::string_view msgid) const
+    {
+      const std::string_view parts[] = {context, std::string_view("\x04", 1), msgid};
+      return form(locate(parts), 0);
+    }
+
+    /**
+     * @brief Look up the plural form of a msgid for a count (ngettext)
+     *
+     * @param msgid The singular untranslated message
+     * @param n The count that selects the plural form through the header's rule
+     * @return The selected form, or std::nullopt if absent
+     */
+    std::optional<std::string_view> findPlural(std::string_view msgid, unsigned long n) const
+    {
+      const std::string_view parts[] = {msgid};
+      return form(locate(parts), plural.index(n));
+    }
+  };
+} // namespace i18n
+
+#endif // I18N_MO_HPP
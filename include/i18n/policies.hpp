@@ -0,0 +1,670 @@
+#ifndef I18N_POLICIES_HPP
+#define I18N_POLICIES_HPP
+
+#include "arena_json.hpp"
+#include "core.hpp"
+#include "load_stats.hpp"
+#include "mo.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace i18n
+{
+  /**
+   * @brief Storage policy: translations kept as a JSON DOM organized by locale, plus any
+   * gettext catalogs loaded for individual locales.
+   *
+   * A storage policy owns the translation data and answers path lookups for one locale.
+   * basic_i18n only reads from it through a const reference, except while loading.
+   *
+   * The locale list and gettext registry are allocated from the memory resource passed at
+   * construction, and copies stay on that resource. The JSON tree never uses that resource:
+   * it allocates through @p Json's own allocator (the global heap, or the arena below). Path
+   * lookups do not allocate.
+   *
+   * When @p Json allocates through ArenaAllocator (see ArenaJson), every tree is built in a
+   * monotonic arena owned by the storage, and freeing the storage releases the arena at once.
+   *
+   * @tparam Json The nlohmann::basic_json specialization that holds the tree
+   */
+  template <typename Json>
+  struct BasicJsonStorage
+  {
+  private:
+    /**
+     * @brief Arena holding #translations when Json uses ArenaAllocator; declared first so it outlives the tree
+     */
+    std::shared_ptr<std::pmr::monotonic_buffer_resource> arena;
+
+    /**
+     * @brief JSON object containing all translation data organized by locale
+     */
+    Json translations;
+
+    /**
+     * @brief List of available locale codes
+     */
+    std::pmr::vector<std::pmr::string> codes;
+
+    /**
+     * @brief Memory-mapped gettext catalogs by locale code, consulted after the JSON data
+     */
+    std::pmr::map<std::pmr::string, std::shared_ptr<const MoCatalog>, std::less<>> moCatalogs;
+
+    /**
+     * @brief Resolve a dot-separated path in a JSON object.
+     *
+     * Segments are views into @p path and are looked up without building key strings.
+     *
+     * @param source The source JSON object to navigate.
+     * @param path The dot-separated path to resolve (e.g., "user.name.first").
+     * @return A pointer to the resolved JSON value, or nullptr if the path does not exist.
+     */
+    static const Json *resolve(const Json &source, std::string_view path)
+    {
+      const Json *current = &source;
+      std::size_t begin = 0;
+
+      while (begin < path.size())
+      {
+        std::size_t end = std::min(path.find('.', begin), path.size());
+        if (!current->is_object())
+        {
+          return nullptr;
+        }
+        auto it = current->find(path.substr(begin, end - begin));
+        if (it == current->end())
+        {
+          return nullptr;
+        }
+        current = &*it;
+        begin = end + 1;
+      }
+
+      return current;
+    }
+
+    /**
+     * @brief A fresh arena for an arena-backed Json, nullptr otherwise
+     */
+    static std::shared_ptr<std::pmr::monotonic_buffer_resource> makeArena()
+    {
+      if constexpr (usesArena<Json>)
+      {
+        return std::make_shared<std::pmr::monotonic_buffer_resource>();
+      }
+      else
+      {
+        return nullptr;
+      }
+    }
+
+    /**
+     * @brief Build a tree with @p make, allocating from #arena when there is one
+     */
+    template <typename Make>
+    Json inArena(Make &&make) const
+    {
+      if constexpr (usesArena<Json>)
+      {
+        ArenaScope scope(arena.get());
+        return make();
+      }
+      else
+      {
+        return make();
+      }
+    }
+
+    /**
+     * @brief Record the top-level keys of #translations as locale codes
+     */
+    void collectLocales(LoadStats *stats)
+    {
+      detail::PhaseTimer timer(stats, "locales");
+      for (auto &[key, value] : translations.items())
+      {
+        codes.emplace_back(key);
+      }
+    }
+
+  public:
+    using json_type = Json;
+
+    BasicJsonStorage() = default;
+
+    /**
+     * @brief Take ownership of a translation tree with locale codes as top-level keys
+     *
+     * @param json The translation data
+     * @param resource Memory resource for the locale list and gettext registry
+     * @param stats Receives the "locales" phase, if not nullptr
+     */
+    explicit BasicJsonStorage(const json_type &json, std::pmr::memory_resource *resource = std::pmr::get_default_resource(), LoadStats *stats = nullptr)
+        : arena(makeArena()), translations(inArena([&]()
+                                                    { return json_type(json); })),
+          codes(resource), moCatalogs(resource)
+    {
+      collectLocales(stats);
+    }
+
+    /**
+     * @brief Take over a translation tree; an arena-backed tree is copied into this storage's own arena
+     *
+     * @param json The translation data
+     * @param resource Memory resource for the locale list and gettext registry
+     * @param stats Receives the "locales" phase, if not nullptr
+     */
+    explicit BasicJsonStorage(json_type &&json, std::pmr::memory_resource *resource = std::pmr::get_default_resource(), LoadStats *stats = nullptr)
+        : arena(makeArena()), translations(inArena([&]() -> json_type
+                                                    {
+                                                      if constexpr (usesArena<Json>)
+                                                      {
+                                                        return json_type(json);
+                                                      }
+                                                      else
+                                                      {
+                                                        return std::move(json);
+                                                      } })),
+          codes(resource), moCatalogs(resource)
+    {
+      collectLocales(stats);
+    }
+
+    /**
+     * @brief Parse a translation tree from a stream
+     *
+     * @param in Stream holding a JSON document
+     * @param resource Memory resource for the locale list and gettext registry
+     * @param stats Receives the "locales" phase, if not nullptr
+     * @throws json_type::parse_error If the document is not valid JSON
+     */
+    explicit BasicJsonStorage(std::istream &in, std::pmr::memory_resource *resource = std::pmr::get_default_resource(), LoadStats *stats = nullptr)
+        : arena(makeArena()), translations(inArena([&]()
+                                                    { return json_type::parse(in); })),
+          codes(resource), moCatalogs(resource)
+    {
+      collectLocales(stats);
+    }
+
+    /**
+     * @brief Copy onto the same memory resource as @p other (and into a new arena, if any)
+     */
+    BasicJsonStorage(const BasicJsonStorage &other)
+        : arena(makeArena()),
+          translations(inArena([&]()
+                               { return json_type(other.translations); })),
+          codes(other.codes, other.codes.get_allocator()),
+          moCatalogs(other.moCatalogs, other.moCatalogs.get_allocator())
+    {
+    }
+
+    BasicJsonStorage(BasicJsonStorage &&) noexcept = default;
+
+    BasicJsonStorage &operator=(const BasicJsonStorage &other)
+    {
+      if (this != &other)
+      {
+        *this = BasicJsonStorage(other);
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Move-assign, swapping tree and arena together so the old tree dies before its arena
+     *
+     * Like a pmr container, the storage keeps its own memory resource: when @p other uses a
+     * different one, the locale list and gettext registry are moved element by element, which
+     * allocates. That happens before anything is swapped, so a failure leaves both unchanged.
+     */
+    BasicJsonStorage &operator=(BasicJsonStorage &&other)
+    {
+      decltype(codes) nextCodes(std::move(other.codes), codes.get_allocator());
+      decltype(moCatalogs) nextCatalogs(std::move(other.moCatalogs), moCatalogs.get_allocator());
+      translations.swap(other.translations);
+      arena.swap(other.arena);
+      codes.swap(nextCodes);
+      moCatalogs.swap(nextCatalogs);
+      return *this;
+    }
+
+    /**
+     * @brief The memory resource of the locale list and gettext registry
+     */
+    std::pmr::memory_resource *resource() const
+    {
+      return codes.get_allocator().resource();
+    }
+
+    /**
+     * @brief The translation tree
+     */
+    const json_type &tree() const
+    {
+      return translations;
+    }
+
+    /**
+     * @brief Locale codes in the order they appear in the source data, then gettext-only locales
+     */
+    const std::pmr::vector<std::pmr::string> &locales() const
+    {
+      return codes;
+    }
+
+    /**
+     * @brief Resolve a path in one locale
+     *
+     * @param locale The locale code
+     * @param path The dot-separated path
+     * @return The value, or nullptr if the locale or path does not exist or the value is null
+     */
+    const json_type *find(std::string_view locale, std::string_view path) const
+    {
+      auto tree = translations.find(locale);
+      if (tree == translations.end())
+      {
+        return nullptr;
+      }
+      const json_type *node = resolve(*tree, path);
+      return node && !node->is_null() ? node : nullptr;
+    }
+
+    /**
+     * @brief Install or replace the translations of one locale (a shard)
+     *
+     * With an arena-backed Json the whole tree is rebuilt in a fresh arena, since a monotonic
+     * arena cannot reuse the blocks of a replaced locale: repeated shard loads then cost a copy
+     * of the tree each but keep memory bounded by the live data.
+     *
+     * @param locale The locale code
+     * @param tree The locale's translation object; copied into this storage (and its arena, if any)
+     */
+    void setLocale(std::string_view locale, const json_type &tree)
+    {
+      if constexpr (usesArena<Json>)
+      {
+        std::shared_ptr<std::pmr::monotonic_buffer_resource> fresh = makeArena();
+        json_type next;
+        {
+          ArenaScope scope(fresh.get());
+          next = json_type::object();
+          bool replaced = false;
+          for (auto it = translations.begin(); it != translations.end(); ++it)
+          {
+            bool match = std::string_view(it.key()) == locale;
+            next[it.key()] = match ? json_type(tree) : json_type(*it);
+            replaced = replaced || match;
+          }
+          if (!replaced)
+          {
+            next[typename json_type::object_t::key_type(locale.begin(), locale.end())] = json_type(tree);
+          }
+        }
+        // next takes the old tree and fresh the old arena; next is destroyed first.
+        translations.swap(next);
+        arena.swap(fresh);
+      }
+      else
+      {
+        typename json_type::object_t::key_type key(locale.begin(), locale.end());
+        translations[std::move(key)] = json_type(tree);
+      }
+      if (std::find(codes.begin(), codes.end(), locale) == codes.end())
+      {
+        codes.emplace_back(locale);
+      }
+    }
+
+    /**
+     * @brief Register a gettext catalog for a locale, replacing any previous one
+     *
+     * @param locale The locale code the catalog provides
+     * @param catalog The mapped catalog
+     */
+    void addMo(std::string_view locale, std::shared_ptr<const MoCatalog> catalog)
+    {
+      auto it = moCatalogs.find(locale);
+      if (it == moCatalogs.end())
+      {
+        it = moCatalogs.emplace(std::pmr::string(locale), nullptr).first;
+      }
+      it->second = std::move(catalog);
+      if (std::find(codes.begin(), codes.end(), locale) == codes.end())
+      {
+        codes.emplace_back(locale);
+      }
+    }
+
+    /**
+     * @brief Whether any gettext catalog is loaded; lookups skip the registry when none is
+     */
+    bool hasMo() const
+    {
+      return !moCatalogs.empty();
+    }
+
+    /**
+     * @brief The gettext catalog loaded for a locale, or nullptr
+     */
+    const MoCatalog *mo(std::string_view locale) const
+    {
+      auto it = moCatalogs.find(locale);
+      return it != moCatalogs.end() ? it->second.get() : nullptr;
+    }
+
+    /**
+     * @brief Look up a msgid in the gettext catalog loaded for a locale
+     *
+     * @return The translation, or std::nullopt if no catalog is loaded or the msgid is absent
+     */
+    std::optional<std::string_view> findMo(std::string_view locale, std::string_view msgid) const
+    {
+      const MoCatalog *catalog = mo(locale);
+      return catalog ? catalog->find(msgid) : std::nullopt;
+    }
+  };
+
+  /**
+   * @brief The default storage policy: an nlohmann::json DOM
+   */
+  using JsonStorage = BasicJsonStorage<nlohmann::json>;
+
+  /**
+   * @brief Fallback policy: untranslated paths are looked up in English ("en"), and string
+   * lookups without a default yield "Content not found".
+   *
+   * A fallback policy provides `enabled`, the fallback `locale` and the `notFound` text
+   * substituted for an empty string default by basic_i18n::t().
+   */
+  struct EnglishFallback
+  {
+    static constexpr bool enabled = true;
+    static constexpr const char *locale = "en";
+    static constexpr const char *notFound = "Content not found";
+  };
+
+  /**
+   * @brief Fallback policy: only the requested locale is consulted and the default value is
+   * returned as given.
+   */
+  struct NoFallback
+  {
+    static constexpr bool enabled = false;
+    static constexpr const char *locale = "";
+    static constexpr const char *notFound = "";
+  };
+
+  /**
+   * @brief Diagnostics policy: warns on stderr when a path exists only in the requested locale.
+   *
+   * A diagnostics policy provides `enabled` and `contentOnlyIn(path, langCode)`. When
+   * `enabled` is false the check that would trigger the report is not compiled at all.
+   */
+  struct StderrDiagnostics
+  {
+    static constexpr bool enabled = true;
+
+    static void contentOnlyIn(std::string_view path, std::string_view langCode)
+    {
+      std::cerr << "Warning: Content for path '" << path << "' is not available in any locale except '" << langCode << "'." << std::endl;
+    }
+  };
+
+  /**
+   * @brief Diagnostics policy: no checks, no output.
+   */
+  struct NoDiagnostics
+  {
+    static constexpr bool enabled = false;
+
+    static void contentOnlyIn(std::string_view, std::string_view) {}
+  };
+
+  /**
+   * @brief Threading policy: the storage is owned directly and read without synchronization.
+   *
+   * A threading policy provides `holder<Storage>` with snapshot(), which returns a
+   * pointer-like handle to the current storage, update(fn), which applies a modification,
+   * and replace(storage), plus `concurrent`, which tells whether readers may run while
+   * another thread modifies the storage.
+   */
+  struct SingleThreaded
+  {
+    static constexpr bool concurrent = false;
+
+    template <typename Storage>
+    struct holder
+    {
+    private:
+      // Always engaged; replaced by reconstruction rather than assignment where the move
+      // constructor cannot throw, so new storage keeps the memory resource it was built with.
+      std::optional<Storage> storage;
+
+      void reset(Storage &&next)
+      {
+        if constexpr (std::is_nothrow_move_constructible_v<Storage>)
+        {
+          storage.emplace(std::move(next));
+        }
+        else
+        {
+          *storage = std::move(next);
+        }
+      }
+
+    public:
+      holder() : storage(std::in_place) {}
+
+      explicit holder(Storage initial) : storage(std::move(initial)) {}
+
+      holder(const holder &) = default;
+
+      holder(holder &&) = default;
+
+      holder &operator=(const holder &other)
+      {
+        if (this != &other)
+        {
+          reset(Storage(*other.storage));
+        }
+        return *this;
+      }
+
+      holder &operator=(holder &&other) noexcept(std::is_nothrow_move_constructible_v<Storage>)
+      {
+        if (this != &other)
+        {
+          reset(std::move(*other.storage));
+        }
+        return *this;
+      }
+
+      const Storage *snapshot() const
+      {
+        return &*storage;
+      }
+
+      template <typename Fn>
+      void update(Fn &&fn)
+      {
+        fn(*storage);
+      }
+
+      void replace(Storage next)
+      {
+        reset(std::move(next));
+      }
+    };
+  };
+
+  /**
+   * @brief Reclamation hook of BasicSharedSnapshot that observes nothing
+   *
+   * A hook provides retired(snapshot), called by the writer once an update has superseded a
+   * snapshot, and reclaimed(snapshot), called by whichever thread drops the last reference,
+   * right before the snapshot is destroyed. The time between the two is how long readers kept
+   * old data alive. Both must not throw; with `enabled` false neither is called and snapshots
+   * are allocated together with their reference count.
+   */
+  struct NoReclaimHook
+  {
+    static constexpr bool enabled = false;
+
+    static void retired(const void *) noexcept {}
+
+    static void reclaimed(const void *) noexcept {}
+  };
+
+  /**
+   * @brief Threading policy: readers share an immutable snapshot of the storage.
+   *
+   * Lookups pin the current snapshot with one atomic load, so they never block and never
+   * observe a half-applied update. Writers are serialized; each update copies the storage,
+   * modifies the copy and publishes it atomically. A snapshot is released when its last
+   * reader finishes with it.
+   *
+   * @tparam ReclaimHook Notified when snapshots are retired and reclaimed (see NoReclaimHook)
+   */
+  template <typename ReclaimHook>
+  struct BasicSharedSnapshot
+  {
+    static constexpr bool concurrent = true;
+
+    template <typename Storage>
+    struct holder
+    {
+    private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+      std::atomic<std::shared_ptr<const Storage>> current;
+
+      std::shared_ptr<const Storage> load() const
+      {
+        return current.load(std::memory_order_acquire);
+      }
+
+      void store(std::shared_ptr<const Storage> next)
+      {
+        current.store(std::move(next), std::memory_order_release);
+      }
+
+      std::shared_ptr<const Storage> exchange(std::shared_ptr<const Storage> next)
+      {
+        return current.exchange(std::move(next), std::memory_order_acq_rel);
+      }
+#else
+      std::shared_ptr<const Storage> current;
+
+      std::shared_ptr<const Storage> load() const
+      {
+        return std::atomic_load_explicit(&current, std::memory_order_acquire);
+      }
+
+      void store(std::shared_ptr<const Storage> next)
+      {
+        std::atomic_store_explicit(&current, std::move(next), std::memory_order_release);
+      }
+
+      std::shared_ptr<const Storage> exchange(std::shared_ptr<const Storage> next)
+      {
+        return std::atomic_exchange_explicit(&current, std::move(next), std::memory_order_acq_rel);
+      }
+#endif
+
+      std::mutex writer;
+
+      static std::shared_ptr<const Storage> make(Storage storage)
+      {
+        if constexpr (ReclaimHook::enabled)
+        {
+          return std::shared_ptr<const Storage>(new Storage(std::move(storage)), [](const Storage *snapshot)
+                                                {
+            ReclaimHook::reclaimed(snapshot);
+            delete snapshot; });
+        }
+        else
+        {
+          return std::make_shared<const Storage>(std::move(storage));
+        }
+      }
+
+      /**
+       * @brief Publish @p next and report the snapshot it supersedes; the writer lock must be held
+       */
+      void publish(Storage next)
+      {
+        std::shared_ptr<const Storage> previous = exchange(make(std::move(next)));
+        if constexpr (ReclaimHook::enabled)
+        {
+          if (previous)
+          {
+            ReclaimHook::retired(previous.get());
+          }
+        }
+      }
+
+    public:
+      holder() : holder(Storage()) {}
+
+      explicit holder(Storage initial)
+      {
+        store(make(std::move(initial)));
+      }
+
+      /**
+       * @brief Copies share the source's current snapshot; later updates diverge
+       */
+      holder(const holder &other) noexcept
+      {
+        store(other.load());
+      }
+
+      holder &operator=(const holder &other) noexcept
+      {
+        if (this != &other)
+        {
+          store(other.load());
+        }
+        return *this;
+      }
+
+      std::shared_ptr<const Storage> snapshot() const
+      {
+        return load();
+      }
+
+      template <typename Fn>
+      void update(Fn &&fn)
+      {
+        std::lock_guard<std::mutex> lock(writer);
+        Storage next(*load());
+        fn(next);
+        publish(std::move(next));
+      }
+
+      void replace(Storage next)
+      {
+        std::lock_guard<std::mutex> lock(writer);
+        publish(std::move(next));
+      }
+    };
+  };
+
+  /**
+   * @brief The snapshot threading policy without reclamation hooks
+   */
+  using SharedSnapshot = BasicSharedSnapshot<NoReclaimHook>;
+} // namespace i18n
+
+#endif // I18N_POLICIES_HPP
@@ -0,0 +1,53 @@
+#ifndef I18N_TRACE_HPP
+#define I18N_TRACE_HPP
+
+/**
+ * @file trace.hpp
+ * @brief USDT (SystemTap/DTrace-style) static tracepoints.
+ *
+ * When `<sys/sdt.h>` is available (the systemtap-sdt-dev / systemtap-sdt-devel package on
+ * Linux), the I18N_PROBE macros emit static probes under the provider `i18n`. An unattached
+ * probe is a single nop in the instruction stream, so live processes can be traced with
+ * `perf`, `bpftrace` or `stap` without rebuilding:
+ *
+ * @code{.sh}
+ * bpftrace -e 'usdt:./server:i18n:fallback { printf("%s -> %s\n", str(arg0), str(arg1)); }'
+ * @endcode
+ *
+ * Without the header, or with I18N_NO_TRACE defined, the macros expand to nothing and their
+ * arguments are not evaluated.
+ *
+ * | Probe             | Arguments                                         |
+ * |-------------------|---------------------------------------------------|
+ * | get__entry        | path, locale (NUL-terminated)                     |
+ * | get__return       | path, locale, found (1 if a translation was used) |
+ * | fallback          | path, fallback locale                             |
+ * | default           | path, locale                                      |
+ * | reload__begin     | file path                                         |
+ * | reload__end       | file path, ok (0 if the load threw)               |
+ * | shard__load       | locale, file path                                 |
+ * | catalog__fallback | KeyId, requested LocaleId, fallback LocaleId      |
+ *
+ * (A double underscore in a probe name is shown as '-' by most tools, e.g. `get-entry`.)
+ */
+
+#if !defined(I18N_NO_TRACE) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define I18N_HAS_USDT 1
+#endif
+#endif
+
+#if defined(I18N_HAS_USDT)
+#define I18N_PROBE(name) DTRACE_PROBE(i18n, name)
+#define I18N_PROBE1(name, a) DTRACE_PROBE1(i18n, name, a)
+#define I18N_PROBE2(name, a, b) DTRACE_PROBE2(i18n, name, a, b)
+#define I18N_PROBE3(name, a, b, c) DTRACE_PROBE3(i18n, name, a, b, c)
+#else
+#define I18N_PROBE(name) ((void)0)
+#define I18N_PROBE1(name, a) ((void)0)
+#define I18N_PROBE2(name, a, b) ((void)0)
+#define I18N_PROBE3(name, a, b, c) ((void)0)
+#endif
+
+#endif // I18N_TRACE_HPP
@@ -0,0 +1,329 @@
+#ifndef I18N_UNICODE_HPP
+#define I18N_UNICODE_HPP
+
+#include "unicode_tables.hpp"
+#include "utf8.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace i18n
+{
+  /**
+   * @brief Layout facts about a string, as a terminal or fixed-cell display sees it.
+   *
+   * Catalogs compute these once per translation (see Catalog::t_meta()), so truncating or
+   * padding a label does not need to segment it again on every render.
+   */
+  struct TextMetrics
+  {
+    /**
+     * @brief Number of Unicode code points
+     */
+    std::uint32_t codePoints = 0;
+
+    /**
+     * @brief Number of extended grapheme clusters (user-perceived characters, UAX #29)
+     */
+    std::uint32_t graphemes = 0;
+
+    /**
+     * @brief Display width in terminal columns: East Asian wide characters and emoji take two,
+     * combining marks and control characters none
+     */
+    std::uint32_t width = 0;
+
+    /**
+     * @brief Direction of the first strong character
+     */
+    TextDirection direction = TextDirection::Neutral;
+
+    /**
+     * @brief Whether the string is pure ASCII (one byte, one code point and at most one column per character)
+     */
+    bool ascii = true;
+
+    bool operator==(const TextMetrics &other) const
+    {
+      return codePoints == other.codePoints && graphemes == other.graphemes && width == other.width &&
+             direction == other.direction && ascii == other.ascii;
+    }
+
+    bool operator!=(const TextMetrics &other) const
+    {
+      return !(*this == other);
+    }
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Property value of @p cp in a sorted range table, or 0 if no range contains it
+     */
+    template <std::size_t N>
+    inline std::uint8_t lookupRange(const UnicodeRange (&table)[N], char32_t cp)
+    {
+      std::size_t low = 0;
+      std::size_t high = N;
+      while (low < high)
+      {
+        std::size_t mid = (low + high) / 2;
+        if (table[mid].last < cp)
+        {
+          low = mid + 1;
+        }
+        else if (table[mid].first > cp)
+        {
+          high = mid;
+        }
+        else
+        {
+          return table[mid].value;
+        }
+      }
+      return 0;
+    }
+
+    /**
+     * @brief Decode the code point at @p i and advance past it; the input must be valid UTF-8
+     */
+    inline char32_t decodeUtf8(std::string_view text, std::size_t &i)
+    {
+      auto byte = [&](std::size_t at)
+      {
+        return static_cast<char32_t>(static_cast<unsigned char>(text[at]));
+      };
+
+      char32_t lead = byte(i);
+      if (lead < 0x80)
+      {
+        i += 1;
+        return lead;
+      }
+      if (lead < 0xE0)
+      {
+        char32_t cp = ((lead & 0x1F) << 6) | (byte(i + 1) & 0x3F);
+        i += 2;
+        return cp;
+      }
+      if (lead < 0xF0)
+      {
+        char32_t cp = ((lead & 0x0F) << 12) | ((byte(i + 1) & 0x3F) << 6) | (byte(i + 2) & 0x3F);
+        i += 3;
+        return cp;
+      }
+      char32_t cp = ((lead & 0x07) << 18) | ((byte(i + 1) & 0x3F) << 12) | ((byte(i + 2) & 0x3F) << 6) | (byte(i + 3) & 0x3F);
+      i += 4;
+      return cp;
+    }
+
+    /**
+     * @brief Grapheme_Cluster_Break value of a code point
+     */
+    inline GraphemeBreak graphemeBreak(char32_t cp)
+    {
+      if (cp == '\r')
+      {
+        return GraphemeBreak::CR;
+      }
+      if (cp == '\n')
+      {
+        return GraphemeBreak::LF;
+      }
+
+      // Hangul jamo and syllables are assigned algorithmically rather than through the table.
+      if ((cp >= 0x1100 && cp <= 0x115F) || (cp >= 0xA960 && cp <= 0xA97C))
+      {
+        return GraphemeBreak::L;
+      }
+      if ((cp >= 0x1160 && cp <= 0x11A7) || (cp >= 0xD7B0 && cp <= 0xD7C6))
+      {
+        return GraphemeBreak::V;
+      }
+      if ((cp >= 0x11A8 && cp <= 0x11FF) || (cp >= 0xD7CB && cp <= 0xD7FB))
+      {
+        return GraphemeBreak::T;
+      }
+      if (cp >= 0xAC00 && cp <= 0xD7A3)
+      {
+        return (cp - 0xAC00) % 28 == 0 ? GraphemeBreak::LV : GraphemeBreak::LVT;
+      }
+
+      return static_cast<GraphemeBreak>(lookupRange(graphemeBreakRanges, cp));
+    }
+
+    /**
+     * @brief Whether there is a grapheme cluster boundary between @p prev and @p next
+     *
+     * @param prev Break value of the previous code point
+     * @param next Break value of the next code point
+     * @param emojiZwj True if the text before @p next ends in ExtPict Extend* ZWJ (GB11)
+     * @param oddRegional True if an odd number of regional indicators precede @p next (GB12/13)
+     */
+    inline bool isGraphemeBoundary(GraphemeBreak prev, GraphemeBreak next, bool emojiZwj, bool oddRegional)
+    {
+      using GB = GraphemeBreak;
+
+      if (prev == GB::CR && next == GB::LF)
+      {
+        return false; // GB3
+      }
+      if (prev == GB::CR || prev == GB::LF || prev == GB::Control ||
+          next == GB::CR || next == GB::LF || next == GB::Control)
+      {
+        return true; // GB4, GB5
+      }
+      if (prev == GB::L && (next == GB::L || next == GB::V || next == GB::LV || next == GB::LVT))
+      {
+        return false; // GB6
+      }
+      if ((prev == GB::LV || prev == GB::V) && (next == GB::V || next == GB::T))
+      {
+        return false; // GB7
+      }
+      if ((prev == GB::LVT || prev == GB::T) && next == GB::T)
+      {
+        return false; // GB8
+      }
+      if (next == GB::Extend || next == GB::ZWJ || next == GB::SpacingMark || prev == GB::Prepend)
+      {
+        return false; // GB9, GB9a, GB9b
+      }
+      if (prev == GB::ZWJ && next == GB::ExtendedPictographic && emojiZwj)
+      {
+        return false; // GB11
+      }
+      if (prev == GB::RegionalIndicator && next == GB::RegionalIndicator && oddRegional)
+      {
+        return false; // GB12, GB13
+      }
+      return true; // GB999
+    }
+
+    /**
+     * @brief Columns taken by a single code point outside of any cluster context
+     */
+    inline std::uint32_t codePointWidth(char32_t cp, GraphemeBreak type)
+    {
+      switch (type)
+      {
+      case GraphemeBreak::CR:
+      case GraphemeBreak::LF:
+      case GraphemeBreak::Control:
+      case GraphemeBreak::Extend:
+      case GraphemeBreak::ZWJ:
+      case GraphemeBreak::V:
+      case GraphemeBreak::T:
+        return 0;
+      default:
+        return lookupRange(wideRanges, cp) ? 2 : 1;
+      }
+    }
+
+    /**
+     * @brief TextMetrics of an ASCII string, without decoding
+     */
+    inline TextMetrics measureAscii(std::string_view text)
+    {
+      TextMetrics metrics;
+      metrics.codePoints = static_cast<std::uint32_t>(text.size());
+      metrics.graphemes = metrics.codePoints;
+      for (std::size_t i = 0; i < text.size(); ++i)
+      {
+        char c = text[i];
+        if (c >= 0x20 && c < 0x7F)
+        {
+          ++metrics.width;
+        }
+        else if (c == '\n' && i > 0 && text[i - 1] == '\r')
+        {
+          --metrics.graphemes;
+        }
+        if (metrics.direction == TextDirection::Neutral && ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')))
+        {
+          metrics.direction = TextDirection::LeftToRight;
+        }
+      }
+      return metrics;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Count code points, grapheme clusters and display columns of a string and find its direction
+   *
+   * Grapheme clusters follow the extended rules of UAX #29. A cluster is as wide as its widest
+   * code point, and regional indicator pairs (flags) and emoji followed by U+FE0F take two
+   * columns. ASCII strings are measured without decoding.
+   *
+   * @param text Valid UTF-8 (as held by a Catalog); invalid input gives unspecified counts
+   * @return TextMetrics The metrics of @p text
+   */
+  inline TextMetrics measureText(std::string_view text)
+  {
+    std::size_t ascii = detail::asciiPrefix(text.data(), text.size());
+    if (ascii == text.size())
+    {
+      return detail::measureAscii(text);
+    }
+
+    using GB = detail::GraphemeBreak;
+    TextMetrics metrics = detail::measureAscii(text.substr(0, ascii));
+    metrics.ascii = false;
+
+    GB prev = GB::Other;
+    bool emojiRun = false;    // text so far ends in ExtPict Extend*
+    bool emojiZwj = false;    // text so far ends in ExtPict Extend* ZWJ
+    bool oddRegional = false; // text so far ends in an odd run of regional indicators
+    bool first = ascii == 0;
+    std::uint32_t clusterWidth = 0;
+    char32_t clusterBase = 0;
+
+    // Resume after the ASCII prefix, with its last character as the open cluster.
+    if (!first)
+    {
+      clusterBase = static_cast<unsigned char>(text[ascii - 1]);
+      prev = detail::graphemeBreak(clusterBase);
+      clusterWidth = detail::codePointWidth(clusterBase, prev);
+      metrics.width -= clusterWidth;
+    }
+
+    std::size_t i = ascii;
+    while (i < text.size())
+    {
+      char32_t cp = detail::decodeUtf8(text, i);
+      GB type = detail::graphemeBreak(cp);
+      ++metrics.codePoints;
+
+      if (metrics.direction == TextDirection::Neutral)
+      {
+        metrics.direction = static_cast<TextDirection>(detail::lookupRange(detail::strongBidiRanges, cp));
+      }
+
+      if (first || detail::isGraphemeBoundary(prev, type, emojiZwj, oddRegional))
+      {
+        ++metrics.graphemes;
+        metrics.width += clusterWidth;
+        clusterWidth = 0;
+        clusterBase = cp;
+        first = false;
+      }
+
+      std::uint32_t width = detail::codePointWidth(cp, type);
+      if ((type == GB::RegionalIndicator && oddRegional) ||
+          (cp == 0xFE0F && detail::graphemeBreak(clusterBase) == GB::ExtendedPictographic))
+      {
+        width = 2;
+      }
+      clusterWidth = clusterWidth > width ? clusterWidth : width;
+
+      emojiZwj = type == GB::ZWJ && emojiRun;
+      emojiRun = type == GB::ExtendedPictographic || (emojiRun && type == GB::Extend);
+      oddRegional = type == GB::RegionalIndicator && !oddRegional;
+      prev = type;
+    }
+    metrics.width += clusterWidth;
+    return metrics;
+  }
+} // namespace i18n
+
+#endif // I18N_UNICODE_HPP
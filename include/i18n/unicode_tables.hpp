@@ -0,0 +1,924 @@
+#ifndef I18N_UNICODE_TABLES_HPP
+#define I18N_UNICODE_TABLES_HPP
+
+// Unicode 14.0 data used by unicode.hpp, collation.hpp and casemap.hpp. Generated from the
+// Unicode Character Database (General_Category, East_Asian_Width, Bidi_Class, canonical
+// decompositions, simple and unconditional special case mappings, plus the
+// Other_Grapheme_Extend, Prepended_Concatenation_Mark and Extended_Pictographic lists).
+// Ranges are sorted, do not overlap, and absorb unassigned code points between two ranges of
+// the same value.
+
+#include <cstdint>
+
+namespace i18n
+{
+  /**
+   * @brief Writing direction of a string, taken from its first strong character (UAX #9, P2)
+   */
+  enum class TextDirection : std::uint8_t
+  {
+    /**
+     * @brief No strong character, e.g. digits, punctuation or an empty string
+     */
+    Neutral = 0,
+
+    /**
+     * @brief Starts with a left-to-right letter (Latin, Cyrillic, CJK, ...)
+     */
+    LeftToRight = 1,
+
+    /**
+     * @brief Starts with a right-to-left letter (Hebrew, Arabic, ...)
+     */
+    RightToLeft = 2
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Grapheme_Cluster_Break property values (UAX #29)
+     */
+    enum class GraphemeBreak : std::uint8_t
+    {
+      Other,
+      CR,
+      LF,
+      Control,
+      Extend,
+      ZWJ,
+      RegionalIndicator,
+      Prepend,
+      SpacingMark,
+      L,
+      V,
+      T,
+      LV,
+      LVT,
+      ExtendedPictographic
+    };
+
+    /**
+     * @brief Inclusive code point range with a property value
+     */
+    struct UnicodeRange
+    {
+      char32_t first;
+      char32_t last;
+      std::uint8_t value;
+
+      constexpr UnicodeRange(char32_t from, char32_t to, int property)
+          : first(from), last(to), value(static_cast<std::uint8_t>(property)) {}
+
+      template <typename Enum>
+      constexpr UnicodeRange(char32_t from, char32_t to, Enum property)
+          : first(from), last(to), value(static_cast<std::uint8_t>(property)) {}
+    };
+
+    /**
+     * @brief Grapheme_Cluster_Break classes other than CR, LF, Hangul and Other
+     */
+    inline constexpr UnicodeRange graphemeBreakRanges[] = {
+        {0x0000, 0x0009, GraphemeBreak::Control}, {0x000B, 0x000C, GraphemeBreak::Control}, {0x000E, 0x001F, GraphemeBreak::Control},
+        {0x007F, 0x009F, GraphemeBreak::Control}, {0x00A9, 0x00A9, GraphemeBreak::ExtendedPictographic}, {0x00AD, 0x00AD, GraphemeBreak::Control},
+        {0x00AE, 0x00AE, GraphemeBreak::ExtendedPictographic}, {0x0300, 0x036F, GraphemeBreak::Extend}, {0x0483, 0x0489, GraphemeBreak::Extend},
+        {0x0591, 0x05BD, GraphemeBreak::Extend}, {0x05BF, 0x05BF, GraphemeBreak::Extend}, {0x05C1, 0x05C2, GraphemeBreak::Extend},
+        {0x05C4, 0x05C5, GraphemeBreak::Extend}, {0x05C7, 0x05C7, GraphemeBreak::Extend}, {0x0600, 0x0605, GraphemeBreak::Prepend},
+        {0x0610, 0x061A, GraphemeBreak::Extend}, {0x061C, 0x061C, GraphemeBreak::Control}, {0x064B, 0x065F, GraphemeBreak::Extend},
+        {0x0670, 0x0670, GraphemeBreak::Extend}, {0x06D6, 0x06DC, GraphemeBreak::Extend}, {0x06DD, 0x06DD, GraphemeBreak::Prepend},
+        {0x06DF, 0x06E4, GraphemeBreak::Extend}, {0x06E7, 0x06E8, GraphemeBreak::Extend}, {0x06EA, 0x06ED, GraphemeBreak::Extend},
+        {0x070F, 0x070F, GraphemeBreak::Prepend}, {0x0711, 0x0711, GraphemeBreak::Extend}, {0x0730, 0x074A, GraphemeBreak::Extend},
+        {0x07A6, 0x07B0, GraphemeBreak::Extend}, {0x07EB, 0x07F3, GraphemeBreak::Extend}, {0x07FD, 0x07FD, GraphemeBreak::Extend},
+        {0x0816, 0x0819, GraphemeBreak::Extend}, {0x081B, 0x0823, GraphemeBreak::Extend}, {0x0825, 0x0827, GraphemeBreak::Extend},
+        {0x0829, 0x082D, GraphemeBreak::Extend}, {0x0859, 0x085B, GraphemeBreak::Extend}, {0x0890, 0x0891, GraphemeBreak::Prepend},
+        {0x0898, 0x089F, GraphemeBreak::Extend}, {0x08CA, 0x08E1, GraphemeBreak::Extend}, {0x08E2, 0x08E2, GraphemeBreak::Prepend},
+        {0x08E3, 0x0902, GraphemeBreak::Extend}, {0x0903, 0x0903, GraphemeBreak::SpacingMark}, {0x093A, 0x093A, GraphemeBreak::Extend},
+        {0x093B, 0x093B, GraphemeBreak::SpacingMark}, {0x093C, 0x093C, GraphemeBreak::Extend}, {0x093E, 0x0940, GraphemeBreak::SpacingMark},
+        {0x0941, 0x0948, GraphemeBreak::Extend}, {0x0949, 0x094C, GraphemeBreak::SpacingMark}, {0x094D, 0x094D, GraphemeBreak::Extend},
+        {0x094E, 0x094F, GraphemeBreak::SpacingMark}, {0x0951, 0x0957, GraphemeBreak::Extend}, {0x0962, 0x0963, GraphemeBreak::Extend},
+        {0x0981, 0x0981, GraphemeBreak::Extend}, {0x0982, 0x0983, GraphemeBreak::SpacingMark}, {0x09BC, 0x09BC, GraphemeBreak::Extend},
+        {0x09BE, 0x09BE, GraphemeBreak::Extend}, {0x09BF, 0x09C0, GraphemeBreak::SpacingMark}, {0x09C1, 0x09C4, GraphemeBreak::Extend},
+        {0x09C7, 0x09CC, GraphemeBreak::SpacingMark}, {0x09CD, 0x09CD, GraphemeBreak::Extend}, {0x09D7, 0x09D7, GraphemeBreak::Extend},
+        {0x09E2, 0x09E3, GraphemeBreak::Extend}, {0x09FE, 0x0A02, GraphemeBreak::Extend}, {0x0A03, 0x0A03, GraphemeBreak::SpacingMark},
+        {0x0A3C, 0x0A3C, GraphemeBreak::Extend}, {0x0A3E, 0x0A40, GraphemeBreak::SpacingMark}, {0x0A41, 0x0A51, GraphemeBreak::Extend},
+        {0x0A70, 0x0A71, GraphemeBreak::Extend}, {0x0A75, 0x0A75, GraphemeBreak::Extend}, {0x0A81, 0x0A82, GraphemeBreak::Extend},
+        {0x0A83, 0x0A83, GraphemeBreak::SpacingMark}, {0x0ABC, 0x0ABC, GraphemeBreak::Extend}, {0x0ABE, 0x0AC0, GraphemeBreak::SpacingMark},
+        {0x0AC1, 0x0AC8, GraphemeBreak::Extend}, {0x0AC9, 0x0ACC, GraphemeBreak::SpacingMark}, {0x0ACD, 0x0ACD, GraphemeBreak::Extend},
+        {0x0AE2, 0x0AE3, GraphemeBreak::Extend}, {0x0AFA, 0x0B01, GraphemeBreak::Extend}, {0x0B02, 0x0B03, GraphemeBreak::SpacingMark},
+        {0x0B3C, 0x0B3C, GraphemeBreak::Extend}, {0x0B3E, 0x0B3F, GraphemeBreak::Extend}, {0x0B40, 0x0B40, GraphemeBreak::SpacingMark},
+        {0x0B41, 0x0B44, GraphemeBreak::Extend}, {0x0B47, 0x0B4C, GraphemeBreak::SpacingMark}, {0x0B4D, 0x0B57, GraphemeBreak::Extend},
+        {0x0B62, 0x0B63, GraphemeBreak::Extend}, {0x0B82, 0x0B82, GraphemeBreak::Extend}, {0x0BBE, 0x0BBE, GraphemeBreak::Extend},
+        {0x0BBF, 0x0BBF, GraphemeBreak::SpacingMark}, {0x0BC0, 0x0BC0, GraphemeBreak::Extend}, {0x0BC1, 0x0BCC, GraphemeBreak::SpacingMark},
+        {0x0BCD, 0x0BCD, GraphemeBreak::Extend}, {0x0BD7, 0x0BD7, GraphemeBreak::Extend}, {0x0C00, 0x0C00, GraphemeBreak::Extend},
+        {0x0C01, 0x0C03, GraphemeBreak::SpacingMark}, {0x0C04, 0x0C04, GraphemeBreak::Extend}, {0x0C3C, 0x0C3C, GraphemeBreak::Extend},
+        {0x0C3E, 0x0C40, GraphemeBreak::Extend}, {0x0C41, 0x0C44, GraphemeBreak::SpacingMark}, {0x0C46, 0x0C56, GraphemeBreak::Extend},
+        {0x0C62, 0x0C63, GraphemeBreak::Extend}, {0x0C81, 0x0C81, GraphemeBreak::Extend}, {0x0C82, 0x0C83, GraphemeBreak::SpacingMark},
+        {0x0CBC, 0x0CBC, GraphemeBreak::Extend}, {0x0CBE, 0x0CBE, GraphemeBreak::SpacingMark}, {0x0CBF, 0x0CBF, GraphemeBreak::Extend},
+        {0x0CC0, 0x0CC1, GraphemeBreak::SpacingMark}, {0x0CC2, 0x0CC2, GraphemeBreak::Extend}, {0x0CC3, 0x0CC4, GraphemeBreak::SpacingMark},
+        {0x0CC6, 0x0CC6, GraphemeBreak::Extend}, {0x0CC7, 0x0CCB, GraphemeBreak::SpacingMark}, {0x0CCC, 0x0CD6, GraphemeBreak::Extend},
+        {0x0CE2, 0x0CE3, GraphemeBreak::Extend}, {0x0D00, 0x0D01, GraphemeBreak::Extend}, {0x0D02, 0x0D03, GraphemeBreak::SpacingMark},
+        {0x0D3B, 0x0D3C, GraphemeBreak::Extend}, {0x0D3E, 0x0D3E, GraphemeBreak::Extend}, {0x0D3F, 0x0D40, GraphemeBreak::SpacingMark},
+        {0x0D41, 0x0D44, GraphemeBreak::Extend}, {0x0D46, 0x0D4C, GraphemeBreak::SpacingMark}, {0x0D4D, 0x0D4D, GraphemeBreak::Extend},
+        {0x0D4E, 0x0D4E, GraphemeBreak::Prepend}, {0x0D57, 0x0D57, GraphemeBreak::Extend}, {0x0D62, 0x0D63, GraphemeBreak::Extend},
+        {0x0D81, 0x0D81, GraphemeBreak::Extend}, {0x0D82, 0x0D83, GraphemeBreak::SpacingMark}, {0x0DCA, 0x0DCF, GraphemeBreak::Extend},
+        {0x0DD0, 0x0DD1, GraphemeBreak::SpacingMark}, {0x0DD2, 0x0DD6, GraphemeBreak::Extend}, {0x0DD8, 0x0DDE, GraphemeBreak::SpacingMark},
+        {0x0DDF, 0x0DDF, GraphemeBreak::Extend}, {0x0DF2, 0x0DF3, GraphemeBreak::SpacingMark}, {0x0E31, 0x0E31, GraphemeBreak::Extend},
+        {0x0E33, 0x0E33, GraphemeBreak::SpacingMark}, {0x0E34, 0x0E3A, GraphemeBreak::Extend}, {0x0E47, 0x0E4E, GraphemeBreak::Extend},
+        {0x0EB1, 0x0EB1, GraphemeBreak::Extend}, {0x0EB3, 0x0EB3, GraphemeBreak::SpacingMark}, {0x0EB4, 0x0EBC, GraphemeBreak::Extend},
+        {0x0EC8, 0x0ECD, GraphemeBreak::Extend}, {0x0F18, 0x0F19, GraphemeBreak::Extend}, {0x0F35, 0x0F35, GraphemeBreak::Extend},
+        {0x0F37, 0x0F37, GraphemeBreak::Extend}, {0x0F39, 0x0F39, GraphemeBreak::Extend}, {0x0F3E, 0x0F3F, GraphemeBreak::SpacingMark},
+        {0x0F71, 0x0F7E, GraphemeBreak::Extend}, {0x0F7F, 0x0F7F, GraphemeBreak::SpacingMark}, {0x0F80, 0x0F84, GraphemeBreak::Extend},
+        {0x0F86, 0x0F87, GraphemeBreak::Extend}, {0x0F8D, 0x0FBC, GraphemeBreak::Extend}, {0x0FC6, 0x0FC6, GraphemeBreak::Extend},
+        {0x102D, 0x1030, GraphemeBreak::Extend}, {0x1031, 0x1031, GraphemeBreak::SpacingMark}, {0x1032, 0x1037, GraphemeBreak::Extend},
+        {0x1039, 0x103A, GraphemeBreak::Extend}, {0x103B, 0x103C, GraphemeBreak::SpacingMark}, {0x103D, 0x103E, GraphemeBreak::Extend},
+        {0x1056, 0x1057, GraphemeBreak::SpacingMark}, {0x1058, 0x1059, GraphemeBreak::Extend}, {0x105E, 0x1060, GraphemeBreak::Extend},
+        {0x1071, 0x1074, GraphemeBreak::Extend}, {0x1082, 0x1082, GraphemeBreak::Extend}, {0x1084, 0x1084, GraphemeBreak::SpacingMark},
+        {0x1085, 0x1086, GraphemeBreak::Extend}, {0x108D, 0x108D, GraphemeBreak::Extend}, {0x109D, 0x109D, GraphemeBreak::Extend},
+        {0x135D, 0x135F, GraphemeBreak::Extend}, {0x1712, 0x1714, GraphemeBreak::Extend}, {0x1715, 0x1715, GraphemeBreak::SpacingMark},
+        {0x1732, 0x1733, GraphemeBreak::Extend}, {0x1734, 0x1734, GraphemeBreak::SpacingMark}, {0x1752, 0x1753, GraphemeBreak::Extend},
+        {0x1772, 0x1773, GraphemeBreak::Extend}, {0x17B4, 0x17B5, GraphemeBreak::Extend}, {0x17B6, 0x17B6, GraphemeBreak::SpacingMark},
+        {0x17B7, 0x17BD, GraphemeBreak::Extend}, {0x17BE, 0x17C5, GraphemeBreak::SpacingMark}, {0x17C6, 0x17C6, GraphemeBreak::Extend},
+        {0x17C7, 0x17C8, GraphemeBreak::SpacingMark}, {0x17C9, 0x17D3, GraphemeBreak::Extend}, {0x17DD, 0x17DD, GraphemeBreak::Extend},
+        {0x180B, 0x180D, GraphemeBreak::Extend}, {0x180E, 0x180E, GraphemeBreak::Control}, {0x180F, 0x180F, GraphemeBreak::Extend},
+        {0x1885, 0x1886, GraphemeBreak::Extend}, {0x18A9, 0x18A9, GraphemeBreak::Extend}, {0x1920, 0x1922, GraphemeBreak::Extend},
+        {0x1923, 0x1926, GraphemeBreak::SpacingMark}, {0x1927, 0x1928, GraphemeBreak::Extend}, {0x1929, 0x1931, GraphemeBreak::SpacingMark},
+        {0x1932, 0x1932, GraphemeBreak::Extend}, {0x1933, 0x1938, GraphemeBreak::SpacingMark}, {0x1939, 0x193B, GraphemeBreak::Extend},
+        {0x1A17, 0x1A18, GraphemeBreak::Extend}, {0x1A19, 0x1A1A, GraphemeBreak::SpacingMark}, {0x1A1B, 0x1A1B, GraphemeBreak::Extend},
+        {0x1A55, 0x1A55, GraphemeBreak::SpacingMark}, {0x1A56, 0x1A56, GraphemeBreak::Extend}, {0x1A57, 0x1A57, GraphemeBreak::SpacingMark},
+        {0x1A58, 0x1A60, GraphemeBreak::Extend}, {0x1A62, 0x1A62, GraphemeBreak::Extend}, {0x1A65, 0x1A6C, GraphemeBreak::Extend},
+        {0x1A6D, 0x1A72, GraphemeBreak::SpacingMark}, {0x1A73, 0x1A7F, GraphemeBreak::Extend}, {0x1AB0, 0x1B03, GraphemeBreak::Extend},
+        {0x1B04, 0x1B04, GraphemeBreak::SpacingMark}, {0x1B34, 0x1B3A, GraphemeBreak::Extend}, {0x1B3B, 0x1B3B, GraphemeBreak::SpacingMark},
+        {0x1B3C, 0x1B3C, GraphemeBreak::Extend}, {0x1B3D, 0x1B41, GraphemeBreak::SpacingMark}, {0x1B42, 0x1B42, GraphemeBreak::Extend},
+        {0x1B43, 0x1B44, GraphemeBreak::SpacingMark}, {0x1B6B, 0x1B73, GraphemeBreak::Extend}, {0x1B80, 0x1B81, GraphemeBreak::Extend},
+        {0x1B82, 0x1B82, GraphemeBreak::SpacingMark}, {0x1BA1, 0x1BA1, GraphemeBreak::SpacingMark}, {0x1BA2, 0x1BA5, GraphemeBreak::Extend},
+        {0x1BA6, 0x1BA7, GraphemeBreak::SpacingMark}, {0x1BA8, 0x1BA9, GraphemeBreak::Extend}, {0x1BAA, 0x1BAA, GraphemeBreak::SpacingMark},
+        {0x1BAB, 0x1BAD, GraphemeBreak::Extend}, {0x1BE6, 0x1BE6, GraphemeBreak::Extend}, {0x1BE7, 0x1BE7, GraphemeBreak::SpacingMark},
+        {0x1BE8, 0x1BE9, GraphemeBreak::Extend}, {0x1BEA, 0x1BEC, GraphemeBreak::SpacingMark}, {0x1BED, 0x1BED, GraphemeBreak::Extend},
+        {0x1BEE, 0x1BEE, GraphemeBreak::SpacingMark}, {0x1BEF, 0x1BF1, GraphemeBreak::Extend}, {0x1BF2, 0x1BF3, GraphemeBreak::SpacingMark},
+        {0x1C24, 0x1C2B, GraphemeBreak::SpacingMark}, {0x1C2C, 0x1C33, GraphemeBreak::Extend}, {0x1C34, 0x1C35, GraphemeBreak::SpacingMark},
+        {0x1C36, 0x1C37, GraphemeBreak::Extend}, {0x1CD0, 0x1CD2, GraphemeBreak::Extend}, {0x1CD4, 0x1CE0, GraphemeBreak::Extend},
+        {0x1CE1, 0x1CE1, GraphemeBreak::SpacingMark}, {0x1CE2, 0x1CE8, GraphemeBreak::Extend}, {0x1CED, 0x1CED, GraphemeBreak::Extend},
+        {0x1CF4, 0x1CF4, GraphemeBreak::Extend}, {0x1CF7, 0x1CF7, GraphemeBreak::SpacingMark}, {0x1CF8, 0x1CF9, GraphemeBreak::Extend},
+        {0x1DC0, 0x1DFF, GraphemeBreak::Extend}, {0x200B, 0x200B, GraphemeBreak::Control}, {0x200C, 0x200C, GraphemeBreak::Extend},
+        {0x200D, 0x200D, GraphemeBreak::ZWJ}, {0x200E, 0x200F, GraphemeBreak::Control}, {0x2028, 0x202E, GraphemeBreak::Control},
+        {0x203C, 0x203C, GraphemeBreak::ExtendedPictographic}, {0x2049, 0x2049, GraphemeBreak::ExtendedPictographic}, {0x2060, 0x206F, GraphemeBreak::Control},
+        {0x20D0, 0x20F0, GraphemeBreak::Extend}, {0x2122, 0x2122, GraphemeBreak::ExtendedPictographic}, {0x2139, 0x2139, GraphemeBreak::ExtendedPictographic},
+        {0x2194, 0x2199, GraphemeBreak::ExtendedPictographic}, {0x21A9, 0x21AA, GraphemeBreak::ExtendedPictographic}, {0x231A, 0x231B, GraphemeBreak::ExtendedPictographic},
+        {0x2328, 0x2328, GraphemeBreak::ExtendedPictographic}, {0x2388, 0x2388, GraphemeBreak::ExtendedPictographic}, {0x23CF, 0x23CF, GraphemeBreak::ExtendedPictographic},
+        {0x23E9, 0x23F3, GraphemeBreak::ExtendedPictographic}, {0x23F8, 0x23FA, GraphemeBreak::ExtendedPictographic}, {0x24C2, 0x24C2, GraphemeBreak::ExtendedPictographic},
+        {0x25AA, 0x25AB, GraphemeBreak::ExtendedPictographic}, {0x25B6, 0x25B6, GraphemeBreak::ExtendedPictographic}, {0x25C0, 0x25C0, GraphemeBreak::ExtendedPictographic},
+        {0x25FB, 0x25FE, GraphemeBreak::ExtendedPictographic}, {0x2600, 0x2605, GraphemeBreak::ExtendedPictographic}, {0x2607, 0x2612, GraphemeBreak::ExtendedPictographic},
+        {0x2614, 0x2685, GraphemeBreak::ExtendedPictographic}, {0x2690, 0x2705, GraphemeBreak::ExtendedPictographic}, {0x2708, 0x2712, GraphemeBreak::ExtendedPictographic},
+        {0x2714, 0x2714, GraphemeBreak::ExtendedPictographic}, {0x2716, 0x2716, GraphemeBreak::ExtendedPictographic}, {0x271D, 0x271D, GraphemeBreak::ExtendedPictographic},
+        {0x2721, 0x2721, GraphemeBreak::ExtendedPictographic}, {0x2728, 0x2728, GraphemeBreak::ExtendedPictographic}, {0x2733, 0x2734, GraphemeBreak::ExtendedPictographic},
+        {0x2744, 0x2744, GraphemeBreak::ExtendedPictographic}, {0x2747, 0x2747, GraphemeBreak::ExtendedPictographic}, {0x274C, 0x274C, GraphemeBreak::ExtendedPictographic},
+        {0x274E, 0x274E, GraphemeBreak::ExtendedPictographic}, {0x2753, 0x2755, GraphemeBreak::ExtendedPictographic}, {0x2757, 0x2757, GraphemeBreak::ExtendedPictographic},
+        {0x2763, 0x2767, GraphemeBreak::ExtendedPictographic}, {0x2795, 0x2797, GraphemeBreak::ExtendedPictographic}, {0x27A1, 0x27A1, GraphemeBreak::ExtendedPictographic},
+        {0x27B0, 0x27B0, GraphemeBreak::ExtendedPictographic}, {0x27BF, 0x27BF, GraphemeBreak::ExtendedPictographic}, {0x2934, 0x2935, GraphemeBreak::ExtendedPictographic},
+        {0x2B05, 0x2B07, GraphemeBreak::ExtendedPictographic}, {0x2B1B, 0x2B1C, GraphemeBreak::ExtendedPictographic}, {0x2B50, 0x2B50, GraphemeBreak::ExtendedPictographic},
+        {0x2B55, 0x2B55, GraphemeBreak::ExtendedPictographic}, {0x2CEF, 0x2CF1, GraphemeBreak::Extend}, {0x2D7F, 0x2D7F, GraphemeBreak::Extend},
+        {0x2DE0, 0x2DFF, GraphemeBreak::Extend}, {0x302A, 0x302F, GraphemeBreak::Extend}, {0x3030, 0x3030, GraphemeBreak::ExtendedPictographic},
+        {0x303D, 0x303D, GraphemeBreak::ExtendedPictographic}, {0x3099, 0x309A, GraphemeBreak::Extend}, {0x3297, 0x3297, GraphemeBreak::ExtendedPictographic},
+        {0x3299, 0x3299, GraphemeBreak::ExtendedPictographic}, {0xA66F, 0xA672, GraphemeBreak::Extend}, {0xA674, 0xA67D, GraphemeBreak::Extend},
+        {0xA69E, 0xA69F, GraphemeBreak::Extend}, {0xA6F0, 0xA6F1, GraphemeBreak::Extend}, {0xA802, 0xA802, GraphemeBreak::Extend},
+        {0xA806, 0xA806, GraphemeBreak::Extend}, {0xA80B, 0xA80B, GraphemeBreak::Extend}, {0xA823, 0xA824, GraphemeBreak::SpacingMark},
+        {0xA825, 0xA826, GraphemeBreak::Extend}, {0xA827, 0xA827, GraphemeBreak::SpacingMark}, {0xA82C, 0xA82C, GraphemeBreak::Extend},
+        {0xA880, 0xA881, GraphemeBreak::SpacingMark}, {0xA8B4, 0xA8C3, GraphemeBreak::SpacingMark}, {0xA8C4, 0xA8C5, GraphemeBreak::Extend},
+        {0xA8E0, 0xA8F1, GraphemeBreak::Extend}, {0xA8FF, 0xA8FF, GraphemeBreak::Extend}, {0xA926, 0xA92D, GraphemeBreak::Extend},
+        {0xA947, 0xA951, GraphemeBreak::Extend}, {0xA952, 0xA953, GraphemeBreak::SpacingMark}, {0xA980, 0xA982, GraphemeBreak::Extend},
+        {0xA983, 0xA983, GraphemeBreak::SpacingMark}, {0xA9B3, 0xA9B3, GraphemeBreak::Extend}, {0xA9B4, 0xA9B5, GraphemeBreak::SpacingMark},
+        {0xA9B6, 0xA9B9, GraphemeBreak::Extend}, {0xA9BA, 0xA9BB, GraphemeBreak::SpacingMark}, {0xA9BC, 0xA9BD, GraphemeBreak::Extend},
+        {0xA9BE, 0xA9C0, GraphemeBreak::SpacingMark}, {0xA9E5, 0xA9E5, GraphemeBreak::Extend}, {0xAA29, 0xAA2E, GraphemeBreak::Extend},
+        {0xAA2F, 0xAA30, GraphemeBreak::SpacingMark}, {0xAA31, 0xAA32, GraphemeBreak::Extend}, {0xAA33, 0xAA34, GraphemeBreak::SpacingMark},
+        {0xAA35, 0xAA36, GraphemeBreak::Extend}, {0xAA43, 0xAA43, GraphemeBreak::Extend}, {0xAA4C, 0xAA4C, GraphemeBreak::Extend},
+        {0xAA4D, 0xAA4D, GraphemeBreak::SpacingMark}, {0xAA7C, 0xAA7C, GraphemeBreak::Extend}, {0xAAB0, 0xAAB0, GraphemeBreak::Extend},
+        {0xAAB2, 0xAAB4, GraphemeBreak::Extend}, {0xAAB7, 0xAAB8, GraphemeBreak::Extend}, {0xAABE, 0xAABF, GraphemeBreak::Extend},
+        {0xAAC1, 0xAAC1, GraphemeBreak::Extend}, {0xAAEB, 0xAAEB, GraphemeBreak::SpacingMark}, {0xAAEC, 0xAAED, GraphemeBreak::Extend},
+        {0xAAEE, 0xAAEF, GraphemeBreak::SpacingMark}, {0xAAF5, 0xAAF5, GraphemeBreak::SpacingMark}, {0xAAF6, 0xAAF6, GraphemeBreak::Extend},
+        {0xABE3, 0xABE4, GraphemeBreak::SpacingMark}, {0xABE5, 0xABE5, GraphemeBreak::Extend}, {0xABE6, 0xABE7, GraphemeBreak::SpacingMark},
+        {0xABE8, 0xABE8, GraphemeBreak::Extend}, {0xABE9, 0xABEA, GraphemeBreak::SpacingMark}, {0xABEC, 0xABEC, GraphemeBreak::SpacingMark},
+        {0xABED, 0xABED, GraphemeBreak::Extend}, {0xD800, 0xDFFF, GraphemeBreak::Control}, {0xFB1E, 0xFB1E, GraphemeBreak::Extend},
+        {0xFE00, 0xFE0F, GraphemeBreak::Extend}, {0xFE20, 0xFE2F, GraphemeBreak::Extend}, {0xFEFF, 0xFEFF, GraphemeBreak::Control},
+        {0xFF9E, 0xFF9F, GraphemeBreak::Extend}, {0xFFF9, 0xFFFB, GraphemeBreak::Control}, {0x101FD, 0x101FD, GraphemeBreak::Extend},
+        {0x102E0, 0x102E0, GraphemeBreak::Extend}, {0x10376, 0x1037A, GraphemeBreak::Extend}, {0x10A01, 0x10A0F, GraphemeBreak::Extend},
+        {0x10A38, 0x10A3F, GraphemeBreak::Extend}, {0x10AE5, 0x10AE6, GraphemeBreak::Extend}, {0x10D24, 0x10D27, GraphemeBreak::Extend},
+        {0x10EAB, 0x10EAC, GraphemeBreak::Extend}, {0x10F46, 0x10F50, GraphemeBreak::Extend}, {0x10F82, 0x10F85, GraphemeBreak::Extend},
+        {0x11000, 0x11000, GraphemeBreak::SpacingMark}, {0x11001, 0x11001, GraphemeBreak::Extend}, {0x11002, 0x11002, GraphemeBreak::SpacingMark},
+        {0x11038, 0x11046, GraphemeBreak::Extend}, {0x11070, 0x11070, GraphemeBreak::Extend}, {0x11073, 0x11074, GraphemeBreak::Extend},
+        {0x1107F, 0x11081, GraphemeBreak::Extend}, {0x11082, 0x11082, GraphemeBreak::SpacingMark}, {0x110B0, 0x110B2, GraphemeBreak::SpacingMark},
+        {0x110B3, 0x110B6, GraphemeBreak::Extend}, {0x110B7, 0x110B8, GraphemeBreak::SpacingMark}, {0x110B9, 0x110BA, GraphemeBreak::Extend},
+        {0x110BD, 0x110BD, GraphemeBreak::Prepend}, {0x110C2, 0x110C2, GraphemeBreak::Extend}, {0x110CD, 0x110CD, GraphemeBreak::Prepend},
+        {0x11100, 0x11102, GraphemeBreak::Extend}, {0x11127, 0x1112B, GraphemeBreak::Extend}, {0x1112C, 0x1112C, GraphemeBreak::SpacingMark},
+        {0x1112D, 0x11134, GraphemeBreak::Extend}, {0x11145, 0x11146, GraphemeBreak::SpacingMark}, {0x11173, 0x11173, GraphemeBreak::Extend},
+        {0x11180, 0x11181, GraphemeBreak::Extend}, {0x11182, 0x11182, GraphemeBreak::SpacingMark}, {0x111B3, 0x111B5, GraphemeBreak::SpacingMark},
+        {0x111B6, 0x111BE, GraphemeBreak::Extend}, {0x111BF, 0x111C0, GraphemeBreak::SpacingMark}, {0x111C2, 0x111C3, GraphemeBreak::Prepend},
+        {0x111C9, 0x111CC, GraphemeBreak::Extend}, {0x111CE, 0x111CE, GraphemeBreak::SpacingMark}, {0x111CF, 0x111CF, GraphemeBreak::Extend},
+        {0x1122C, 0x1122E, GraphemeBreak::SpacingMark}, {0x1122F, 0x11231, GraphemeBreak::Extend}, {0x11232, 0x11233, GraphemeBreak::SpacingMark},
+        {0x11234, 0x11234, GraphemeBreak::Extend}, {0x11235, 0x11235, GraphemeBreak::SpacingMark}, {0x11236, 0x11237, GraphemeBreak::Extend},
+        {0x1123E, 0x1123E, GraphemeBreak::Extend}, {0x112DF, 0x112DF, GraphemeBreak::Extend}, {0x112E0, 0x112E2, GraphemeBreak::SpacingMark},
+        {0x112E3, 0x112EA, GraphemeBreak::Extend}, {0x11300, 0x11301, GraphemeBreak::Extend}, {0x11302, 0x11303, GraphemeBreak::SpacingMark},
+        {0x1133B, 0x1133C, GraphemeBreak::Extend}, {0x1133E, 0x1133E, GraphemeBreak::Extend}, {0x1133F, 0x1133F, GraphemeBreak::SpacingMark},
+        {0x11340, 0x11340, GraphemeBreak::Extend}, {0x11341, 0x1134D, GraphemeBreak::SpacingMark}, {0x11357, 0x11357, GraphemeBreak::Extend},
+        {0x11362, 0x11363, GraphemeBreak::SpacingMark}, {0x11366, 0x11374, GraphemeBreak::Extend}, {0x11435, 0x11437, GraphemeBreak::SpacingMark},
+        {0x11438, 0x1143F, GraphemeBreak::Extend}, {0x11440, 0x11441, GraphemeBreak::SpacingMark}, {0x11442, 0x11444, GraphemeBreak::Extend},
+        {0x11445, 0x11445, GraphemeBreak::SpacingMark}, {0x11446, 0x11446, GraphemeBreak::Extend}, {0x1145E, 0x1145E, GraphemeBreak::Extend},
+        {0x114B0, 0x114B0, GraphemeBreak::Extend}, {0x114B1, 0x114B2, GraphemeBreak::SpacingMark}, {0x114B3, 0x114B8, GraphemeBreak::Extend},
+        {0x114B9, 0x114B9, GraphemeBreak::SpacingMark}, {0x114BA, 0x114BA, GraphemeBreak::Extend}, {0x114BB, 0x114BC, GraphemeBreak::SpacingMark},
+        {0x114BD, 0x114BD, GraphemeBreak::Extend}, {0x114BE, 0x114BE, GraphemeBreak::SpacingMark}, {0x114BF, 0x114C0, GraphemeBreak::Extend},
+        {0x114C1, 0x114C1, GraphemeBreak::SpacingMark}, {0x114C2, 0x114C3, GraphemeBreak::Extend}, {0x115AF, 0x115AF, GraphemeBreak::Extend},
+        {0x115B0, 0x115B1, GraphemeBreak::SpacingMark}, {0x115B2, 0x115B5, GraphemeBreak::Extend}, {0x115B8, 0x115BB, GraphemeBreak::SpacingMark},
+        {0x115BC, 0x115BD, GraphemeBreak::Extend}, {0x115BE, 0x115BE, GraphemeBreak::SpacingMark}, {0x115BF, 0x115C0, GraphemeBreak::Extend},
+        {0x115DC, 0x115DD, GraphemeBreak::Extend}, {0x11630, 0x11632, GraphemeBreak::SpacingMark}, {0x11633, 0x1163A, GraphemeBreak::Extend},
+        {0x1163B, 0x1163C, GraphemeBreak::SpacingMark}, {0x1163D, 0x1163D, GraphemeBreak::Extend}, {0x1163E, 0x1163E, GraphemeBreak::SpacingMark},
+        {0x1163F, 0x11640, GraphemeBreak::Extend}, {0x116AB, 0x116AB, GraphemeBreak::Extend}, {0x116AC, 0x116AC, GraphemeBreak::SpacingMark},
+        {0x116AD, 0x116AD, GraphemeBreak::Extend}, {0x116AE, 0x116AF, GraphemeBreak::SpacingMark}, {0x116B0, 0x116B5, GraphemeBreak::Extend},
+        {0x116B6, 0x116B6, GraphemeBreak::SpacingMark}, {0x116B7, 0x116B7, GraphemeBreak::Extend}, {0x1171D, 0x1171F, GraphemeBreak::Extend},
+        {0x11722, 0x11725, GraphemeBreak::Extend}, {0x11726, 0x11726, GraphemeBreak::SpacingMark}, {0x11727, 0x1172B, GraphemeBreak::Extend},
+        {0x1182C, 0x1182E, GraphemeBreak::SpacingMark}, {0x1182F, 0x11837, GraphemeBreak::Extend}, {0x11838, 0x11838, GraphemeBreak::SpacingMark},
+        {0x11839, 0x1183A, GraphemeBreak::Extend}, {0x11930, 0x11930, GraphemeBreak::Extend}, {0x11931, 0x11938, GraphemeBreak::SpacingMark},
+        {0x1193B, 0x1193C, GraphemeBreak::Extend}, {0x1193D, 0x1193D, GraphemeBreak::SpacingMark}, {0x1193E, 0x1193E, GraphemeBreak::Extend},
+        {0x1193F, 0x1193F, GraphemeBreak::Prepend}, {0x11940, 0x11940, GraphemeBreak::SpacingMark}, {0x11941, 0x11941, GraphemeBreak::Prepend},
+        {0x11942, 0x11942, GraphemeBreak::SpacingMark}, {0x11943, 0x11943, GraphemeBreak::Extend}, {0x119D1, 0x119D3, GraphemeBreak::SpacingMark},
+        {0x119D4, 0x119DB, GraphemeBreak::Extend}, {0x119DC, 0x119DF, GraphemeBreak::SpacingMark}, {0x119E0, 0x119E0, GraphemeBreak::Extend},
+        {0x119E4, 0x119E4, GraphemeBreak::SpacingMark}, {0x11A01, 0x11A0A, GraphemeBreak::Extend}, {0x11A33, 0x11A38, GraphemeBreak::Extend},
+        {0x11A39, 0x11A39, GraphemeBreak::SpacingMark}, {0x11A3A, 0x11A3A, GraphemeBreak::Prepend}, {0x11A3B, 0x11A3E, GraphemeBreak::Extend},
+        {0x11A47, 0x11A47, GraphemeBreak::Extend}, {0x11A51, 0x11A56, GraphemeBreak::Extend}, {0x11A57, 0x11A58, GraphemeBreak::SpacingMark},
+        {0x11A59, 0x11A5B, GraphemeBreak::Extend}, {0x11A84, 0x11A89, GraphemeBreak::Prepend}, {0x11A8A, 0x11A96, GraphemeBreak::Extend},
+        {0x11A97, 0x11A97, GraphemeBreak::SpacingMark}, {0x11A98, 0x11A99, GraphemeBreak::Extend}, {0x11C2F, 0x11C2F, GraphemeBreak::SpacingMark},
+        {0x11C30, 0x11C3D, GraphemeBreak::Extend}, {0x11C3E, 0x11C3E, GraphemeBreak::SpacingMark}, {0x11C3F, 0x11C3F, GraphemeBreak::Extend},
+        {0x11C92, 0x11CA7, GraphemeBreak::Extend}, {0x11CA9, 0x11CA9, GraphemeBreak::SpacingMark}, {0x11CAA, 0x11CB0, GraphemeBreak::Extend},
+        {0x11CB1, 0x11CB1, GraphemeBreak::SpacingMark}, {0x11CB2, 0x11CB3, GraphemeBreak::Extend}, {0x11CB4, 0x11CB4, GraphemeBreak::SpacingMark},
+        {0x11CB5, 0x11CB6, GraphemeBreak::Extend}, {0x11D31, 0x11D45, GraphemeBreak::Extend}, {0x11D46, 0x11D46, GraphemeBreak::Prepend},
+        {0x11D47, 0x11D47, GraphemeBreak::Extend}, {0x11D8A, 0x11D8E, GraphemeBreak::SpacingMark}, {0x11D90, 0x11D91, GraphemeBreak::Extend},
+        {0x11D93, 0x11D94, GraphemeBreak::SpacingMark}, {0x11D95, 0x11D95, GraphemeBreak::Extend}, {0x11D96, 0x11D96, GraphemeBreak::SpacingMark},
+        {0x11D97, 0x11D97, GraphemeBreak::Extend}, {0x11EF3, 0x11EF4, GraphemeBreak::Extend}, {0x11EF5, 0x11EF6, GraphemeBreak::SpacingMark},
+        {0x13430, 0x13438, GraphemeBreak::Control}, {0x16AF0, 0x16AF4, GraphemeBreak::Extend}, {0x16B30, 0x16B36, GraphemeBreak::Extend},
+        {0x16F4F, 0x16F4F, GraphemeBreak::Extend}, {0x16F51, 0x16F87, GraphemeBreak::SpacingMark}, {0x16F8F, 0x16F92, GraphemeBreak::Extend},
+        {0x16FE4, 0x16FE4, GraphemeBreak::Extend}, {0x16FF0, 0x16FF1, GraphemeBreak::SpacingMark}, {0x1BC9D, 0x1BC9E, GraphemeBreak::Extend},
+        {0x1BCA0, 0x1BCA3, GraphemeBreak::Control}, {0x1CF00, 0x1CF46, GraphemeBreak::Extend}, {0x1D165, 0x1D165, GraphemeBreak::Extend},
+        {0x1D166, 0x1D166, GraphemeBreak::SpacingMark}, {0x1D167, 0x1D169, GraphemeBreak::Extend}, {0x1D16D, 0x1D16D, GraphemeBreak::SpacingMark},
+        {0x1D16E, 0x1D172, GraphemeBreak::Extend}, {0x1D173, 0x1D17A, GraphemeBreak::Control}, {0x1D17B, 0x1D182, GraphemeBreak::Extend},
+        {0x1D185, 0x1D18B, GraphemeBreak::Extend}, {0x1D1AA, 0x1D1AD, GraphemeBreak::Extend}, {0x1D242, 0x1D244, GraphemeBreak::Extend},
+        {0x1DA00, 0x1DA36, GraphemeBreak::Extend}, {0x1DA3B, 0x1DA6C, GraphemeBreak::Extend}, {0x1DA75, 0x1DA75, GraphemeBreak::Extend},
+        {0x1DA84, 0x1DA84, GraphemeBreak::Extend}, {0x1DA9B, 0x1DAAF, GraphemeBreak::Extend}, {0x1E000, 0x1E02A, GraphemeBreak::Extend},
+        {0x1E130, 0x1E136, GraphemeBreak::Extend}, {0x1E2AE, 0x1E2AE, GraphemeBreak::Extend}, {0x1E2EC, 0x1E2EF, GraphemeBreak::Extend},
+        {0x1E8D0, 0x1E8D6, GraphemeBreak::Extend}, {0x1E944, 0x1E94A, GraphemeBreak::Extend}, {0x1F000, 0x1F0FF, GraphemeBreak::ExtendedPictographic},
+        {0x1F10D, 0x1F10F, GraphemeBreak::ExtendedPictographic}, {0x1F12F, 0x1F12F, GraphemeBreak::ExtendedPictographic}, {0x1F16C, 0x1F171, GraphemeBreak::ExtendedPictographic},
+        {0x1F17E, 0x1F17F, GraphemeBreak::ExtendedPictographic}, {0x1F18E, 0x1F18E, GraphemeBreak::ExtendedPictographic}, {0x1F191, 0x1F19A, GraphemeBreak::ExtendedPictographic},
+        {0x1F1AD, 0x1F1E5, GraphemeBreak::ExtendedPictographic}, {0x1F1E6, 0x1F1FF, GraphemeBreak::RegionalIndicator}, {0x1F201, 0x1F20F, GraphemeBreak::ExtendedPictographic},
+        {0x1F21A, 0x1F21A, GraphemeBreak::ExtendedPictographic}, {0x1F22F, 0x1F22F, GraphemeBreak::ExtendedPictographic}, {0x1F232, 0x1F23A, GraphemeBreak::ExtendedPictographic},
+        {0x1F23C, 0x1F23F, GraphemeBreak::ExtendedPictographic}, {0x1F249, 0x1F3FA, GraphemeBreak::ExtendedPictographic}, {0x1F3FB, 0x1F3FF, GraphemeBreak::Extend},
+        {0x1F400, 0x1F53D, GraphemeBreak::ExtendedPictographic}, {0x1F546, 0x1F64F, GraphemeBreak::ExtendedPictographic}, {0x1F680, 0x1F6FF, GraphemeBreak::ExtendedPictographic},
+        {0x1F774, 0x1F77F, GraphemeBreak::ExtendedPictographic}, {0x1F7D5, 0x1F7FF, GraphemeBreak::ExtendedPictographic}, {0x1F80C, 0x1F80F, GraphemeBreak::ExtendedPictographic},
+        {0x1F848, 0x1F84F, GraphemeBreak::ExtendedPictographic}, {0x1F85A, 0x1F85F, GraphemeBreak::ExtendedPictographic}, {0x1F888, 0x1F88F, GraphemeBreak::ExtendedPictographic},
+        {0x1F8AE, 0x1F8FF, GraphemeBreak::ExtendedPictographic}, {0x1F90C, 0x1F93A, GraphemeBreak::ExtendedPictographic}, {0x1F93C, 0x1F945, GraphemeBreak::ExtendedPictographic},
+        {0x1F947, 0x1FAFF, GraphemeBreak::ExtendedPictographic}, {0x1FC00, 0x1FFFD, GraphemeBreak::ExtendedPictographic}, {0xE0001, 0xE0001, GraphemeBreak::Control},
+        {0xE0020, 0xE01EF, GraphemeBreak::Extend},
+    };
+
+    /**
+     * @brief East_Asian_Width Wide and Fullwidth code points (two terminal columns)
+     */
+    inline constexpr UnicodeRange wideRanges[] = {
+        {0x1100, 0x115F, 1}, {0x231A, 0x231B, 1}, {0x2329, 0x232A, 1}, {0x23E9, 0x23EC, 1}, {0x23F0, 0x23F0, 1},
+        {0x23F3, 0x23F3, 1}, {0x25FD, 0x25FE, 1}, {0x2614, 0x2615, 1}, {0x2648, 0x2653, 1}, {0x267F, 0x267F, 1},
+        {0x2693, 0x2693, 1}, {0x26A1, 0x26A1, 1}, {0x26AA, 0x26AB, 1}, {0x26BD, 0x26BE, 1}, {0x26C4, 0x26C5, 1},
+        {0x26CE, 0x26CE, 1}, {0x26D4, 0x26D4, 1}, {0x26EA, 0x26EA, 1}, {0x26F2, 0x26F3, 1}, {0x26F5, 0x26F5, 1},
+        {0x26FA, 0x26FA, 1}, {0x26FD, 0x26FD, 1}, {0x2705, 0x2705, 1}, {0x270A, 0x270B, 1}, {0x2728, 0x2728, 1},
+        {0x274C, 0x274C, 1}, {0x274E, 0x274E, 1}, {0x2753, 0x2755, 1}, {0x2757, 0x2757, 1}, {0x2795, 0x2797, 1},
+        {0x27B0, 0x27B0, 1}, {0x27BF, 0x27BF, 1}, {0x2B1B, 0x2B1C, 1}, {0x2B50, 0x2B50, 1}, {0x2B55, 0x2B55, 1},
+        {0x2E80, 0x303E, 1}, {0x3041, 0x3247, 1}, {0x3250, 0x4DBF, 1}, {0x4E00, 0xA4C6, 1}, {0xA960, 0xA97C, 1},
+        {0xAC00, 0xD7A3, 1}, {0xF900, 0xFAFF, 1}, {0xFE10, 0xFE19, 1}, {0xFE30, 0xFE6B, 1}, {0xFF01, 0xFF60, 1},
+        {0xFFE0, 0xFFE6, 1}, {0x16FE0, 0x1B2FB, 1}, {0x1F004, 0x1F004, 1}, {0x1F0CF, 0x1F0CF, 1}, {0x1F18E, 0x1F18E, 1},
+        {0x1F191, 0x1F19A, 1}, {0x1F200, 0x1F320, 1}, {0x1F32D, 0x1F335, 1}, {0x1F337, 0x1F37C, 1}, {0x1F37E, 0x1F393, 1},
+        {0x1F3A0, 0x1F3CA, 1}, {0x1F3CF, 0x1F3D3, 1}, {0x1F3E0, 0x1F3F0, 1}, {0x1F3F4, 0x1F3F4, 1}, {0x1F3F8, 0x1F43E, 1},
+        {0x1F440, 0x1F440, 1}, {0x1F442, 0x1F4FC, 1}, {0x1F4FF, 0x1F53D, 1}, {0x1F54B, 0x1F54E, 1}, {0x1F550, 0x1F567, 1},
+        {0x1F57A, 0x1F57A, 1}, {0x1F595, 0x1F596, 1}, {0x1F5A4, 0x1F5A4, 1}, {0x1F5FB, 0x1F64F, 1}, {0x1F680, 0x1F6C5, 1},
+        {0x1F6CC, 0x1F6CC, 1}, {0x1F6D0, 0x1F6D2, 1}, {0x1F6D5, 0x1F6DF, 1}, {0x1F6EB, 0x1F6EC, 1}, {0x1F6F4, 0x1F6FC, 1},
+        {0x1F7E0, 0x1F7F0, 1}, {0x1F90C, 0x1F93A, 1}, {0x1F93C, 0x1F945, 1}, {0x1F947, 0x1F9FF, 1}, {0x1FA70, 0x1FAF6, 1},
+        {0x20000, 0x3FFFD, 1},
+    };
+
+    /**
+     * @brief Strong bidirectional classes: L, and R or AL
+     */
+    inline constexpr UnicodeRange strongBidiRanges[] = {
+        {0x0041, 0x005A, TextDirection::LeftToRight}, {0x0061, 0x007A, TextDirection::LeftToRight}, {0x00AA, 0x00AA, TextDirection::LeftToRight},
+        {0x00B5, 0x00B5, TextDirection::LeftToRight}, {0x00BA, 0x00BA, TextDirection::LeftToRight}, {0x00C0, 0x00D6, TextDirection::LeftToRight},
+        {0x00D8, 0x00F6, TextDirection::LeftToRight}, {0x00F8, 0x02B8, TextDirection::LeftToRight}, {0x02BB, 0x02C1, TextDirection::LeftToRight},
+        {0x02D0, 0x02D1, TextDirection::LeftToRight}, {0x02E0, 0x02E4, TextDirection::LeftToRight}, {0x02EE, 0x02EE, TextDirection::LeftToRight},
+        {0x0370, 0x0373, TextDirection::LeftToRight}, {0x0376, 0x037D, TextDirection::LeftToRight}, {0x037F, 0x037F, TextDirection::LeftToRight},
+        {0x0386, 0x0386, TextDirection::LeftToRight}, {0x0388, 0x03F5, TextDirection::LeftToRight}, {0x03F7, 0x0482, TextDirection::LeftToRight},
+        {0x048A, 0x0589, TextDirection::LeftToRight}, {0x05BE, 0x05BE, TextDirection::RightToLeft}, {0x05C0, 0x05C0, TextDirection::RightToLeft},
+        {0x05C3, 0x05C3, TextDirection::RightToLeft}, {0x05C6, 0x05C6, TextDirection::RightToLeft}, {0x05D0, 0x05F4, TextDirection::RightToLeft},
+        {0x0608, 0x0608, TextDirection::RightToLeft}, {0x060B, 0x060B, TextDirection::RightToLeft}, {0x060D, 0x060D, TextDirection::RightToLeft},
+        {0x061B, 0x064A, TextDirection::RightToLeft}, {0x066D, 0x066F, TextDirection::RightToLeft}, {0x0671, 0x06D5, TextDirection::RightToLeft},
+        {0x06E5, 0x06E6, TextDirection::RightToLeft}, {0x06EE, 0x06EF, TextDirection::RightToLeft}, {0x06FA, 0x0710, TextDirection::RightToLeft},
+        {0x0712, 0x072F, TextDirection::RightToLeft}, {0x074D, 0x07A5, TextDirection::RightToLeft}, {0x07B1, 0x07EA, TextDirection::RightToLeft},
+        {0x07F4, 0x07F5, TextDirection::RightToLeft}, {0x07FA, 0x07FA, TextDirection::RightToLeft}, {0x07FE, 0x0815, TextDirection::RightToLeft},
+        {0x081A, 0x081A, TextDirection::RightToLeft}, {0x0824, 0x0824, TextDirection::RightToLeft}, {0x0828, 0x0828, TextDirection::RightToLeft},
+        {0x0830, 0x0858, TextDirection::RightToLeft}, {0x085E, 0x088E, TextDirection::RightToLeft}, {0x08A0, 0x08C9, TextDirection::RightToLeft},
+        {0x0903, 0x0939, TextDirection::LeftToRight}, {0x093B, 0x093B, TextDirection::LeftToRight}, {0x093D, 0x0940, TextDirection::LeftToRight},
+        {0x0949, 0x094C, TextDirection::LeftToRight}, {0x094E, 0x0950, TextDirection::LeftToRight}, {0x0958, 0x0961, TextDirection::LeftToRight},
+        {0x0964, 0x0980, TextDirection::LeftToRight}, {0x0982, 0x09B9, TextDirection::LeftToRight}, {0x09BD, 0x09C0, TextDirection::LeftToRight},
+        {0x09C7, 0x09CC, TextDirection::LeftToRight}, {0x09CE, 0x09E1, TextDirection::LeftToRight}, {0x09E6, 0x09F1, TextDirection::LeftToRight},
+        {0x09F4, 0x09FA, TextDirection::LeftToRight}, {0x09FC, 0x09FD, TextDirection::LeftToRight}, {0x0A03, 0x0A39, TextDirection::LeftToRight},
+        {0x0A3E, 0x0A40, TextDirection::LeftToRight}, {0x0A59, 0x0A6F, TextDirection::LeftToRight}, {0x0A72, 0x0A74, TextDirection::LeftToRight},
+        {0x0A76, 0x0A76, TextDirection::LeftToRight}, {0x0A83, 0x0AB9, TextDirection::LeftToRight}, {0x0ABD, 0x0AC0, TextDirection::LeftToRight},
+        {0x0AC9, 0x0ACC, TextDirection::LeftToRight}, {0x0AD0, 0x0AE1, TextDirection::LeftToRight}, {0x0AE6, 0x0AF0, TextDirection::LeftToRight},
+        {0x0AF9, 0x0AF9, TextDirection::LeftToRight}, {0x0B02, 0x0B39, TextDirection::LeftToRight}, {0x0B3D, 0x0B3E, TextDirection::LeftToRight},
+        {0x0B40, 0x0B40, TextDirection::LeftToRight}, {0x0B47, 0x0B4C, TextDirection::LeftToRight}, {0x0B57, 0x0B61, TextDirection::LeftToRight},
+        {0x0B66, 0x0B77, TextDirection::LeftToRight}, {0x0B83, 0x0BBF, TextDirection::LeftToRight}, {0x0BC1, 0x0BCC, TextDirection::LeftToRight},
+        {0x0BD0, 0x0BF2, TextDirection::LeftToRight}, {0x0C01, 0x0C03, TextDirection::LeftToRight}, {0x0C05, 0x0C39, TextDirection::LeftToRight},
+        {0x0C3D, 0x0C3D, TextDirection::LeftToRight}, {0x0C41, 0x0C44, TextDirection::LeftToRight}, {0x0C58, 0x0C61, TextDirection::LeftToRight},
+        {0x0C66, 0x0C77, TextDirection::LeftToRight}, {0x0C7F, 0x0C80, TextDirection::LeftToRight}, {0x0C82, 0x0CB9, TextDirection::LeftToRight},
+        {0x0CBD, 0x0CCB, TextDirection::LeftToRight}, {0x0CD5, 0x0CE1, TextDirection::LeftToRight}, {0x0CE6, 0x0CF2, TextDirection::LeftToRight},
+        {0x0D02, 0x0D3A, TextDirection::LeftToRight}, {0x0D3D, 0x0D40, TextDirection::LeftToRight}, {0x0D46, 0x0D4C, TextDirection::LeftToRight},
+        {0x0D4E, 0x0D61, TextDirection::LeftToRight}, {0x0D66, 0x0D7F, TextDirection::LeftToRight}, {0x0D82, 0x0DC6, TextDirection::LeftToRight},
+        {0x0DCF, 0x0DD1, TextDirection::LeftToRight}, {0x0DD8, 0x0E30, TextDirection::LeftToRight}, {0x0E32, 0x0E33, TextDirection::LeftToRight},
+        {0x0E40, 0x0E46, TextDirection::LeftToRight}, {0x0E4F, 0x0EB0, TextDirection::LeftToRight}, {0x0EB2, 0x0EB3, TextDirection::LeftToRight},
+        {0x0EBD, 0x0EC6, TextDirection::LeftToRight}, {0x0ED0, 0x0F17, TextDirection::LeftToRight}, {0x0F1A, 0x0F34, TextDirection::LeftToRight},
+        {0x0F36, 0x0F36, TextDirection::LeftToRight}, {0x0F38, 0x0F38, TextDirection::LeftToRight}, {0x0F3E, 0x0F6C, TextDirection::LeftToRight},
+        {0x0F7F, 0x0F7F, TextDirection::LeftToRight}, {0x0F85, 0x0F85, TextDirection::LeftToRight}, {0x0F88, 0x0F8C, TextDirection::LeftToRight},
+        {0x0FBE, 0x0FC5, TextDirection::LeftToRight}, {0x0FC7, 0x102C, TextDirection::LeftToRight}, {0x1031, 0x1031, TextDirection::LeftToRight},
+        {0x1038, 0x1038, TextDirection::LeftToRight}, {0x103B, 0x103C, TextDirection::LeftToRight}, {0x103F, 0x1057, TextDirection::LeftToRight},
+        {0x105A, 0x105D, TextDirection::LeftToRight}, {0x1061, 0x1070, TextDirection::LeftToRight}, {0x1075, 0x1081, TextDirection::LeftToRight},
+        {0x1083, 0x1084, TextDirection::LeftToRight}, {0x1087, 0x108C, TextDirection::LeftToRight}, {0x108E, 0x109C, TextDirection::LeftToRight},
+        {0x109E, 0x135A, TextDirection::LeftToRight}, {0x1360, 0x138F, TextDirection::LeftToRight}, {0x13A0, 0x13FD, TextDirection::LeftToRight},
+        {0x1401, 0x167F, TextDirection::LeftToRight}, {0x1681, 0x169A, TextDirection::LeftToRight}, {0x16A0, 0x1711, TextDirection::LeftToRight},
+        {0x1715, 0x1731, TextDirection::LeftToRight}, {0x1734, 0x1751, TextDirection::LeftToRight}, {0x1760, 0x1770, TextDirection::LeftToRight},
+        {0x1780, 0x17B3, TextDirection::LeftToRight}, {0x17B6, 0x17B6, TextDirection::LeftToRight}, {0x17BE, 0x17C5, TextDirection::LeftToRight},
+        {0x17C7, 0x17C8, TextDirection::LeftToRight}, {0x17D4, 0x17DA, TextDirection::LeftToRight}, {0x17DC, 0x17DC, TextDirection::LeftToRight},
+        {0x17E0, 0x17E9, TextDirection::LeftToRight}, {0x1810, 0x1884, TextDirection::LeftToRight}, {0x1887, 0x18A8, TextDirection::LeftToRight},
+        {0x18AA, 0x191E, TextDirection::LeftToRight}, {0x1923, 0x1926, TextDirection::LeftToRight}, {0x1929, 0x1931, TextDirection::LeftToRight},
+        {0x1933, 0x1938, TextDirection::LeftToRight}, {0x1946, 0x19DA, TextDirection::LeftToRight}, {0x1A00, 0x1A16, TextDirection::LeftToRight},
+        {0x1A19, 0x1A1A, TextDirection::LeftToRight}, {0x1A1E, 0x1A55, TextDirection::LeftToRight}, {0x1A57, 0x1A57, TextDirection::LeftToRight},
+        {0x1A61, 0x1A61, TextDirection::LeftToRight}, {0x1A63, 0x1A64, TextDirection::LeftToRight}, {0x1A6D, 0x1A72, TextDirection::LeftToRight},
+        {0x1A80, 0x1AAD, TextDirection::LeftToRight}, {0x1B04, 0x1B33, TextDirection::LeftToRight}, {0x1B35, 0x1B35, TextDirection::LeftToRight},
+        {0x1B3B, 0x1B3B, TextDirection::LeftToRight}, {0x1B3D, 0x1B41, TextDirection::LeftToRight}, {0x1B43, 0x1B6A, TextDirection::LeftToRight},
+        {0x1B74, 0x1B7E, TextDirection::LeftToRight}, {0x1B82, 0x1BA1, TextDirection::LeftToRight}, {0x1BA6, 0x1BA7, TextDirection::LeftToRight},
+        {0x1BAA, 0x1BAA, TextDirection::LeftToRight}, {0x1BAE, 0x1BE5, TextDirection::LeftToRight}, {0x1BE7, 0x1BE7, TextDirection::LeftToRight},
+        {0x1BEA, 0x1BEC, TextDirection::LeftToRight}, {0x1BEE, 0x1BEE, TextDirection::LeftToRight}, {0x1BF2, 0x1C2B, TextDirection::LeftToRight},
+        {0x1C34, 0x1C35, TextDirection::LeftToRight}, {0x1C3B, 0x1CC7, TextDirection::LeftToRight}, {0x1CD3, 0x1CD3, TextDirection::LeftToRight},
+        {0x1CE1, 0x1CE1, TextDirection::LeftToRight}, {0x1CE9, 0x1CEC, TextDirection::LeftToRight}, {0x1CEE, 0x1CF3, TextDirection::LeftToRight},
+        {0x1CF5, 0x1CF7, TextDirection::LeftToRight}, {0x1CFA, 0x1DBF, TextDirection::LeftToRight}, {0x1E00, 0x1FBC, TextDirection::LeftToRight},
+        {0x1FBE, 0x1FBE, TextDirection::LeftToRight}, {0x1FC2, 0x1FCC, TextDirection::LeftToRight}, {0x1FD0, 0x1FDB, TextDirection::LeftToRight},
+        {0x1FE0, 0x1FEC, TextDirection::LeftToRight}, {0x1FF2, 0x1FFC, TextDirection::LeftToRight}, {0x200E, 0x200E, TextDirection::LeftToRight},
+        {0x200F, 0x200F, TextDirection::RightToLeft}, {0x2071, 0x2071, TextDirection::LeftToRight}, {0x207F, 0x207F, TextDirection::LeftToRight},
+        {0x2090, 0x209C, TextDirection::LeftToRight}, {0x2102, 0x2102, TextDirection::LeftToRight}, {0x2107, 0x2107, TextDirection::LeftToRight},
+        {0x210A, 0x2113, TextDirection::LeftToRight}, {0x2115, 0x2115, TextDirection::LeftToRight}, {0x2119, 0x211D, TextDirection::LeftToRight},
+        {0x2124, 0x2124, TextDirection::LeftToRight}, {0x2126, 0x2126, TextDirection::LeftToRight}, {0x2128, 0x2128, TextDirection::LeftToRight},
+        {0x212A, 0x212D, TextDirection::LeftToRight}, {0x212F, 0x2139, TextDirection::LeftToRight}, {0x213C, 0x213F, TextDirection::LeftToRight},
+        {0x2145, 0x2149, TextDirection::LeftToRight}, {0x214E, 0x214F, TextDirection::LeftToRight}, {0x2160, 0x2188, TextDirection::LeftToRight},
+        {0x2336, 0x237A, TextDirection::LeftToRight}, {0x2395, 0x2395, TextDirection::LeftToRight}, {0x249C, 0x24E9, TextDirection::LeftToRight},
+        {0x26AC, 0x26AC, TextDirection::LeftToRight}, {0x2800, 0x28FF, TextDirection::LeftToRight}, {0x2C00, 0x2CE4, TextDirection::LeftToRight},
+        {0x2CEB, 0x2CEE, TextDirection::LeftToRight}, {0x2CF2, 0x2CF3, TextDirection::LeftToRight}, {0x2D00, 0x2D70, TextDirection::LeftToRight},
+        {0x2D80, 0x2DDE, TextDirection::LeftToRight}, {0x3005, 0x3007, TextDirection::LeftToRight}, {0x3021, 0x3029, TextDirection::LeftToRight},
+        {0x302E, 0x302F, TextDirection::LeftToRight}, {0x3031, 0x3035, TextDirection::LeftToRight}, {0x3038, 0x303C, TextDirection::LeftToRight},
+        {0x3041, 0x3096, TextDirection::LeftToRight}, {0x309D, 0x309F, TextDirection::LeftToRight}, {0x30A1, 0x30FA, TextDirection::LeftToRight},
+        {0x30FC, 0x31BF, TextDirection::LeftToRight}, {0x31F0, 0x321C, TextDirection::LeftToRight}, {0x3220, 0x324F, TextDirection::LeftToRight},
+        {0x3260, 0x327B, TextDirection::LeftToRight}, {0x327F, 0x32B0, TextDirection::LeftToRight}, {0x32C0, 0x32CB, TextDirection::LeftToRight},
+        {0x32D0, 0x3376, TextDirection::LeftToRight}, {0x337B, 0x33DD, TextDirection::LeftToRight}, {0x33E0, 0x33FE, TextDirection::LeftToRight},
+        {0x3400, 0x4DBF, TextDirection::LeftToRight}, {0x4E00, 0xA48C, TextDirection::LeftToRight}, {0xA4D0, 0xA60C, TextDirection::LeftToRight},
+        {0xA610, 0xA66E, TextDirection::LeftToRight}, {0xA680, 0xA69D, TextDirection::LeftToRight}, {0xA6A0, 0xA6EF, TextDirection::LeftToRight},
+        {0xA6F2, 0xA6F7, TextDirection::LeftToRight}, {0xA722, 0xA787, TextDirection::LeftToRight}, {0xA789, 0xA801, TextDirection::LeftToRight},
+        {0xA803, 0xA805, TextDirection::LeftToRight}, {0xA807, 0xA80A, TextDirection::LeftToRight}, {0xA80C, 0xA824, TextDirection::LeftToRight},
+        {0xA827, 0xA827, TextDirection::LeftToRight}, {0xA830, 0xA837, TextDirection::LeftToRight}, {0xA840, 0xA873, TextDirection::LeftToRight},
+        {0xA880, 0xA8C3, TextDirection::LeftToRight}, {0xA8CE, 0xA8D9, TextDirection::LeftToRight}, {0xA8F2, 0xA8FE, TextDirection::LeftToRight},
+        {0xA900, 0xA925, TextDirection::LeftToRight}, {0xA92E, 0xA946, TextDirection::LeftToRight}, {0xA952, 0xA97C, TextDirection::LeftToRight},
+        {0xA983, 0xA9B2, TextDirection::LeftToRight}, {0xA9B4, 0xA9B5, TextDirection::LeftToRight}, {0xA9BA, 0xA9BB, TextDirection::LeftToRight},
+        {0xA9BE, 0xA9E4, TextDirection::LeftToRight}, {0xA9E6, 0xAA28, TextDirection::LeftToRight}, {0xAA2F, 0xAA30, TextDirection::LeftToRight},
+        {0xAA33, 0xAA34, TextDirection::LeftToRight}, {0xAA40, 0xAA42, TextDirection::LeftToRight}, {0xAA44, 0xAA4B, TextDirection::LeftToRight},
+        {0xAA4D, 0xAA7B, TextDirection::LeftToRight}, {0xAA7D, 0xAAAF, TextDirection::LeftToRight}, {0xAAB1, 0xAAB1, TextDirection::LeftToRight},
+        {0xAAB5, 0xAAB6, TextDirection::LeftToRight}, {0xAAB9, 0xAABD, TextDirection::LeftToRight}, {0xAAC0, 0xAAC0, TextDirection::LeftToRight},
+        {0xAAC2, 0xAAEB, TextDirection::LeftToRight}, {0xAAEE, 0xAAF5, TextDirection::LeftToRight}, {0xAB01, 0xAB69, TextDirection::LeftToRight},
+        {0xAB70, 0xABE4, TextDirection::LeftToRight}, {0xABE6, 0xABE7, TextDirection::LeftToRight}, {0xABE9, 0xABEC, TextDirection::LeftToRight},
+        {0xABF0, 0xFB17, TextDirection::LeftToRight}, {0xFB1D, 0xFB1D, TextDirection::RightToLeft}, {0xFB1F, 0xFB28, TextDirection::RightToLeft},
+        {0xFB2A, 0xFD3D, TextDirection::RightToLeft}, {0xFD50, 0xFDC7, TextDirection::RightToLeft}, {0xFDF0, 0xFDFC, TextDirection::RightToLeft},
+        {0xFE70, 0xFEFC, TextDirection::RightToLeft}, {0xFF21, 0xFF3A, TextDirection::LeftToRight}, {0xFF41, 0xFF5A, TextDirection::LeftToRight},
+        {0xFF66, 0xFFDC, TextDirection::LeftToRight}, {0x10000, 0x10100, TextDirection::LeftToRight}, {0x10102, 0x1013F, TextDirection::LeftToRight},
+        {0x1018D, 0x1018E, TextDirection::LeftToRight}, {0x101D0, 0x101FC, TextDirection::LeftToRight}, {0x10280, 0x102D0, TextDirection::LeftToRight},
+        {0x10300, 0x10375, TextDirection::LeftToRight}, {0x10380, 0x107BA, TextDirection::LeftToRight}, {0x10800, 0x1091B, TextDirection::RightToLeft},
+        {0x10920, 0x10A00, TextDirection::RightToLeft}, {0x10A10, 0x10A35, TextDirection::RightToLeft}, {0x10A40, 0x10AE4, TextDirection::RightToLeft},
+        {0x10AEB, 0x10B35, TextDirection::RightToLeft}, {0x10B40, 0x10D23, TextDirection::RightToLeft}, {0x10E80, 0x10EA9, TextDirection::RightToLeft},
+        {0x10EAD, 0x10F45, TextDirection::RightToLeft}, {0x10F51, 0x10F81, TextDirection::RightToLeft}, {0x10F86, 0x10FF6, TextDirection::RightToLeft},
+        {0x11000, 0x11000, TextDirection::LeftToRight}, {0x11002, 0x11037, TextDirection::LeftToRight}, {0x11047, 0x1104D, TextDirection::LeftToRight},
+        {0x11066, 0x1106F, TextDirection::LeftToRight}, {0x11071, 0x11072, TextDirection::LeftToRight}, {0x11075, 0x11075, TextDirection::LeftToRight},
+        {0x11082, 0x110B2, TextDirection::LeftToRight}, {0x110B7, 0x110B8, TextDirection::LeftToRight}, {0x110BB, 0x110C1, TextDirection::LeftToRight},
+        {0x110CD, 0x110F9, TextDirection::LeftToRight}, {0x11103, 0x11126, TextDirection::LeftToRight}, {0x1112C, 0x1112C, TextDirection::LeftToRight},
+        {0x11136, 0x11172, TextDirection::LeftToRight}, {0x11174, 0x11176, TextDirection::LeftToRight}, {0x11182, 0x111B5, TextDirection::LeftToRight},
+        {0x111BF, 0x111C8, TextDirection::LeftToRight}, {0x111CD, 0x111CE, TextDirection::LeftToRight}, {0x111D0, 0x1122E, TextDirection::LeftToRight},
+        {0x11232, 0x11233, TextDirection::LeftToRight}, {0x11235, 0x11235, TextDirection::LeftToRight}, {0x11238, 0x1123D, TextDirection::LeftToRight},
+        {0x11280, 0x112DE, TextDirection::LeftToRight}, {0x112E0, 0x112E2, TextDirection::LeftToRight}, {0x112F0, 0x112F9, TextDirection::LeftToRight},
+        {0x11302, 0x11339, TextDirection::LeftToRight}, {0x1133D, 0x1133F, TextDirection::LeftToRight}, {0x11341, 0x11363, TextDirection::LeftToRight},
+        {0x11400, 0x11437, TextDirection::LeftToRight}, {0x11440, 0x11441, TextDirection::LeftToRight}, {0x11445, 0x11445, TextDirection::LeftToRight},
+        {0x11447, 0x1145D, TextDirection::LeftToRight}, {0x1145F, 0x114B2, TextDirection::LeftToRight}, {0x114B9, 0x114B9, TextDirection::LeftToRight},
+        {0x114BB, 0x114BE, TextDirection::LeftToRight}, {0x114C1, 0x114C1, TextDirection::LeftToRight}, {0x114C4, 0x115B1, TextDirection::LeftToRight},
+        {0x115B8, 0x115BB, TextDirection::LeftToRight}, {0x115BE, 0x115BE, TextDirection::LeftToRight}, {0x115C1, 0x115DB, TextDirection::LeftToRight},
+        {0x11600, 0x11632, TextDirection::LeftToRight}, {0x1163B, 0x1163C, TextDirection::LeftToRight}, {0x1163E, 0x1163E, TextDirection::LeftToRight},
+        {0x11641, 0x11659, TextDirection::LeftToRight}, {0x11680, 0x116AA, TextDirection::LeftToRight}, {0x116AC, 0x116AC, TextDirection::LeftToRight},
+        {0x116AE, 0x116AF, TextDirection::LeftToRight}, {0x116B6, 0x116B6, TextDirection::LeftToRight}, {0x116B8, 0x1171A, TextDirection::LeftToRight},
+        {0x11720, 0x11721, TextDirection::LeftToRight}, {0x11726, 0x11726, TextDirection::LeftToRight}, {0x11730, 0x1182E, TextDirection::LeftToRight},
+        {0x11838, 0x11838, TextDirection::LeftToRight}, {0x1183B, 0x11938, TextDirection::LeftToRight}, {0x1193D, 0x1193D, TextDirection::LeftToRight},
+        {0x1193F, 0x11942, TextDirection::LeftToRight}, {0x11944, 0x119D3, TextDirection::LeftToRight}, {0x119DC, 0x119DF, TextDirection::LeftToRight},
+        {0x119E1, 0x11A00, TextDirection::LeftToRight}, {0x11A07, 0x11A08, TextDirection::LeftToRight}, {0x11A0B, 0x11A32, TextDirection::LeftToRight},
+        {0x11A39, 0x11A3A, TextDirection::LeftToRight}, {0x11A3F, 0x11A46, TextDirection::LeftToRight}, {0x11A50, 0x11A50, TextDirection::LeftToRight},
+        {0x11A57, 0x11A58, TextDirection::LeftToRight}, {0x11A5C, 0x11A89, TextDirection::LeftToRight}, {0x11A97, 0x11A97, TextDirection::LeftToRight},
+        {0x11A9A, 0x11C2F, TextDirection::LeftToRight}, {0x11C3E, 0x11C8F, TextDirection::LeftToRight}, {0x11CA9, 0x11CA9, TextDirection::LeftToRight},
+        {0x11CB1, 0x11CB1, TextDirection::LeftToRight}, {0x11CB4, 0x11CB4, TextDirection::LeftToRight}, {0x11D00, 0x11D30, TextDirection::LeftToRight},
+        {0x11D46, 0x11D46, TextDirection::LeftToRight}, {0x11D50, 0x11D8E, TextDirection::LeftToRight}, {0x11D93, 0x11D94, TextDirection::LeftToRight},
+        {0x11D96, 0x11D96, TextDirection::LeftToRight}, {0x11D98, 0x11EF2, TextDirection::LeftToRight}, {0x11EF5, 0x11FD4, TextDirection::LeftToRight},
+        {0x11FFF, 0x16AED, TextDirection::LeftToRight}, {0x16AF5, 0x16B2F, TextDirection::LeftToRight}, {0x16B37, 0x16F4A, TextDirection::LeftToRight},
+        {0x16F50, 0x16F87, TextDirection::LeftToRight}, {0x16F93, 0x16FE1, TextDirection::LeftToRight}, {0x16FE3, 0x16FE3, TextDirection::LeftToRight},
+        {0x16FF0, 0x1BC9C, TextDirection::LeftToRight}, {0x1BC9F, 0x1BC9F, TextDirection::LeftToRight}, {0x1CF50, 0x1D166, TextDirection::LeftToRight},
+        {0x1D16A, 0x1D172, TextDirection::LeftToRight}, {0x1D183, 0x1D184, TextDirection::LeftToRight}, {0x1D18C, 0x1D1A9, TextDirection::LeftToRight},
+        {0x1D1AE, 0x1D1E8, TextDirection::LeftToRight}, {0x1D2E0, 0x1D2F3, TextDirection::LeftToRight}, {0x1D360, 0x1D6DA, TextDirection::LeftToRight},
+        {0x1D6DC, 0x1D714, TextDirection::LeftToRight}, {0x1D716, 0x1D74E, TextDirection::LeftToRight}, {0x1D750, 0x1D788, TextDirection::LeftToRight},
+        {0x1D78A, 0x1D7C2, TextDirection::LeftToRight}, {0x1D7C4, 0x1D7CB, TextDirection::LeftToRight}, {0x1D800, 0x1D9FF, TextDirection::LeftToRight},
+        {0x1DA37, 0x1DA3A, TextDirection::LeftToRight}, {0x1DA6D, 0x1DA74, TextDirection::LeftToRight}, {0x1DA76, 0x1DA83, TextDirection::LeftToRight},
+        {0x1DA85, 0x1DA8B, TextDirection::LeftToRight}, {0x1DF00, 0x1DF1E, TextDirection::LeftToRight}, {0x1E100, 0x1E12C, TextDirection::LeftToRight},
+        {0x1E137, 0x1E2AD, TextDirection::LeftToRight}, {0x1E2C0, 0x1E2EB, TextDirection::LeftToRight}, {0x1E2F0, 0x1E2F9, TextDirection::LeftToRight},
+        {0x1E7E0, 0x1E7FE, TextDirection::LeftToRight}, {0x1E800, 0x1E8CF, TextDirection::RightToLeft}, {0x1E900, 0x1E943, TextDirection::RightToLeft},
+        {0x1E94B, 0x1EEBB, TextDirection::RightToLeft}, {0x1F110, 0x1F12E, TextDirection::LeftToRight}, {0x1F130, 0x1F169, TextDirection::LeftToRight},
+        {0x1F170, 0x1F1AC, TextDirection::LeftToRight}, {0x1F1E6, 0x1F251, TextDirection::LeftToRight}, {0x20000, 0x3134A, TextDirection::LeftToRight},
+        {0xF0000, 0x10FFFD, TextDirection::LeftToRight},
+    };
+
+    /**
+     * @brief A precomposed or uppercase letter split into its lowercase base and combining marks
+     */
+    struct LetterDecomposition
+    {
+      char16_t codePoint;
+      char16_t base;
+      char16_t mark1;
+      char16_t mark2;
+      bool upper;
+    };
+
+    /**
+     * @brief Latin, Greek and Cyrillic letters as lowercase base letter, up to two combining marks and case
+     */
+    inline constexpr LetterDecomposition letterDecompositions[] = {
+        {0x00C0, 0x0061, 0x0300, 0x0000, true}, {0x00C1, 0x0061, 0x0301, 0x0000, true}, {0x00C2, 0x0061, 0x0302, 0x0000, true},
+        {0x00C3, 0x0061, 0x0303, 0x0000, true}, {0x00C4, 0x0061, 0x0308, 0x0000, true}, {0x00C5, 0x0061, 0x030A, 0x0000, true},
+        {0x00C6, 0x00E6, 0x0000, 0x0000, true}, {0x00C7, 0x0063, 0x0327, 0x0000, true}, {0x00C8, 0x0065, 0x0300, 0x0000, true},
+        {0x00C9, 0x0065, 0x0301, 0x0000, true}, {0x00CA, 0x0065, 0x0302, 0x0000, true}, {0x00CB, 0x0065, 0x0308, 0x0000, true},
+        {0x00CC, 0x0069, 0x0300, 0x0000, true}, {0x00CD, 0x0069, 0x0301, 0x0000, true}, {0x00CE, 0x0069, 0x0302, 0x0000, true},
+        {0x00CF, 0x0069, 0x0308, 0x0000, true}, {0x00D0, 0x00F0, 0x0000, 0x0000, true}, {0x00D1, 0x006E, 0x0303, 0x0000, true},
+        {0x00D2, 0x006F, 0x0300, 0x0000, true}, {0x00D3, 0x006F, 0x0301, 0x0000, true}, {0x00D4, 0x006F, 0x0302, 0x0000, true},
+        {0x00D5, 0x006F, 0x0303, 0x0000, true}, {0x00D6, 0x006F, 0x0308, 0x0000, true}, {0x00D8, 0x00F8, 0x0000, 0x0000, true},
+        {0x00D9, 0x0075, 0x0300, 0x0000, true}, {0x00DA, 0x0075, 0x0301, 0x0000, true}, {0x00DB, 0x0075, 0x0302, 0x0000, true},
+        {0x00DC, 0x0075, 0x0308, 0x0000, true}, {0x00DD, 0x0079, 0x0301, 0x0000, true}, {0x00DE, 0x00FE, 0x0000, 0x0000, true},
+        {0x00E0, 0x0061, 0x0300, 0x0000, false}, {0x00E1, 0x0061, 0x0301, 0x0000, false}, {0x00E2, 0x0061, 0x0302, 0x0000, false},
+        {0x00E3, 0x0061, 0x0303, 0x0000, false}, {0x00E4, 0x0061, 0x0308, 0x0000, false}, {0x00E5, 0x0061, 0x030A, 0x0000, false},
+        {0x00E7, 0x0063, 0x0327, 0x0000, false}, {0x00E8, 0x0065, 0x0300, 0x0000, false}, {0x00E9, 0x0065, 0x0301, 0x0000, false},
+        {0x00EA, 0x0065, 0x0302, 0x0000, false}, {0x00EB, 0x0065, 0x0308, 0x0000, false}, {0x00EC, 0x0069, 0x0300, 0x0000, false},
+        {0x00ED, 0x0069, 0x0301, 0x0000, false}, {0x00EE, 0x0069, 0x0302, 0x0000, false}, {0x00EF, 0x0069, 0x0308, 0x0000, false},
+        {0x00F1, 0x006E, 0x0303, 0x0000, false}, {0x00F2, 0x006F, 0x0300, 0x0000, false}, {0x00F3, 0x006F, 0x0301, 0x0000, false},
+        {0x00F4, 0x006F, 0x0302, 0x0000, false}, {0x00F5, 0x006F, 0x0303, 0x0000, false}, {0x00F6, 0x006F, 0x0308, 0x0000, false},
+        {0x00F9, 0x0075, 0x0300, 0x0000, false}, {0x00FA, 0x0075, 0x0301, 0x0000, false}, {0x00FB, 0x0075, 0x0302, 0x0000, false},
+        {0x00FC, 0x0075, 0x0308, 0x0000, false}, {0x00FD, 0x0079, 0x0301, 0x0000, false}, {0x00FF, 0x0079, 0x0308, 0x0000, false},
+        {0x0100, 0x0061, 0x0304, 0x0000, true}, {0x0101, 0x0061, 0x0304, 0x0000, false}, {0x0102, 0x0061, 0x0306, 0x0000, true},
+        {0x0103, 0x0061, 0x0306, 0x0000, false}, {0x0104, 0x0061, 0x0328, 0x0000, true}, {0x0105, 0x0061, 0x0328, 0x0000, false},
+        {0x0106, 0x0063, 0x0301, 0x0000, true}, {0x0107, 0x0063, 0x0301, 0x0000, false}, {0x0108, 0x0063, 0x0302, 0x0000, true},
+        {0x0109, 0x0063, 0x0302, 0x0000, false}, {0x010A, 0x0063, 0x0307, 0x0000, true}, {0x010B, 0x0063, 0x0307, 0x0000, false},
+        {0x010C, 0x0063, 0x030C, 0x0000, true}, {0x010D, 0x0063, 0x030C, 0x0000, false}, {0x010E, 0x0064, 0x030C, 0x0000, true},
+        {0x010F, 0x0064, 0x030C, 0x0000, false}, {0x0110, 0x0111, 0x0000, 0x0000, true}, {0x0112, 0x0065, 0x0304, 0x0000, true},
+        {0x0113, 0x0065, 0x0304, 0x0000, false}, {0x0114, 0x0065, 0x0306, 0x0000, true}, {0x0115, 0x0065, 0x0306, 0x0000, false},
+        {0x0116, 0x0065, 0x0307, 0x0000, true}, {0x0117, 0x0065, 0x0307, 0x0000, false}, {0x0118, 0x0065, 0x0328, 0x0000, true},
+        {0x0119, 0x0065, 0x0328, 0x0000, false}, {0x011A, 0x0065, 0x030C, 0x0000, true}, {0x011B, 0x0065, 0x030C, 0x0000, false},
+        {0x011C, 0x0067, 0x0302, 0x0000, true}, {0x011D, 0x0067, 0x0302, 0x0000, false}, {0x011E, 0x0067, 0x0306, 0x0000, true},
+        {0x011F, 0x0067, 0x0306, 0x0000, false}, {0x0120, 0x0067, 0x0307, 0x0000, true}, {0x0121, 0x0067, 0x0307, 0x0000, false},
+        {0x0122, 0x0067, 0x0327, 0x0000, true}, {0x0123, 0x0067, 0x0327, 0x0000, false}, {0x0124, 0x0068, 0x0302, 0x0000, true},
+        {0x0125, 0x0068, 0x0302, 0x0000, false}, {0x0126, 0x0127, 0x0000, 0x0000, true}, {0x0128, 0x0069, 0x0303, 0x0000, true},
+        {0x0129, 0x0069, 0x0303, 0x0000, false}, {0x012A, 0x0069, 0x0304, 0x0000, true}, {0x012B, 0x0069, 0x0304, 0x0000, false},
+        {0x012C, 0x0069, 0x0306, 0x0000, true}, {0x012D, 0x0069, 0x0306, 0x0000, false}, {0x012E, 0x0069, 0x0328, 0x0000, true},
+        {0x012F, 0x0069, 0x0328, 0x0000, false}, {0x0132, 0x0133, 0x0000, 0x0000, true}, {0x0134, 0x006A, 0x0302, 0x0000, true},
+        {0x0135, 0x006A, 0x0302, 0x0000, false}, {0x0136, 0x006B, 0x0327, 0x0000, true}, {0x0137, 0x006B, 0x0327, 0x0000, false},
+        {0x0139, 0x006C, 0x0301, 0x0000, true}, {0x013A, 0x006C, 0x0301, 0x0000, false}, {0x013B, 0x006C, 0x0327, 0x0000, true},
+        {0x013C, 0x006C, 0x0327, 0x0000, false}, {0x013D, 0x006C, 0x030C, 0x0000, true}, {0x013E, 0x006C, 0x030C, 0x0000, false},
+        {0x0141, 0x0142, 0x0000, 0x0000, true}, {0x0143, 0x006E, 0x0301, 0x0000, true}, {0x0144, 0x006E, 0x0301, 0x0000, false},
+        {0x0145, 0x006E, 0x0327, 0x0000, true}, {0x0146, 0x006E, 0x0327, 0x0000, false}, {0x0147, 0x006E, 0x030C, 0x0000, true},
+        {0x0148, 0x006E, 0x030C, 0x0000, false}, {0x014C, 0x006F, 0x0304, 0x0000, true}, {0x014D, 0x006F, 0x0304, 0x0000, false},
+        {0x014E, 0x006F, 0x0306, 0x0000, true}, {0x014F, 0x006F, 0x0306, 0x0000, false}, {0x0150, 0x006F, 0x030B, 0x0000, true},
+        {0x0151, 0x006F, 0x030B, 0x0000, false}, {0x0152, 0x0153, 0x0000, 0x0000, true}, {0x0154, 0x0072, 0x0301, 0x0000, true},
+        {0x0155, 0x0072, 0x0301, 0x0000, false}, {0x0156, 0x0072, 0x0327, 0x0000, true}, {0x0157, 0x0072, 0x0327, 0x0000, false},
+        {0x0158, 0x0072, 0x030C, 0x0000, true}, {0x0159, 0x0072, 0x030C, 0x0000, false}, {0x015A, 0x0073, 0x0301, 0x0000, true},
+        {0x015B, 0x0073, 0x0301, 0x0000, false}, {0x015C, 0x0073, 0x0302, 0x0000, true}, {0x015D, 0x0073, 0x0302, 0x0000, false},
+        {0x015E, 0x0073, 0x0327, 0x0000, true}, {0x015F, 0x0073, 0x0327, 0x0000, false}, {0x0160, 0x0073, 0x030C, 0x0000, true},
+        {0x0161, 0x0073, 0x030C, 0x0000, false}, {0x0162, 0x0074, 0x0327, 0x0000, true}, {0x0163, 0x0074, 0x0327, 0x0000, false},
+        {0x0164, 0x0074, 0x030C, 0x0000, true}, {0x0165, 0x0074, 0x030C, 0x0000, false}, {0x0166, 0x0167, 0x0000, 0x0000, true},
+        {0x0168, 0x0075, 0x0303, 0x0000, true}, {0x0169, 0x0075, 0x0303, 0x0000, false}, {0x016A, 0x0075, 0x0304, 0x0000, true},
+        {0x016B, 0x0075, 0x0304, 0x0000, false}, {0x016C, 0x0075, 0x0306, 0x0000, true}, {0x016D, 0x0075, 0x0306, 0x0000, false},
+        {0x016E, 0x0075, 0x030A, 0x0000, true}, {0x016F, 0x0075, 0x030A, 0x0000, false}, {0x0170, 0x0075, 0x030B, 0x0000, true},
+        {0x0171, 0x0075, 0x030B, 0x0000, false}, {0x0172, 0x0075, 0x0328, 0x0000, true}, {0x0173, 0x0075, 0x0328, 0x0000, false},
+        {0x0174, 0x0077, 0x0302, 0x0000, true}, {0x0175, 0x0077, 0x0302, 0x0000, false}, {0x0176, 0x0079, 0x0302, 0x0000, true},
+        {0x0177, 0x0079, 0x0302, 0x0000, false}, {0x0178, 0x0079, 0x0308, 0x0000, true}, {0x0179, 0x007A, 0x0301, 0x0000, true},
+        {0x017A, 0x007A, 0x0301, 0x0000, false}, {0x017B, 0x007A, 0x0307, 0x0000, true}, {0x017C, 0x007A, 0x0307, 0x0000, false},
+        {0x017D, 0x007A, 0x030C, 0x0000, true}, {0x017E, 0x007A, 0x030C, 0x0000, false}, {0x01A0, 0x006F, 0x031B, 0x0000, true},
+        {0x01A1, 0x006F, 0x031B, 0x0000, false}, {0x01AF, 0x0075, 0x031B, 0x0000, true}, {0x01B0, 0x0075, 0x031B, 0x0000, false},
+        {0x01CD, 0x0061, 0x030C, 0x0000, true}, {0x01CE, 0x0061, 0x030C, 0x0000, false}, {0x01CF, 0x0069, 0x030C, 0x0000, true},
+        {0x01D0, 0x0069, 0x030C, 0x0000, false}, {0x01D1, 0x006F, 0x030C, 0x0000, true}, {0x01D2, 0x006F, 0x030C, 0x0000, false},
+        {0x01D3, 0x0075, 0x030C, 0x0000, true}, {0x01D4, 0x0075, 0x030C, 0x0000, false}, {0x01D5, 0x0075, 0x0308, 0x0304, true},
+        {0x01D6, 0x0075, 0x0308, 0x0304, false}, {0x01D7, 0x0075, 0x0308, 0x0301, true}, {0x01D8, 0x0075, 0x0308, 0x0301, false},
+        {0x01D9, 0x0075, 0x0308, 0x030C, true}, {0x01DA, 0x0075, 0x0308, 0x030C, false}, {0x01DB, 0x0075, 0x0308, 0x0300, true},
+        {0x01DC, 0x0075, 0x0308, 0x0300, false}, {0x01DE, 0x0061, 0x0308, 0x0304, true}, {0x01DF, 0x0061, 0x0308, 0x0304, false},
+        {0x01E0, 0x0061, 0x0307, 0x0304, true}, {0x01E1, 0x0061, 0x0307, 0x0304, false}, {0x01E2, 0x00E6, 0x0304, 0x0000, true},
+        {0x01E3, 0x00E6, 0x0304, 0x0000, false}, {0x01E6, 0x0067, 0x030C, 0x0000, true}, {0x01E7, 0x0067, 0x030C, 0x0000, false},
+        {0x01E8, 0x006B, 0x030C, 0x0000, true}, {0x01E9, 0x006B, 0x030C, 0x0000, false}, {0x01EA, 0x006F, 0x0328, 0x0000, true},
+        {0x01EB, 0x006F, 0x0328, 0x0000, false}, {0x01EC, 0x006F, 0x0328, 0x0304, true}, {0x01ED, 0x006F, 0x0328, 0x0304, false},
+        {0x01F0, 0x006A, 0x030C, 0x0000, false}, {0x01F4, 0x0067, 0x0301, 0x0000, true}, {0x01F5, 0x0067, 0x0301, 0x0000, false},
+        {0x01F8, 0x006E, 0x0300, 0x0000, true}, {0x01F9, 0x006E, 0x0300, 0x0000, false}, {0x01FA, 0x0061, 0x030A, 0x0301, true},
+        {0x01FB, 0x0061, 0x030A, 0x0301, false}, {0x01FC, 0x00E6, 0x0301, 0x0000, true}, {0x01FD, 0x00E6, 0x0301, 0x0000, false},
+        {0x01FE, 0x00F8, 0x0301, 0x0000, true}, {0x01FF, 0x00F8, 0x0301, 0x0000, false}, {0x0200, 0x0061, 0x030F, 0x0000, true},
+        {0x0201, 0x0061, 0x030F, 0x0000, false}, {0x0202, 0x0061, 0x0311, 0x0000, true}, {0x0203, 0x0061, 0x0311, 0x0000, false},
+        {0x0204, 0x0065, 0x030F, 0x0000, true}, {0x0205, 0x0065, 0x030F, 0x0000, false}, {0x0206, 0x0065, 0x0311, 0x0000, true},
+        {0x0207, 0x0065, 0x0311, 0x0000, false}, {0x0208, 0x0069, 0x030F, 0x0000, true}, {0x0209, 0x0069, 0x030F, 0x0000, false},
+        {0x020A, 0x0069, 0x0311, 0x0000, true}, {0x020B, 0x0069, 0x0311, 0x0000, false}, {0x020C, 0x006F, 0x030F, 0x0000, true},
+        {0x020D, 0x006F, 0x030F, 0x0000, false}, {0x020E, 0x006F, 0x0311, 0x0000, true}, {0x020F, 0x006F, 0x0311, 0x0000, false},
+        {0x0210, 0x0072, 0x030F, 0x0000, true}, {0x0211, 0x0072, 0x030F, 0x0000, false}, {0x0212, 0x0072, 0x0311, 0x0000, true},
+        {0x0213, 0x0072, 0x0311, 0x0000, false}, {0x0214, 0x0075, 0x030F, 0x0000, true}, {0x0215, 0x0075, 0x030F, 0x0000, false},
+        {0x0216, 0x0075, 0x0311, 0x0000, true}, {0x0217, 0x0075, 0x0311, 0x0000, false}, {0x0218, 0x0073, 0x0326, 0x0000, true},
+        {0x0219, 0x0073, 0x0326, 0x0000, false}, {0x021A, 0x0074, 0x0326, 0x0000, true}, {0x021B, 0x0074, 0x0326, 0x0000, false},
+        {0x021E, 0x0068, 0x030C, 0x0000, true}, {0x021F, 0x0068, 0x030C, 0x0000, false}, {0x0226, 0x0061, 0x0307, 0x0000, true},
+        {0x0227, 0x0061, 0x0307, 0x0000, false}, {0x0228, 0x0065, 0x0327, 0x0000, true}, {0x0229, 0x0065, 0x0327, 0x0000, false},
+        {0x022A, 0x006F, 0x0308, 0x0304, true}, {0x022B, 0x006F, 0x0308, 0x0304, false}, {0x022C, 0x006F, 0x0303, 0x0304, true},
+        {0x022D, 0x006F, 0x0303, 0x0304, false}, {0x022E, 0x006F, 0x0307, 0x0000, true}, {0x022F, 0x006F, 0x0307, 0x0000, false},
+        {0x0230, 0x006F, 0x0307, 0x0304, true}, {0x0231, 0x006F, 0x0307, 0x0304, false}, {0x0232, 0x0079, 0x0304, 0x0000, true},
+        {0x0233, 0x0079, 0x0304, 0x0000, false}, {0x0386, 0x03B1, 0x0301, 0x0000, true}, {0x0388, 0x03B5, 0x0301, 0x0000, true},
+        {0x0389, 0x03B7, 0x0301, 0x0000, true}, {0x038A, 0x03B9, 0x0301, 0x0000, true}, {0x038C, 0x03BF, 0x0301, 0x0000, true},
+        {0x038E, 0x03C5, 0x0301, 0x0000, true}, {0x038F, 0x03C9, 0x0301, 0x0000, true}, {0x0390, 0x03B9, 0x0308, 0x0301, false},
+        {0x0391, 0x03B1, 0x0000, 0x0000, true}, {0x0392, 0x03B2, 0x0000, 0x0000, true}, {0x0393, 0x03B3, 0x0000, 0x0000, true},
+        {0x0394, 0x03B4, 0x0000, 0x0000, true}, {0x0395, 0x03B5, 0x0000, 0x0000, true}, {0x0396, 0x03B6, 0x0000, 0x0000, true},
+        {0x0397, 0x03B7, 0x0000, 0x0000, true}, {0x0398, 0x03B8, 0x0000, 0x0000, true}, {0x0399, 0x03B9, 0x0000, 0x0000, true},
+        {0x039A, 0x03BA, 0x0000, 0x0000, true}, {0x039B, 0x03BB, 0x0000, 0x0000, true}, {0x039C, 0x03BC, 0x0000, 0x0000, true},
+        {0x039D, 0x03BD, 0x0000, 0x0000, true}, {0x039E, 0x03BE, 0x0000, 0x0000, true}, {0x039F, 0x03BF, 0x0000, 0x0000, true},
+        {0x03A0, 0x03C0, 0x0000, 0x0000, true}, {0x03A1, 0x03C1, 0x0000, 0x0000, true}, {0x03A3, 0x03C3, 0x0000, 0x0000, true},
+        {0x03A4, 0x03C4, 0x0000, 0x0000, true}, {0x03A5, 0x03C5, 0x0000, 0x0000, true}, {0x03A6, 0x03C6, 0x0000, 0x0000, true},
+        {0x03A7, 0x03C7, 0x0000, 0x0000, true}, {0x03A8, 0x03C8, 0x0000, 0x0000, true}, {0x03A9, 0x03C9, 0x0000, 0x0000, true},
+        {0x03AA, 0x03B9, 0x0308, 0x0000, true}, {0x03AB, 0x03C5, 0x0308, 0x0000, true}, {0x03AC, 0x03B1, 0x0301, 0x0000, false},
+        {0x03AD, 0x03B5, 0x0301, 0x0000, false}, {0x03AE, 0x03B7, 0x0301, 0x0000, false}, {0x03AF, 0x03B9, 0x0301, 0x0000, false},
+        {0x03B0, 0x03C5, 0x0308, 0x0301, false}, {0x03CA, 0x03B9, 0x0308, 0x0000, false}, {0x03CB, 0x03C5, 0x0308, 0x0000, false},
+        {0x03CC, 0x03BF, 0x0301, 0x0000, false}, {0x03CD, 0x03C5, 0x0301, 0x0000, false}, {0x03CE, 0x03C9, 0x0301, 0x0000, false},
+        {0x03F4, 0x03B8, 0x0000, 0x0000, true}, {0x0400, 0x0435, 0x0300, 0x0000, true}, {0x0401, 0x0435, 0x0308, 0x0000, true},
+        {0x0402, 0x0452, 0x0000, 0x0000, true}, {0x0403, 0x0433, 0x0301, 0x0000, true}, {0x0404, 0x0454, 0x0000, 0x0000, true},
+        {0x0405, 0x0455, 0x0000, 0x0000, true}, {0x0406, 0x0456, 0x0000, 0x0000, true}, {0x0407, 0x0456, 0x0308, 0x0000, true},
+        {0x0408, 0x0458, 0x0000, 0x0000, true}, {0x0409, 0x0459, 0x0000, 0x0000, true}, {0x040A, 0x045A, 0x0000, 0x0000, true},
+        {0x040B, 0x045B, 0x0000, 0x0000, true}, {0x040C, 0x043A, 0x0301, 0x0000, true}, {0x040D, 0x0438, 0x0300, 0x0000, true},
+        {0x040E, 0x0443, 0x0306, 0x0000, true}, {0x040F, 0x045F, 0x0000, 0x0000, true}, {0x0410, 0x0430, 0x0000, 0x0000, true},
+        {0x0411, 0x0431, 0x0000, 0x0000, true}, {0x0412, 0x0432, 0x0000, 0x0000, true}, {0x0413, 0x0433, 0x0000, 0x0000, true},
+        {0x0414, 0x0434, 0x0000, 0x0000, true}, {0x0415, 0x0435, 0x0000, 0x0000, true}, {0x0416, 0x0436, 0x0000, 0x0000, true},
+        {0x0417, 0x0437, 0x0000, 0x0000, true}, {0x0418, 0x0438, 0x0000, 0x0000, true}, {0x0419, 0x0438, 0x0306, 0x0000, true},
+        {0x041A, 0x043A, 0x0000, 0x0000, true}, {0x041B, 0x043B, 0x0000, 0x0000, true}, {0x041C, 0x043C, 0x0000, 0x0000, true},
+        {0x041D, 0x043D, 0x0000, 0x0000, true}, {0x041E, 0x043E, 0x0000, 0x0000, true}, {0x041F, 0x043F, 0x0000, 0x0000, true},
+        {0x0420, 0x0440, 0x0000, 0x0000, true}, {0x0421, 0x0441, 0x0000, 0x0000, true}, {0x0422, 0x0442, 0x0000, 0x0000, true},
+        {0x0423, 0x0443, 0x0000, 0x0000, true}, {0x0424, 0x0444, 0x0000, 0x0000, true}, {0x0425, 0x0445, 0x0000, 0x0000, true},
+        {0x0426, 0x0446, 0x0000, 0x0000, true}, {0x0427, 0x0447, 0x0000, 0x0000, true}, {0x0428, 0x0448, 0x0000, 0x0000, true},
+        {0x0429, 0x0449, 0x0000, 0x0000, true}, {0x042A, 0x044A, 0x0000, 0x0000, true}, {0x042B, 0x044B, 0x0000, 0x0000, true},
+        {0x042C, 0x044C, 0x0000, 0x0000, true}, {0x042D, 0x044D, 0x0000, 0x0000, true}, {0x042E, 0x044E, 0x0000, 0x0000, true},
+        {0x042F, 0x044F, 0x0000, 0x0000, true}, {0x0439, 0x0438, 0x0306, 0x0000, false}, {0x0450, 0x0435, 0x0300, 0x0000, false},
+        {0x0451, 0x0435, 0x0308, 0x0000, false}, {0x0453, 0x0433, 0x0301, 0x0000, false}, {0x0457, 0x0456, 0x0308, 0x0000, false},
+        {0x045C, 0x043A, 0x0301, 0x0000, false}, {0x045D, 0x0438, 0x0300, 0x0000, false}, {0x045E, 0x0443, 0x0306, 0x0000, false},
+        {0x0490, 0x0491, 0x0000, 0x0000, true}, {0x04C1, 0x0436, 0x0306, 0x0000, true}, {0x04C2, 0x0436, 0x0306, 0x0000, false},
+        {0x04D0, 0x0430, 0x0306, 0x0000, true}, {0x04D1, 0x0430, 0x0306, 0x0000, false}, {0x04D2, 0x0430, 0x0308, 0x0000, true},
+        {0x04D3, 0x0430, 0x0308, 0x0000, false}, {0x04D6, 0x0435, 0x0306, 0x0000, true}, {0x04D7, 0x0435, 0x0306, 0x0000, false},
+        {0x04DC, 0x0436, 0x0308, 0x0000, true}, {0x04DD, 0x0436, 0x0308, 0x0000, false}, {0x04DE, 0x0437, 0x0308, 0x0000, true},
+        {0x04DF, 0x0437, 0x0308, 0x0000, false}, {0x04E2, 0x0438, 0x0304, 0x0000, true}, {0x04E3, 0x0438, 0x0304, 0x0000, false},
+        {0x04E4, 0x0438, 0x0308, 0x0000, true}, {0x04E5, 0x0438, 0x0308, 0x0000, false}, {0x04E6, 0x043E, 0x0308, 0x0000, true},
+        {0x04E7, 0x043E, 0x0308, 0x0000, false}, {0x04EC, 0x044D, 0x0308, 0x0000, true}, {0x04ED, 0x044D, 0x0308, 0x0000, false},
+        {0x04EE, 0x0443, 0x0304, 0x0000, true}, {0x04EF, 0x0443, 0x0304, 0x0000, false}, {0x04F0, 0x0443, 0x0308, 0x0000, true},
+        {0x04F1, 0x0443, 0x0308, 0x0000, false}, {0x04F2, 0x0443, 0x030B, 0x0000, true}, {0x04F3, 0x0443, 0x030B, 0x0000, false},
+        {0x04F4, 0x0447, 0x0308, 0x0000, true}, {0x04F5, 0x0447, 0x0308, 0x0000, false}, {0x04F8, 0x044B, 0x0308, 0x0000, true},
+        {0x04F9, 0x044B, 0x0308, 0x0000, false}, {0x1E00, 0x0061, 0x0325, 0x0000, true}, {0x1E01, 0x0061, 0x0325, 0x0000, false},
+        {0x1E02, 0x0062, 0x0307, 0x0000, true}, {0x1E03, 0x0062, 0x0307, 0x0000, false}, {0x1E04, 0x0062, 0x0323, 0x0000, true},
+        {0x1E05, 0x0062, 0x0323, 0x0000, false}, {0x1E06, 0x0062, 0x0331, 0x0000, true}, {0x1E07, 0x0062, 0x0331, 0x0000, false},
+        {0x1E08, 0x0063, 0x0327, 0x0301, true}, {0x1E09, 0x0063, 0x0327, 0x0301, false}, {0x1E0A, 0x0064, 0x0307, 0x0000, true},
+        {0x1E0B, 0x0064, 0x0307, 0x0000, false}, {0x1E0C, 0x0064, 0x0323, 0x0000, true}, {0x1E0D, 0x0064, 0x0323, 0x0000, false},
+        {0x1E0E, 0x0064, 0x0331, 0x0000, true}, {0x1E0F, 0x0064, 0x0331, 0x0000, false}, {0x1E10, 0x0064, 0x0327, 0x0000, true},
+        {0x1E11, 0x0064, 0x0327, 0x0000, false}, {0x1E12, 0x0064, 0x032D, 0x0000, true}, {0x1E13, 0x0064, 0x032D, 0x0000, false},
+        {0x1E14, 0x0065, 0x0304, 0x0300, true}, {0x1E15, 0x0065, 0x0304, 0x0300, false}, {0x1E16, 0x0065, 0x0304, 0x0301, true},
+        {0x1E17, 0x0065, 0x0304, 0x0301, false}, {0x1E18, 0x0065, 0x032D, 0x0000, true}, {0x1E19, 0x0065, 0x032D, 0x0000, false},
+        {0x1E1A, 0x0065, 0x0330, 0x0000, true}, {0x1E1B, 0x0065, 0x0330, 0x0000, false}, {0x1E1C, 0x0065, 0x0327, 0x0306, true},
+        {0x1E1D, 0x0065, 0x0327, 0x0306, false}, {0x1E1E, 0x0066, 0x0307, 0x0000, true}, {0x1E1F, 0x0066, 0x0307, 0x0000, false},
+        {0x1E20, 0x0067, 0x0304, 0x0000, true}, {0x1E21, 0x0067, 0x0304, 0x0000, false}, {0x1E22, 0x0068, 0x0307, 0x0000, true},
+        {0x1E23, 0x0068, 0x0307, 0x0000, false}, {0x1E24, 0x0068, 0x0323, 0x0000, true}, {0x1E25, 0x0068, 0x0323, 0x0000, false},
+        {0x1E26, 0x0068, 0x0308, 0x0000, true}, {0x1E27, 0x0068, 0x0308, 0x0000, false}, {0x1E28, 0x0068, 0x0327, 0x0000, true},
+        {0x1E29, 0x0068, 0x0327, 0x0000, false}, {0x1E2A, 0x0068, 0x032E, 0x0000, true}, {0x1E2B, 0x0068, 0x032E, 0x0000, false},
+        {0x1E2C, 0x0069, 0x0330, 0x0000, true}, {0x1E2D, 0x0069, 0x0330, 0x0000, false}, {0x1E2E, 0x0069, 0x0308, 0x0301, true},
+        {0x1E2F, 0x0069, 0x0308, 0x0301, false}, {0x1E30, 0x006B, 0x0301, 0x0000, true}, {0x1E31, 0x006B, 0x0301, 0x0000, false},
+        {0x1E32, 0x006B, 0x0323, 0x0000, true}, {0x1E33, 0x006B, 0x0323, 0x0000, false}, {0x1E34, 0x006B, 0x0331, 0x0000, true},
+        {0x1E35, 0x006B, 0x0331, 0x0000, false}, {0x1E36, 0x006C, 0x0323, 0x0000, true}, {0x1E37, 0x006C, 0x0323, 0x0000, false},
+        {0x1E38, 0x006C, 0x0323, 0x0304, true}, {0x1E39, 0x006C, 0x0323, 0x0304, false}, {0x1E3A, 0x006C, 0x0331, 0x0000, true},
+        {0x1E3B, 0x006C, 0x0331, 0x0000, false}, {0x1E3C, 0x006C, 0x032D, 0x0000, true}, {0x1E3D, 0x006C, 0x032D, 0x0000, false},
+        {0x1E3E, 0x006D, 0x0301, 0x0000, true}, {0x1E3F, 0x006D, 0x0301, 0x0000, false}, {0x1E40, 0x006D, 0x0307, 0x0000, true},
+        {0x1E41, 0x006D, 0x0307, 0x0000, false}, {0x1E42, 0x006D, 0x0323, 0x0000, true}, {0x1E43, 0x006D, 0x0323, 0x0000, false},
+        {0x1E44, 0x006E, 0x0307, 0x0000, true}, {0x1E45, 0x006E, 0x0307, 0x0000, false}, {0x1E46, 0x006E, 0x0323, 0x0000, true},
+        {0x1E47, 0x006E, 0x0323, 0x0000, false}, {0x1E48, 0x006E, 0x0331, 0x0000, true}, {0x1E49, 0x006E, 0x0331, 0x0000, false},
+        {0x1E4A, 0x006E, 0x032D, 0x0000, true}, {0x1E4B, 0x006E, 0x032D, 0x0000, false}, {0x1E4C, 0x006F, 0x0303, 0x0301, true},
+        {0x1E4D, 0x006F, 0x0303, 0x0301, false}, {0x1E4E, 0x006F, 0x0303, 0x0308, true}, {0x1E4F, 0x006F, 0x0303, 0x0308, false},
+        {0x1E50, 0x006F, 0x0304, 0x0300, true}, {0x1E51, 0x006F, 0x0304, 0x0300, false}, {0x1E52, 0x006F, 0x0304, 0x0301, true},
+        {0x1E53, 0x006F, 0x0304, 0x0301, false}, {0x1E54, 0x0070, 0x0301, 0x0000, true}, {0x1E55, 0x0070, 0x0301, 0x0000, false},
+        {0x1E56, 0x0070, 0x0307, 0x0000, true}, {0x1E57, 0x0070, 0x0307, 0x0000, false}, {0x1E58, 0x0072, 0x0307, 0x0000, true},
+        {0x1E59, 0x0072, 0x0307, 0x0000, false}, {0x1E5A, 0x0072, 0x0323, 0x0000, true}, {0x1E5B, 0x0072, 0x0323, 0x0000, false},
+        {0x1E5C, 0x0072, 0x0323, 0x0304, true}, {0x1E5D, 0x0072, 0x0323, 0x0304, false}, {0x1E5E, 0x0072, 0x0331, 0x0000, true},
+        {0x1E5F, 0x0072, 0x0331, 0x0000, false}, {0x1E60, 0x0073, 0x0307, 0x0000, true}, {0x1E61, 0x0073, 0x0307, 0x0000, false},
+        {0x1E62, 0x0073, 0x0323, 0x0000, true}, {0x1E63, 0x0073, 0x0323, 0x0000, false}, {0x1E64, 0x0073, 0x0301, 0x0307, true},
+        {0x1E65, 0x0073, 0x0301, 0x0307, false}, {0x1E66, 0x0073, 0x030C, 0x0307, true}, {0x1E67, 0x0073, 0x030C, 0x0307, false},
+        {0x1E68, 0x0073, 0x0323, 0x0307, true}, {0x1E69, 0x0073, 0x0323, 0x0307, false}, {0x1E6A, 0x0074, 0x0307, 0x0000, true},
+        {0x1E6B, 0x0074, 0x0307, 0x0000, false}, {0x1E6C, 0x0074, 0x0323, 0x0000, true}, {0x1E6D, 0x0074, 0x0323, 0x0000, false},
+        {0x1E6E, 0x0074, 0x0331, 0x0000, true}, {0x1E6F, 0x0074, 0x0331, 0x0000, false}, {0x1E70, 0x0074, 0x032D, 0x0000, true},
+        {0x1E71, 0x0074, 0x032D, 0x0000, false}, {0x1E72, 0x0075, 0x0324, 0x0000, true}, {0x1E73, 0x0075, 0x0324, 0x0000, false},
+        {0x1E74, 0x0075, 0x0330, 0x0000, true}, {0x1E75, 0x0075, 0x0330, 0x0000, false}, {0x1E76, 0x0075, 0x032D, 0x0000, true},
+        {0x1E77, 0x0075, 0x032D, 0x0000, false}, {0x1E78, 0x0075, 0x0303, 0x0301, true}, {0x1E79, 0x0075, 0x0303, 0x0301, false},
+        {0x1E7A, 0x0075, 0x0304, 0x0308, true}, {0x1E7B, 0x0075, 0x0304, 0x0308, false}, {0x1E7C, 0x0076, 0x0303, 0x0000, true},
+        {0x1E7D, 0x0076, 0x0303, 0x0000, false}, {0x1E7E, 0x0076, 0x0323, 0x0000, true}, {0x1E7F, 0x0076, 0x0323, 0x0000, false},
+        {0x1E80, 0x0077, 0x0300, 0x0000, true}, {0x1E81, 0x0077, 0x0300, 0x0000, false}, {0x1E82, 0x0077, 0x0301, 0x0000, true},
+        {0x1E83, 0x0077, 0x0301, 0x0000, false}, {0x1E84, 0x0077, 0x0308, 0x0000, true}, {0x1E85, 0x0077, 0x0308, 0x0000, false},
+        {0x1E86, 0x0077, 0x0307, 0x0000, true}, {0x1E87, 0x0077, 0x0307, 0x0000, false}, {0x1E88, 0x0077, 0x0323, 0x0000, true},
+        {0x1E89, 0x0077, 0x0323, 0x0000, false}, {0x1E8A, 0x0078, 0x0307, 0x0000, true}, {0x1E8B, 0x0078, 0x0307, 0x0000, false},
+        {0x1E8C, 0x0078, 0x0308, 0x0000, true}, {0x1E8D, 0x0078, 0x0308, 0x0000, false}, {0x1E8E, 0x0079, 0x0307, 0x0000, true},
+        {0x1E8F, 0x0079, 0x0307, 0x0000, false}, {0x1E90, 0x007A, 0x0302, 0x0000, true}, {0x1E91, 0x007A, 0x0302, 0x0000, false},
+        {0x1E92, 0x007A, 0x0323, 0x0000, true}, {0x1E93, 0x007A, 0x0323, 0x0000, false}, {0x1E94, 0x007A, 0x0331, 0x0000, true},
+        {0x1E95, 0x007A, 0x0331, 0x0000, false}, {0x1E96, 0x0068, 0x0331, 0x0000, false}, {0x1E97, 0x0074, 0x0308, 0x0000, false},
+        {0x1E98, 0x0077, 0x030A, 0x0000, false}, {0x1E99, 0x0079, 0x030A, 0x0000, false}, {0x1E9E, 0x00DF, 0x0000, 0x0000, true},
+        {0x1EA0, 0x0061, 0x0323, 0x0000, true}, {0x1EA1, 0x0061, 0x0323, 0x0000, false}, {0x1EA2, 0x0061, 0x0309, 0x0000, true},
+        {0x1EA3, 0x0061, 0x0309, 0x0000, false}, {0x1EA4, 0x0061, 0x0302, 0x0301, true}, {0x1EA5, 0x0061, 0x0302, 0x0301, false},
+        {0x1EA6, 0x0061, 0x0302, 0x0300, true}, {0x1EA7, 0x0061, 0x0302, 0x0300, false}, {0x1EA8, 0x0061, 0x0302, 0x0309, true},
+        {0x1EA9, 0x0061, 0x0302, 0x0309, false}, {0x1EAA, 0x0061, 0x0302, 0x0303, true}, {0x1EAB, 0x0061, 0x0302, 0x0303, false},
+        {0x1EAC, 0x0061, 0x0323, 0x0302, true}, {0x1EAD, 0x0061, 0x0323, 0x0302, false}, {0x1EAE, 0x0061, 0x0306, 0x0301, true},
+        {0x1EAF, 0x0061, 0x0306, 0x0301, false}, {0x1EB0, 0x0061, 0x0306, 0x0300, true}, {0x1EB1, 0x0061, 0x0306, 0x0300, false},
+        {0x1EB2, 0x0061, 0x0306, 0x0309, true}, {0x1EB3, 0x0061, 0x0306, 0x0309, false}, {0x1EB4, 0x0061, 0x0306, 0x0303, true},
+        {0x1EB5, 0x0061, 0x0306, 0x0303, false}, {0x1EB6, 0x0061, 0x0323, 0x0306, true}, {0x1EB7, 0x0061, 0x0323, 0x0306, false},
+        {0x1EB8, 0x0065, 0x0323, 0x0000, true}, {0x1EB9, 0x0065, 0x0323, 0x0000, false}, {0x1EBA, 0x0065, 0x0309, 0x0000, true},
+        {0x1EBB, 0x0065, 0x0309, 0x0000, false}, {0x1EBC, 0x0065, 0x0303, 0x0000, true}, {0x1EBD, 0x0065, 0x0303, 0x0000, false},
+        {0x1EBE, 0x0065, 0x0302, 0x0301, true}, {0x1EBF, 0x0065, 0x0302, 0x0301, false}, {0x1EC0, 0x0065, 0x0302, 0x0300, true},
+        {0x1EC1, 0x0065, 0x0302, 0x0300, false}, {0x1EC2, 0x0065, 0x0302, 0x0309, true}, {0x1EC3, 0x0065, 0x0302, 0x0309, false},
+        {0x1EC4, 0x0065, 0x0302, 0x0303, true}, {0x1EC5, 0x0065, 0x0302, 0x0303, false}, {0x1EC6, 0x0065, 0x0323, 0x0302, true},
+        {0x1EC7, 0x0065, 0x0323, 0x0302, false}, {0x1EC8, 0x0069, 0x0309, 0x0000, true}, {0x1EC9, 0x0069, 0x0309, 0x0000, false},
+        {0x1ECA, 0x0069, 0x0323, 0x0000, true}, {0x1ECB, 0x0069, 0x0323, 0x0000, false}, {0x1ECC, 0x006F, 0x0323, 0x0000, true},
+        {0x1ECD, 0x006F, 0x0323, 0x0000, false}, {0x1ECE, 0x006F, 0x0309, 0x0000, true}, {0x1ECF, 0x006F, 0x0309, 0x0000, false},
+        {0x1ED0, 0x006F, 0x0302, 0x0301, true}, {0x1ED1, 0x006F, 0x0302, 0x0301, false}, {0x1ED2, 0x006F, 0x0302, 0x0300, true},
+        {0x1ED3, 0x006F, 0x0302, 0x0300, false}, {0x1ED4, 0x006F, 0x0302, 0x0309, true}, {0x1ED5, 0x006F, 0x0302, 0x0309, false},
+        {0x1ED6, 0x006F, 0x0302, 0x0303, true}, {0x1ED7, 0x006F, 0x0302, 0x0303, false}, {0x1ED8, 0x006F, 0x0323, 0x0302, true},
+        {0x1ED9, 0x006F, 0x0323, 0x0302, false}, {0x1EDA, 0x006F, 0x031B, 0x0301, true}, {0x1EDB, 0x006F, 0x031B, 0x0301, false},
+        {0x1EDC, 0x006F, 0x031B, 0x0300, true}, {0x1EDD, 0x006F, 0x031B, 0x0300, false}, {0x1EDE, 0x006F, 0x031B, 0x0309, true},
+        {0x1EDF, 0x006F, 0x031B, 0x0309, false}, {0x1EE0, 0x006F, 0x031B, 0x0303, true}, {0x1EE1, 0x006F, 0x031B, 0x0303, false},
+        {0x1EE2, 0x006F, 0x031B, 0x0323, true}, {0x1EE3, 0x006F, 0x031B, 0x0323, false}, {0x1EE4, 0x0075, 0x0323, 0x0000, true},
+        {0x1EE5, 0x0075, 0x0323, 0x0000, false}, {0x1EE6, 0x0075, 0x0309, 0x0000, true}, {0x1EE7, 0x0075, 0x0309, 0x0000, false},
+        {0x1EE8, 0x0075, 0x031B, 0x0301, true}, {0x1EE9, 0x0075, 0x031B, 0x0301, false}, {0x1EEA, 0x0075, 0x031B, 0x0300, true},
+        {0x1EEB, 0x0075, 0x031B, 0x0300, false}, {0x1EEC, 0x0075, 0x031B, 0x0309, true}, {0x1EED, 0x0075, 0x031B, 0x0309, false},
+        {0x1EEE, 0x0075, 0x031B, 0x0303, true}, {0x1EEF, 0x0075, 0x031B, 0x0303, false}, {0x1EF0, 0x0075, 0x031B, 0x0323, true},
+        {0x1EF1, 0x0075, 0x031B, 0x0323, false}, {0x1EF2, 0x0079, 0x0300, 0x0000, true}, {0x1EF3, 0x0079, 0x0300, 0x0000, false},
+        {0x1EF4, 0x0079, 0x0323, 0x0000, true}, {0x1EF5, 0x0079, 0x0323, 0x0000, false}, {0x1EF6, 0x0079, 0x0309, 0x0000, true},
+        {0x1EF7, 0x0079, 0x0309, 0x0000, false}, {0x1EF8, 0x0079, 0x0303, 0x0000, true}, {0x1EF9, 0x0079, 0x0303, 0x0000, false},
+    };
+
+    /**
+     * @brief Case mapping of a run of code points: first..last, every stride-th one, maps to cp + delta
+     */
+    struct CaseRange
+    {
+      char32_t first;
+      char32_t last;
+      std::int32_t delta;
+      std::uint8_t stride;
+    };
+
+    /**
+     * @brief Full uppercase and titlecase mapping of a code point that expands to several code points
+     */
+    struct SpecialCasing
+    {
+      char32_t codePoint;
+      const char *upper;
+      const char *title;
+    };
+
+    /**
+     * @brief Simple uppercase mappings: code points first..last, every stride-th one, map to cp + delta
+     */
+    inline constexpr CaseRange upperRanges[] = {
+        {0x0061, 0x007A, -32, 1}, {0x00B5, 0x00B5, 743, 1}, {0x00E0, 0x00F6, -32, 1}, {0x00F8, 0x00FE, -32, 1},
+        {0x00FF, 0x00FF, 121, 1}, {0x0101, 0x012F, -1, 2}, {0x0131, 0x0131, -232, 1}, {0x0133, 0x0137, -1, 2},
+        {0x013A, 0x0148, -1, 2}, {0x014B, 0x0177, -1, 2}, {0x017A, 0x017E, -1, 2}, {0x017F, 0x017F, -300, 1},
+        {0x0180, 0x0180, 195, 1}, {0x0183, 0x0185, -1, 2}, {0x0188, 0x0188, -1, 1}, {0x018C, 0x018C, -1, 1},
+        {0x0192, 0x0192, -1, 1}, {0x0195, 0x0195, 97, 1}, {0x0199, 0x0199, -1, 1}, {0x019A, 0x019A, 163, 1},
+        {0x019E, 0x019E, 130, 1}, {0x01A1, 0x01A5, -1, 2}, {0x01A8, 0x01A8, -1, 1}, {0x01AD, 0x01AD, -1, 1},
+        {0x01B0, 0x01B0, -1, 1}, {0x01B4, 0x01B6, -1, 2}, {0x01B9, 0x01B9, -1, 1}, {0x01BD, 0x01BD, -1, 1},
+        {0x01BF, 0x01BF, 56, 1}, {0x01C5, 0x01C5, -1, 1}, {0x01C6, 0x01C6, -2, 1}, {0x01C8, 0x01C8, -1, 1},
+        {0x01C9, 0x01C9, -2, 1}, {0x01CB, 0x01CB, -1, 1}, {0x01CC, 0x01CC, -2, 1}, {0x01CE, 0x01DC, -1, 2},
+        {0x01DD, 0x01DD, -79, 1}, {0x01DF, 0x01EF, -1, 2}, {0x01F2, 0x01F2, -1, 1}, {0x01F3, 0x01F3, -2, 1},
+        {0x01F5, 0x01F5, -1, 1}, {0x01F9, 0x021F, -1, 2}, {0x0223, 0x0233, -1, 2}, {0x023C, 0x023C, -1, 1},
+        {0x023F, 0x0240, 10815, 1}, {0x0242, 0x0242, -1, 1}, {0x0247, 0x024F, -1, 2}, {0x0250, 0x0250, 10783, 1},
+        {0x0251, 0x0251, 10780, 1}, {0x0252, 0x0252, 10782, 1}, {0x0253, 0x0253, -210, 1}, {0x0254, 0x0254, -206, 1},
+        {0x0256, 0x0257, -205, 1}, {0x0259, 0x0259, -202, 1}, {0x025B, 0x025B, -203, 1}, {0x025C, 0x025C, 42319, 1},
+        {0x0260, 0x0260, -205, 1}, {0x0261, 0x0261, 42315, 1}, {0x0263, 0x0263, -207, 1}, {0x0265, 0x0265, 42280, 1},
+        {0x0266, 0x0266, 42308, 1}, {0x0268, 0x0268, -209, 1}, {0x0269, 0x0269, -211, 1}, {0x026A, 0x026A, 42308, 1},
+        {0x026B, 0x026B, 10743, 1}, {0x026C, 0x026C, 42305, 1}, {0x026F, 0x026F, -211, 1}, {0x0271, 0x0271, 10749, 1},
+        {0x0272, 0x0272, -213, 1}, {0x0275, 0x0275, -214, 1}, {0x027D, 0x027D, 10727, 1}, {0x0280, 0x0280, -218, 1},
+        {0x0282, 0x0282, 42307, 1}, {0x0283, 0x0283, -218, 1}, {0x0287, 0x0287, 42282, 1}, {0x0288, 0x0288, -218, 1},
+        {0x0289, 0x0289, -69, 1}, {0x028A, 0x028B, -217, 1}, {0x028C, 0x028C, -71, 1}, {0x0292, 0x0292, -219, 1},
+        {0x029D, 0x029D, 42261, 1}, {0x029E, 0x029E, 42258, 1}, {0x0345, 0x0345, 84, 1}, {0x0371, 0x0373, -1, 2},
+        {0x0377, 0x0377, -1, 1}, {0x037B, 0x037D, 130, 1}, {0x03AC, 0x03AC, -38, 1}, {0x03AD, 0x03AF, -37, 1},
+        {0x03B1, 0x03C1, -32, 1}, {0x03C2, 0x03C2, -31, 1}, {0x03C3, 0x03CB, -32, 1}, {0x03CC, 0x03CC, -64, 1},
+        {0x03CD, 0x03CE, -63, 1}, {0x03D0, 0x03D0, -62, 1}, {0x03D1, 0x03D1, -57, 1}, {0x03D5, 0x03D5, -47, 1},
+        {0x03D6, 0x03D6, -54, 1}, {0x03D7, 0x03D7, -8, 1}, {0x03D9, 0x03EF, -1, 2}, {0x03F0, 0x03F0, -86, 1},
+        {0x03F1, 0x03F1, -80, 1}, {0x03F2, 0x03F2, 7, 1}, {0x03F3, 0x03F3, -116, 1}, {0x03F5, 0x03F5, -96, 1},
+        {0x03F8, 0x03F8, -1, 1}, {0x03FB, 0x03FB, -1, 1}, {0x0430, 0x044F, -32, 1}, {0x0450, 0x045F, -80, 1},
+        {0x0461, 0x0481, -1, 2}, {0x048B, 0x04BF, -1, 2}, {0x04C2, 0x04CE, -1, 2}, {0x04CF, 0x04CF, -15, 1},
+        {0x04D1, 0x052F, -1, 2}, {0x0561, 0x0586, -48, 1}, {0x10D0, 0x10FA, 3008, 1}, {0x10FD, 0x10FF, 3008, 1},
+        {0x13F8, 0x13FD, -8, 1}, {0x1C80, 0x1C80, -6254, 1}, {0x1C81, 0x1C81, -6253, 1}, {0x1C82, 0x1C82, -6244, 1},
+        {0x1C83, 0x1C84, -6242, 1}, {0x1C85, 0x1C85, -6243, 1}, {0x1C86, 0x1C86, -6236, 1}, {0x1C87, 0x1C87, -6181, 1},
+        {0x1C88, 0x1C88, 35266, 1}, {0x1D79, 0x1D79, 35332, 1}, {0x1D7D, 0x1D7D, 3814, 1}, {0x1D8E, 0x1D8E, 35384, 1},
+        {0x1E01, 0x1E95, -1, 2}, {0x1E9B, 0x1E9B, -59, 1}, {0x1EA1, 0x1EFF, -1, 2}, {0x1F00, 0x1F07, 8, 1},
+        {0x1F10, 0x1F15, 8, 1}, {0x1F20, 0x1F27, 8, 1}, {0x1F30, 0x1F37, 8, 1}, {0x1F40, 0x1F45, 8, 1},
+        {0x1F51, 0x1F57, 8, 2}, {0x1F60, 0x1F67, 8, 1}, {0x1F70, 0x1F71, 74, 1}, {0x1F72, 0x1F75, 86, 1},
+        {0x1F76, 0x1F77, 100, 1}, {0x1F78, 0x1F79, 128, 1}, {0x1F7A, 0x1F7B, 112, 1}, {0x1F7C, 0x1F7D, 126, 1},
+        {0x1FB0, 0x1FB1, 8, 1}, {0x1FBE, 0x1FBE, -7205, 1}, {0x1FD0, 0x1FD1, 8, 1}, {0x1FE0, 0x1FE1, 8, 1},
+        {0x1FE5, 0x1FE5, 7, 1}, {0x214E, 0x214E, -28, 1}, {0x2170, 0x217F, -16, 1}, {0x2184, 0x2184, -1, 1},
+        {0x24D0, 0x24E9, -26, 1}, {0x2C30, 0x2C5F, -48, 1}, {0x2C61, 0x2C61, -1, 1}, {0x2C65, 0x2C65, -10795, 1},
+        {0x2C66, 0x2C66, -10792, 1}, {0x2C68, 0x2C6C, -1, 2}, {0x2C73, 0x2C73, -1, 1}, {0x2C76, 0x2C76, -1, 1},
+        {0x2C81, 0x2CE3, -1, 2}, {0x2CEC, 0x2CEE, -1, 2}, {0x2CF3, 0x2CF3, -1, 1}, {0x2D00, 0x2D25, -7264, 1},
+        {0x2D27, 0x2D27, -7264, 1}, {0x2D2D, 0x2D2D, -7264, 1}, {0xA641, 0xA66D, -1, 2}, {0xA681, 0xA69B, -1, 2},
+        {0xA723, 0xA72F, -1, 2}, {0xA733, 0xA76F, -1, 2}, {0xA77A, 0xA77C, -1, 2}, {0xA77F, 0xA787, -1, 2},
+        {0xA78C, 0xA78C, -1, 1}, {0xA791, 0xA793, -1, 2}, {0xA794, 0xA794, 48, 1}, {0xA797, 0xA7A9, -1, 2},
+        {0xA7B5, 0xA7C3, -1, 2}, {0xA7C8, 0xA7CA, -1, 2}, {0xA7D1, 0xA7D1, -1, 1}, {0xA7D7, 0xA7D9, -1, 2},
+        {0xA7F6, 0xA7F6, -1, 1}, {0xAB53, 0xAB53, -928, 1}, {0xAB70, 0xABBF, -38864, 1}, {0xFF41, 0xFF5A, -32, 1},
+        {0x10428, 0x1044F, -40, 1}, {0x104D8, 0x104FB, -40, 1}, {0x10597, 0x105A1, -39, 1}, {0x105A3, 0x105B1, -39, 1},
+        {0x105B3, 0x105B9, -39, 1}, {0x105BB, 0x105BC, -39, 1}, {0x10CC0, 0x10CF2, -64, 1}, {0x118C0, 0x118DF, -32, 1},
+        {0x16E60, 0x16E7F, -32, 1}, {0x1E922, 0x1E943, -34, 1},
+    };
+
+    /**
+     * @brief Simple lowercase mappings, in the same form as upperRanges
+     */
+    inline constexpr CaseRange lowerRanges[] = {
+        {0x0041, 0x005A, 32, 1}, {0x00C0, 0x00D6, 32, 1}, {0x00D8, 0x00DE, 32, 1}, {0x0100, 0x012E, 1, 2},
+        {0x0132, 0x0136, 1, 2}, {0x0139, 0x0147, 1, 2}, {0x014A, 0x0176, 1, 2}, {0x0178, 0x0178, -121, 1},
+        {0x0179, 0x017D, 1, 2}, {0x0181, 0x0181, 210, 1}, {0x0182, 0x0184, 1, 2}, {0x0186, 0x0186, 206, 1},
+        {0x0187, 0x0187, 1, 1}, {0x0189, 0x018A, 205, 1}, {0x018B, 0x018B, 1, 1}, {0x018E, 0x018E, 79, 1},
+        {0x018F, 0x018F, 202, 1}, {0x0190, 0x0190, 203, 1}, {0x0191, 0x0191, 1, 1}, {0x0193, 0x0193, 205, 1},
+        {0x0194, 0x0194, 207, 1}, {0x0196, 0x0196, 211, 1}, {0x0197, 0x0197, 209, 1}, {0x0198, 0x0198, 1, 1},
+        {0x019C, 0x019C, 211, 1}, {0x019D, 0x019D, 213, 1}, {0x019F, 0x019F, 214, 1}, {0x01A0, 0x01A4, 1, 2},
+        {0x01A6, 0x01A6, 218, 1}, {0x01A7, 0x01A7, 1, 1}, {0x01A9, 0x01A9, 218, 1}, {0x01AC, 0x01AC, 1, 1},
+        {0x01AE, 0x01AE, 218, 1}, {0x01AF, 0x01AF, 1, 1}, {0x01B1, 0x01B2, 217, 1}, {0x01B3, 0x01B5, 1, 2},
+        {0x01B7, 0x01B7, 219, 1}, {0x01B8, 0x01B8, 1, 1}, {0x01BC, 0x01BC, 1, 1}, {0x01C4, 0x01C4, 2, 1},
+        {0x01C5, 0x01C5, 1, 1}, {0x01C7, 0x01C7, 2, 1}, {0x01C8, 0x01C8, 1, 1}, {0x01CA, 0x01CA, 2, 1},
+        {0x01CB, 0x01DB, 1, 2}, {0x01DE, 0x01EE, 1, 2}, {0x01F1, 0x01F1, 2, 1}, {0x01F2, 0x01F4, 1, 2},
+        {0x01F6, 0x01F6, -97, 1}, {0x01F7, 0x01F7, -56, 1}, {0x01F8, 0x021E, 1, 2}, {0x0220, 0x0220, -130, 1},
+        {0x0222, 0x0232, 1, 2}, {0x023A, 0x023A, 10795, 1}, {0x023B, 0x023B, 1, 1}, {0x023D, 0x023D, -163, 1},
+        {0x023E, 0x023E, 10792, 1}, {0x0241, 0x0241, 1, 1}, {0x0243, 0x0243, -195, 1}, {0x0244, 0x0244, 69, 1},
+        {0x0245, 0x0245, 71, 1}, {0x0246, 0x024E, 1, 2}, {0x0370, 0x0372, 1, 2}, {0x0376, 0x0376, 1, 1},
+        {0x037F, 0x037F, 116, 1}, {0x0386, 0x0386, 38, 1}, {0x0388, 0x038A, 37, 1}, {0x038C, 0x038C, 64, 1},
+        {0x038E, 0x038F, 63, 1}, {0x0391, 0x03A1, 32, 1}, {0x03A3, 0x03AB, 32, 1}, {0x03CF, 0x03CF, 8, 1},
+        {0x03D8, 0x03EE, 1, 2}, {0x03F4, 0x03F4, -60, 1}, {0x03F7, 0x03F7, 1, 1}, {0x03F9, 0x03F9, -7, 1},
+        {0x03FA, 0x03FA, 1, 1}, {0x03FD, 0x03FF, -130, 1}, {0x0400, 0x040F, 80, 1}, {0x0410, 0x042F, 32, 1},
+        {0x0460, 0x0480, 1, 2}, {0x048A, 0x04BE, 1, 2}, {0x04C0, 0x04C0, 15, 1}, {0x04C1, 0x04CD, 1, 2},
+        {0x04D0, 0x052E, 1, 2}, {0x0531, 0x0556, 48, 1}, {0x10A0, 0x10C5, 7264, 1}, {0x10C7, 0x10C7, 7264, 1},
+        {0x10CD, 0x10CD, 7264, 1}, {0x13A0, 0x13EF, 38864, 1}, {0x13F0, 0x13F5, 8, 1}, {0x1C90, 0x1CBA, -3008, 1},
+        {0x1CBD, 0x1CBF, -3008, 1}, {0x1E00, 0x1E94, 1, 2}, {0x1E9E, 0x1E9E, -7615, 1}, {0x1EA0, 0x1EFE, 1, 2},
+        {0x1F08, 0x1F0F, -8, 1}, {0x1F18, 0x1F1D, -8, 1}, {0x1F28, 0x1F2F, -8, 1}, {0x1F38, 0x1F3F, -8, 1},
+        {0x1F48, 0x1F4D, -8, 1}, {0x1F59, 0x1F5F, -8, 2}, {0x1F68, 0x1F6F, -8, 1}, {0x1F88, 0x1F8F, -8, 1},
+        {0x1F98, 0x1F9F, -8, 1}, {0x1FA8, 0x1FAF, -8, 1}, {0x1FB8, 0x1FB9, -8, 1}, {0x1FBA, 0x1FBB, -74, 1},
+        {0x1FBC, 0x1FBC, -9, 1}, {0x1FC8, 0x1FCB, -86, 1}, {0x1FCC, 0x1FCC, -9, 1}, {0x1FD8, 0x1FD9, -8, 1},
+        {0x1FDA, 0x1FDB, -100, 1}, {0x1FE8, 0x1FE9, -8, 1}, {0x1FEA, 0x1FEB, -112, 1}, {0x1FEC, 0x1FEC, -7, 1},
+        {0x1FF8, 0x1FF9, -128, 1}, {0x1FFA, 0x1FFB, -126, 1}, {0x1FFC, 0x1FFC, -9, 1}, {0x2126, 0x2126, -7517, 1},
+        {0x212A, 0x212A, -8383, 1}, {0x212B, 0x212B, -8262, 1}, {0x2132, 0x2132, 28, 1}, {0x2160, 0x216F, 16, 1},
+        {0x2183, 0x2183, 1, 1}, {0x24B6, 0x24CF, 26, 1}, {0x2C00, 0x2C2F, 48, 1}, {0x2C60, 0x2C60, 1, 1},
+        {0x2C62, 0x2C62, -10743, 1}, {0x2C63, 0x2C63, -3814, 1}, {0x2C64, 0x2C64, -10727, 1}, {0x2C67, 0x2C6B, 1, 2},
+        {0x2C6D, 0x2C6D, -10780, 1}, {0x2C6E, 0x2C6E, -10749, 1}, {0x2C6F, 0x2C6F, -10783, 1}, {0x2C70, 0x2C70, -10782, 1},
+        {0x2C72, 0x2C72, 1, 1}, {0x2C75, 0x2C75, 1, 1}, {0x2C7E, 0x2C7F, -10815, 1}, {0x2C80, 0x2CE2, 1, 2},
+        {0x2CEB, 0x2CED, 1, 2}, {0x2CF2, 0x2CF2, 1, 1}, {0xA640, 0xA66C, 1, 2}, {0xA680, 0xA69A, 1, 2},
+        {0xA722, 0xA72E, 1, 2}, {0xA732, 0xA76E, 1, 2}, {0xA779, 0xA77B, 1, 2}, {0xA77D, 0xA77D, -35332, 1},
+        {0xA77E, 0xA786, 1, 2}, {0xA78B, 0xA78B, 1, 1}, {0xA78D, 0xA78D, -42280, 1}, {0xA790, 0xA792, 1, 2},
+        {0xA796, 0xA7A8, 1, 2}, {0xA7AA, 0xA7AA, -42308, 1}, {0xA7AB, 0xA7AB, -42319, 1}, {0xA7AC, 0xA7AC, -42315, 1},
+        {0xA7AD, 0xA7AD, -42305, 1}, {0xA7AE, 0xA7AE, -42308, 1}, {0xA7B0, 0xA7B0, -42258, 1}, {0xA7B1, 0xA7B1, -42282, 1},
+        {0xA7B2, 0xA7B2, -42261, 1}, {0xA7B3, 0xA7B3, 928, 1}, {0xA7B4, 0xA7C2, 1, 2}, {0xA7C4, 0xA7C4, -48, 1},
+        {0xA7C5, 0xA7C5, -42307, 1}, {0xA7C6, 0xA7C6, -35384, 1}, {0xA7C7, 0xA7C9, 1, 2}, {0xA7D0, 0xA7D0, 1, 1},
+        {0xA7D6, 0xA7D8, 1, 2}, {0xA7F5, 0xA7F5, 1, 1}, {0xFF21, 0xFF3A, 32, 1}, {0x10400, 0x10427, 40, 1},
+        {0x104B0, 0x104D3, 40, 1}, {0x10570, 0x1057A, 39, 1}, {0x1057C, 0x1058A, 39, 1}, {0x1058C, 0x10592, 39, 1},
+        {0x10594, 0x10595, 39, 1}, {0x10C80, 0x10CB2, 64, 1}, {0x118A0, 0x118BF, 32, 1}, {0x16E40, 0x16E5F, 32, 1},
+        {0x1E900, 0x1E921, 34, 1},
+    };
+
+    /**
+     * @brief Titlecase mappings that differ from the uppercase mapping (digraphs, Georgian, Greek with iota)
+     */
+    inline constexpr CaseRange titleRanges[] = {
+        {0x01C4, 0x01C4, 1, 1}, {0x01C5, 0x01C5, 0, 1}, {0x01C6, 0x01C6, -1, 1}, {0x01C7, 0x01C7, 1, 1},
+        {0x01C8, 0x01C8, 0, 1}, {0x01C9, 0x01C9, -1, 1}, {0x01CA, 0x01CA, 1, 1}, {0x01CB, 0x01CB, 0, 1},
+        {0x01CC, 0x01CC, -1, 1}, {0x01F1, 0x01F1, 1, 1}, {0x01F2, 0x01F2, 0, 1}, {0x01F3, 0x01F3, -1, 1},
+        {0x10D0, 0x10FA, 0, 1}, {0x10FD, 0x10FF, 0, 1},
+    };
+
+    /**
+     * @brief Code points whose uppercase (and titlecase) is more than one code point, as UTF-8
+     */
+    inline constexpr SpecialCasing specialCasings[] = {
+        {0x00DF, "SS", "Ss"},
+        {0x0149, "\xCA\xBC\x4E", "\xCA\xBC\x4E"},
+        {0x01F0, "\x4A\xCC\x8C", "\x4A\xCC\x8C"},
+        {0x0390, "\xCE\x99\xCC\x88\xCC\x81", "\xCE\x99\xCC\x88\xCC\x81"},
+        {0x03B0, "\xCE\xA5\xCC\x88\xCC\x81", "\xCE\xA5\xCC\x88\xCC\x81"},
+        {0x0587, "\xD4\xB5\xD5\x92", "\xD4\xB5\xD6\x82"},
+        {0x1E96, "\x48\xCC\xB1", "\x48\xCC\xB1"},
+        {0x1E97, "\x54\xCC\x88", "\x54\xCC\x88"},
+        {0x1E98, "\x57\xCC\x8A", "\x57\xCC\x8A"},
+        {0x1E99, "\x59\xCC\x8A", "\x59\xCC\x8A"},
+        {0x1E9A, "\x41\xCA\xBE", "\x41\xCA\xBE"},
+        {0x1F50, "\xCE\xA5\xCC\x93", "\xCE\xA5\xCC\x93"},
+        {0x1F52, "\xCE\xA5\xCC\x93\xCC\x80", "\xCE\xA5\xCC\x93\xCC\x80"},
+        {0x1F54, "\xCE\xA5\xCC\x93\xCC\x81", "\xCE\xA5\xCC\x93\xCC\x81"},
+        {0x1F56, "\xCE\xA5\xCC\x93\xCD\x82", "\xCE\xA5\xCC\x93\xCD\x82"},
+        {0x1F80, "\xE1\xBC\x88\xCE\x99", "\xE1\xBE\x88"},
+        {0x1F81, "\xE1\xBC\x89\xCE\x99", "\xE1\xBE\x89"},
+        {0x1F82, "\xE1\xBC\x8A\xCE\x99", "\xE1\xBE\x8A"},
+        {0x1F83, "\xE1\xBC\x8B\xCE\x99", "\xE1\xBE\x8B"},
+        {0x1F84, "\xE1\xBC\x8C\xCE\x99", "\xE1\xBE\x8C"},
+        {0x1F85, "\xE1\xBC\x8D\xCE\x99", "\xE1\xBE\x8D"},
+        {0x1F86, "\xE1\xBC\x8E\xCE\x99", "\xE1\xBE\x8E"},
+        {0x1F87, "\xE1\xBC\x8F\xCE\x99", "\xE1\xBE\x8F"},
+        {0x1F88, "\xE1\xBC\x88\xCE\x99", "\xE1\xBE\x88"},
+        {0x1F89, "\xE1\xBC\x89\xCE\x99", "\xE1\xBE\x89"},
+        {0x1F8A, "\xE1\xBC\x8A\xCE\x99", "\xE1\xBE\x8A"},
+        {0x1F8B, "\xE1\xBC\x8B\xCE\x99", "\xE1\xBE\x8B"},
+        {0x1F8C, "\xE1\xBC\x8C\xCE\x99", "\xE1\xBE\x8C"},
+        {0x1F8D, "\xE1\xBC\x8D\xCE\x99", "\xE1\xBE\x8D"},
+        {0x1F8E, "\xE1\xBC\x8E\xCE\x99", "\xE1\xBE\x8E"},
+        {0x1F8F, "\xE1\xBC\x8F\xCE\x99", "\xE1\xBE\x8F"},
+        {0x1F90, "\xE1\xBC\xA8\xCE\x99", "\xE1\xBE\x98"},
+        {0x1F91, "\xE1\xBC\xA9\xCE\x99", "\xE1\xBE\x99"},
+        {0x1F92, "\xE1\xBC\xAA\xCE\x99", "\xE1\xBE\x9A"},
+        {0x1F93, "\xE1\xBC\xAB\xCE\x99", "\xE1\xBE\x9B"},
+        {0x1F94, "\xE1\xBC\xAC\xCE\x99", "\xE1\xBE\x9C"},
+        {0x1F95, "\xE1\xBC\xAD\xCE\x99", "\xE1\xBE\x9D"},
+        {0x1F96, "\xE1\xBC\xAE\xCE\x99", "\xE1\xBE\x9E"},
+        {0x1F97, "\xE1\xBC\xAF\xCE\x99", "\xE1\xBE\x9F"},
+        {0x1F98, "\xE1\xBC\xA8\xCE\x99", "\xE1\xBE\x98"},
+        {0x1F99, "\xE1\xBC\xA9\xCE\x99", "\xE1\xBE\x99"},
+        {0x1F9A, "\xE1\xBC\xAA\xCE\x99", "\xE1\xBE\x9A"},
+        {0x1F9B, "\xE1\xBC\xAB\xCE\x99", "\xE1\xBE\x9B"},
+        {0x1F9C, "\xE1\xBC\xAC\xCE\x99", "\xE1\xBE\x9C"},
+        {0x1F9D, "\xE1\xBC\xAD\xCE\x99", "\xE1\xBE\x9D"},
+        {0x1F9E, "\xE1\xBC\xAE\xCE\x99", "\xE1\xBE\x9E"},
+        {0x1F9F, "\xE1\xBC\xAF\xCE\x99", "\xE1\xBE\x9F"},
+        {0x1FA0, "\xE1\xBD\xA8\xCE\x99", "\xE1\xBE\xA8"},
+        {0x1FA1, "\xE1\xBD\xA9\xCE\x99", "\xE1\xBE\xA9"},
+        {0x1FA2, "\xE1\xBD\xAA\xCE\x99", "\xE1\xBE\xAA"},
+        {0x1FA3, "\xE1\xBD\xAB\xCE\x99", "\xE1\xBE\xAB"},
+        {0x1FA4, "\xE1\xBD\xAC\xCE\x99", "\xE1\xBE\xAC"},
+        {0x1FA5, "\xE1\xBD\xAD\xCE\x99", "\xE1\xBE\xAD"},
+        {0x1FA6, "\xE1\xBD\xAE\xCE\x99", "\xE1\xBE\xAE"},
+        {0x1FA7, "\xE1\xBD\xAF\xCE\x99", "\xE1\xBE\xAF"},
+        {0x1FA8, "\xE1\xBD\xA8\xCE\x99", "\xE1\xBE\xA8"},
+        {0x1FA9, "\xE1\xBD\xA9\xCE\x99", "\xE1\xBE\xA9"},
+        {0x1FAA, "\xE1\xBD\xAA\xCE\x99", "\xE1\xBE\xAA"},
+        {0x1FAB, "\xE1\xBD\xAB\xCE\x99", "\xE1\xBE\xAB"},
+        {0x1FAC, "\xE1\xBD\xAC\xCE\x99", "\xE1\xBE\xAC"},
+        {0x1FAD, "\xE1\xBD\xAD\xCE\x99", "\xE1\xBE\xAD"},
+        {0x1FAE, "\xE1\xBD\xAE\xCE\x99", "\xE1\xBE\xAE"},
+        {0x1FAF, "\xE1\xBD\xAF\xCE\x99", "\xE1\xBE\xAF"},
+        {0x1FB2, "\xE1\xBE\xBA\xCE\x99", "\xE1\xBE\xBA\xCD\x85"},
+        {0x1FB3, "\xCE\x91\xCE\x99", "\xE1\xBE\xBC"},
+        {0x1FB4, "\xCE\x86\xCE\x99", "\xCE\x86\xCD\x85"},
+        {0x1FB6, "\xCE\x91\xCD\x82", "\xCE\x91\xCD\x82"},
+        {0x1FB7, "\xCE\x91\xCD\x82\xCE\x99", "\xCE\x91\xCD\x82\xCD\x85"},
+        {0x1FBC, "\xCE\x91\xCE\x99", "\xE1\xBE\xBC"},
+        {0x1FC2, "\xE1\xBF\x8A\xCE\x99", "\xE1\xBF\x8A\xCD\x85"},
+        {0x1FC3, "\xCE\x97\xCE\x99", "\xE1\xBF\x8C"},
+        {0x1FC4, "\xCE\x89\xCE\x99", "\xCE\x89\xCD\x85"},
+        {0x1FC6, "\xCE\x97\xCD\x82", "\xCE\x97\xCD\x82"},
+        {0x1FC7, "\xCE\x97\xCD\x82\xCE\x99", "\xCE\x97\xCD\x82\xCD\x85"},
+        {0x1FCC, "\xCE\x97\xCE\x99", "\xE1\xBF\x8C"},
+        {0x1FD2, "\xCE\x99\xCC\x88\xCC\x80", "\xCE\x99\xCC\x88\xCC\x80"},
+        {0x1FD3, "\xCE\x99\xCC\x88\xCC\x81", "\xCE\x99\xCC\x88\xCC\x81"},
+        {0x1FD6, "\xCE\x99\xCD\x82", "\xCE\x99\xCD\x82"},
+        {0x1FD7, "\xCE\x99\xCC\x88\xCD\x82", "\xCE\x99\xCC\x88\xCD\x82"},
+        {0x1FE2, "\xCE\xA5\xCC\x88\xCC\x80", "\xCE\xA5\xCC\x88\xCC\x80"},
+        {0x1FE3, "\xCE\xA5\xCC\x88\xCC\x81", "\xCE\xA5\xCC\x88\xCC\x81"},
+        {0x1FE4, "\xCE\xA1\xCC\x93", "\xCE\xA1\xCC\x93"},
+        {0x1FE6, "\xCE\xA5\xCD\x82", "\xCE\xA5\xCD\x82"},
+        {0x1FE7, "\xCE\xA5\xCC\x88\xCD\x82", "\xCE\xA5\xCC\x88\xCD\x82"},
+        {0x1FF2, "\xE1\xBF\xBA\xCE\x99", "\xE1\xBF\xBA\xCD\x85"},
+        {0x1FF3, "\xCE\xA9\xCE\x99", "\xE1\xBF\xBC"},
+        {0x1FF4, "\xCE\x8F\xCE\x99", "\xCE\x8F\xCD\x85"},
+        {0x1FF6, "\xCE\xA9\xCD\x82", "\xCE\xA9\xCD\x82"},
+        {0x1FF7, "\xCE\xA9\xCD\x82\xCE\x99", "\xCE\xA9\xCD\x82\xCD\x85"},
+        {0x1FFC, "\xCE\xA9\xCE\x99", "\xE1\xBF\xBC"},
+        {0xFB00, "FF", "Ff"},
+        {0xFB01, "FI", "Fi"},
+        {0xFB02, "FL", "Fl"},
+        {0xFB03, "FFI", "Ffi"},
+        {0xFB04, "FFL", "Ffl"},
+        {0xFB05, "ST", "St"},
+        {0xFB06, "ST", "St"},
+        {0xFB13, "\xD5\x84\xD5\x86", "\xD5\x84\xD5\xB6"},
+        {0xFB14, "\xD5\x84\xD4\xB5", "\xD5\x84\xD5\xA5"},
+        {0xFB15, "\xD5\x84\xD4\xBB", "\xD5\x84\xD5\xAB"},
+        {0xFB16, "\xD5\x8E\xD5\x86", "\xD5\x8E\xD5\xB6"},
+        {0xFB17, "\xD5\x84\xD4\xBD", "\xD5\x84\xD5\xAD"},
+    };
+  } // namespace detail
+} // namespace i18n
+
+#endif // I18N_UNICODE_TABLES_HPP
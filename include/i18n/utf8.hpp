@@ -0,0 +1,215 @@
+#ifndef I18N_UTF8_HPP
+#define I18N_UTF8_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define I18N_UTF8_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define I18N_UTF8_NEON 1
+#endif
+
+namespace i18n
+{
+  namespace detail
+  {
+    /**
+     * @brief Number of leading ASCII bytes, scanning 16 bytes per step with SSE2/NEON and
+     * 8 bytes per step (SWAR) elsewhere
+     */
+    inline std::size_t asciiPrefix(const char *data, std::size_t size)
+    {
+      std::size_t i = 0;
+#if defined(I18N_UTF8_SSE2)
+      for (; i + 16 <= size; i += 16)
+      {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+        if (mask != 0)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+          return i + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+#else
+          break;
+#endif
+        }
+      }
+#elif defined(I18N_UTF8_NEON)
+      for (; i + 16 <= size; i += 16)
+      {
+        if (vmaxvq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t *>(data + i))) >= 0x80)
+        {
+          break;
+        }
+      }
+#endif
+      for (; i + 8 <= size; i += 8)
+      {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        if (word & 0x8080808080808080ull)
+        {
+          break;
+        }
+      }
+      while (i < size && static_cast<unsigned char>(data[i]) < 0x80)
+      {
+        ++i;
+      }
+      return i;
+    }
+
+    /**
+     * @brief Check one multi-byte sequence starting at @p data (Unicode Table 3-7)
+     *
+     * @param data First byte of the sequence, which is not ASCII
+     * @param size Bytes available
+     * @param length Set to the sequence length when valid, otherwise to the length of the
+     *               maximal subpart to replace (at least 1)
+     * @return true if the sequence is well-formed
+     */
+    inline bool checkSequence(const unsigned char *data, std::size_t size, std::size_t &length)
+    {
+      unsigned char lead = data[0];
+      std::size_t needed;
+      unsigned char low = 0x80;
+      unsigned char high = 0xBF;
+
+      if (lead >= 0xC2 && lead <= 0xDF)
+      {
+        needed = 2;
+      }
+      else if (lead >= 0xE0 && lead <= 0xEF)
+      {
+        needed = 3;
+        low = lead == 0xE0 ? 0xA0 : 0x80;
+        high = lead == 0xED ? 0x9F : 0xBF;
+      }
+      else if (lead >= 0xF0 && lead <= 0xF4)
+      {
+        needed = 4;
+        low = lead == 0xF0 ? 0x90 : 0x80;
+        high = lead == 0xF4 ? 0x8F : 0xBF;
+      }
+      else
+      {
+        length = 1;
+        return false;
+      }
+
+      // The second byte has a lead-specific range; later bytes are plain continuations.
+      for (std::size_t i = 1; i < needed; ++i)
+      {
+        if (i >= size || data[i] < low || data[i] > high)
+        {
+          length = i;
+          return false;
+        }
+        low = 0x80;
+        high = 0xBF;
+      }
+      length = needed;
+      return true;
+    }
+  } // namespace detail
+
+  /**
+   * @brief How catalog loading treats strings that are not valid UTF-8.
+   */
+  enum class InvalidUtf8 : std::uint8_t
+  {
+    /**
+     * @brief Fail the load with std::runtime_error
+     */
+    Reject = 0,
+
+    /**
+     * @brief Replace each maximal invalid subpart with U+FFFD
+     */
+    Repair = 1
+  };
+
+  /**
+   * @brief Check whether every byte of @p text is ASCII (vectorized)
+   */
+  inline bool isAscii(std::string_view text)
+  {
+    return detail::asciiPrefix(text.data(), text.size()) == text.size();
+  }
+
+  /**
+   * @brief Validate UTF-8, rejecting overlong forms, surrogates and code points above U+10FFFF
+   *
+   * ASCII runs are skipped with the vectorized scan of isAscii(); only multi-byte sequences
+   * are decoded one at a time.
+   *
+   * @param text The bytes to check
+   * @return std::size_t Offset of the first invalid sequence, or std::string_view::npos if valid
+   */
+  inline std::size_t validateUtf8(std::string_view text)
+  {
+    const auto *data = reinterpret_cast<const unsigned char *>(text.data());
+    std::size_t i = 0;
+    while (true)
+    {
+      i += detail::asciiPrefix(text.data() + i, text.size() - i);
+      if (i == text.size())
+      {
+        return std::string_view::npos;
+      }
+
+      std::size_t length;
+      if (!detail::checkSequence(data + i, text.size() - i, length))
+      {
+        return i;
+      }
+      i += length;
+    }
+  }
+
+  /**
+   * @brief Copy @p text, replacing every maximal invalid subpart with U+FFFD
+   *
+   * Follows the substitution practice recommended by the Unicode Standard (and the WHATWG
+   * Encoding Standard), so repaired output matches what browsers display.
+   *
+   * @param text The bytes to repair
+   * @return std::string Valid UTF-8
+   */
+  inline std::string repairUtf8(std::string_view text)
+  {
+    std::string repaired;
+    repaired.reserve(text.size());
+    const auto *data = reinterpret_cast<const unsigned char *>(text.data());
+    std::size_t i = 0;
+    while (i < text.size())
+    {
+      std::size_t ascii = detail::asciiPrefix(text.data() + i, text.size() - i);
+      repaired.append(text.data() + i, ascii);
+      i += ascii;
+      if (i == text.size())
+      {
+        break;
+      }
+
+      std::size_t length;
+      if (detail::checkSequence(data + i, text.size() - i, length))
+      {
+        repaired.append(text.data() + i, length);
+      }
+      else
+      {
+        repaired.append("\xEF\xBF\xBD");
+      }
+      i += length;
+    }
+    return repaired;
+  }
+} // namespace i18n
+
+#endif // I18N_UTF8_HPP
@@ -0,0 +1,224 @@
+// Allocation budgets of the lookup APIs. Global operator new (and, on glibc, malloc) is
+// replaced by counting versions; each check runs a lookup after a warm-up call and fails if
+// it allocates more than its budget. Exits non-zero if any budget is exceeded.
+
+#include <i18n/catalog.hpp>
+#include <i18n/i18n.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define I18N_COUNT_MALLOC 1
+#endif
+
+namespace
+{
+  std::atomic<std::size_t> allocations{0};
+
+#if defined(I18N_COUNT_MALLOC)
+  extern "C" void *__libc_malloc(std::size_t size);
+  extern "C" void *__libc_calloc(std::size_t count, std::size_t size);
+  extern "C" void *__libc_realloc(void *pointer, std::size_t size);
+  extern "C" void __libc_free(void *pointer);
+#endif
+
+  /**
+   * @brief Allocate without going through the counting malloc
+   */
+  void *rawMalloc(std::size_t size)
+  {
+#if defined(I18N_COUNT_MALLOC)
+    return __libc_malloc(size);
+#else
+    return std::malloc(size);
+#endif
+  }
+} // namespace
+
+#if defined(I18N_COUNT_MALLOC)
+// C allocations made by the library (or by anything it calls) count too.
+extern "C" void *malloc(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(std::size_t count, std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *pointer, std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(pointer, size);
+}
+
+extern "C" void free(void *pointer)
+{
+  __libc_free(pointer);
+}
+#endif
+
+void *operator new(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *pointer = rawMalloc(size ? size : 1))
+  {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  std::size_t align = static_cast<std::size_t>(alignment);
+  if (void *pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+  {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+  std::free(pointer);
+}
+
+namespace
+{
+  enum class Status
+  {
+    Active,
+    Closed
+  };
+} // namespace
+
+template <>
+struct i18n::EnumKeys<Status>
+{
+  static constexpr std::string_view prefix = "status";
+  static constexpr std::string_view names[] = {"active", "closed"};
+};
+
+namespace
+{
+  int failures = 0;
+
+  /**
+   * @brief Run @p lookup once to warm up, then count the allocations of a second run
+   */
+  template <typename Lookup>
+  void expect(const char *name, std::size_t budget, Lookup &&lookup)
+  {
+    lookup();
+    std::size_t before = allocations.load(std::memory_order_relaxed);
+    lookup();
+    std::size_t used = allocations.load(std::memory_order_relaxed) - before;
+
+    bool ok = used <= budget;
+    failures += ok ? 0 : 1;
+    std::printf("%s %-48s %zu allocation(s), budget %zu\n", ok ? "PASS" : "FAIL", name, used, budget);
+  }
+} // namespace
+
+int main()
+{
+  nlohmann::json json = {
+      {"en", {{"greeting", "Hello"}, {"user", {{"farewell", "Goodbye and see you again soon"}}}, {"status", {{"active", "Active"}, {"closed", "Closed"}}}, {"steps", {"Sign up", "Verify", "Start"}}, {"errors", {{"E1000", "Unknown error"}, {"E1001", "Timeout"}}}}},
+      {"de", {{"greeting", "Hallo"}, {"user", {{"farewell", "Auf Wiedersehen und bis bald"}}}, {"status", {{"active", "Aktiv"}, {"closed", "Geschlossen"}}}, {"steps", {"Registrieren", "Bestaetigen", "Loslegen"}}, {"errors", {{"E1000", "Unbekannter Fehler"}, {"E1001", "Zeitueberschreitung"}}}}},
+      {"id", {{"greeting", "Halo"}, {"user", {{"farewell", "Sampai jumpa lagi"}}}, {"status", {{"active", "Aktif"}, {"closed", "Ditutup"}}}, {"steps", {"Daftar", "Verifikasi", "Mulai"}}, {"errors", {{"E1000", "Kesalahan"}, {"E1001", "Waktu habis"}}}}}};
+
+  i18n::CatalogOptions options;
+  options.codeTables = {"errors.E#"};
+  i18n::Catalog catalog(json, options);
+  catalog.bindEnum<Status>();
+  I18n i18n(json);
+  i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::StderrDiagnostics, i18n::SharedSnapshot> shared(json);
+
+  const i18n::LocaleId de = catalog.findLocale("de");
+  const i18n::KeyId farewell = catalog.findKey("user.farewell");
+  volatile std::size_t sink = 0;
+
+  // Compiled catalog: every lookup returns a view into the catalog and must not allocate.
+  expect("Catalog::findKey(path)", 0, [&]()
+         { sink = sink + catalog.findKey("user.farewell"); });
+  expect("Catalog::findLocale(code)", 0, [&]()
+         { sink = sink + catalog.findLocale("id"); });
+  expect("Catalog::t_view(KeyId, LocaleId)", 0, [&]()
+         { sink = sink + catalog.t_view(farewell, de).size(); });
+  expect("Catalog::t_view(path, langCode)", 0, [&]()
+         { sink = sink + catalog.t_view("user.farewell", "de").size(); });
+  expect("Catalog::t_view(path, langCode) with fallback", 0, [&]()
+         { sink = sink + catalog.t_view("user.farewell", "fr").size(); });
+  expect("Catalog::t_view({segments}, LocaleId)", 0, [&]()
+         { sink = sink + catalog.t_view({"user", "farewell"}, de).size(); });
+  expect("Catalog::t_view(enum, LocaleId)", 0, [&]()
+         { sink = sink + catalog.t_view(Status::Closed, de).size(); });
+  expect("Catalog::t_code(table, code, LocaleId)", 0, [&]()
+         { sink = sink + catalog.t_code("errors", 1001, de).size(); });
+  expect("Catalog::t_array(path, LocaleId)", 0, [&]()
+         { sink = sink + catalog.t_array("steps", de).size(); });
+
+  // Formatting into a reserved buffer: the buffer is sized up front, so appending must not grow it.
+  std::string line;
+  line.reserve(256);
+  expect("append t_view() results to a reserved string", 0, [&]()
+         {
+    line.clear();
+    line.append(catalog.t_view(catalog.findKey("greeting"), de)).append(", ").append(catalog.t_view(farewell, de));
+    sink = sink + line.size(); });
+
+  // JSON-backed lookups into a caller-supplied arena never touch the global heap.
+  expect("I18n::t(path, langCode, resource)", 0, [&]()
+         {
+    char buffer[512];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    sink = sink + i18n.t("user.farewell", "de", &arena).size(); });
+  expect("I18n::t(path, langCode, resource), SharedSnapshot", 0, [&]()
+         {
+    char buffer[512];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    sink = sink + shared.t("user.farewell", "de", &arena).size(); });
+
+  // t() takes its path, locale and default as std::string and returns std::string by value.
+  // Short (SSO) arguments are free; the "Content not found" default is longer than the SSO
+  // buffer and costs two allocations (set in t(), copied into get()), and a translation longer
+  // than the SSO buffer costs one more for the result. The budgets document that cost; use
+  // Catalog::t_view() or the memory-resource overload of t() on hot paths.
+  expect("I18n::t(path, langCode) long translation", 3, [&]()
+         { sink = sink + i18n.t("user.farewell", "de").size(); });
+  expect("I18n::t(path, langCode) short translation", 2, [&]()
+         { sink = sink + i18n.t("greeting", "de").size(); });
+
+  if (failures)
+  {
+    std::printf("%d allocation budget(s) exceeded\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+// Arrays: t_array() returns a locale's elements up to the first one it lacks and never mixes
+// languages; a locale without any element gets the fallback locale's run. Checked in both
+// layouts, after load() and on copies.
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+  std::vector<std::string> elements(i18n::Span<const std::string_view> span)
+  {
+    return std::vector<std::string>(span.begin(), span.end());
+  }
+
+  using Strings = std::vector<std::string>;
+
+  void checkArrays(const i18n::Catalog &catalog)
+  {
+    CHECK(elements(catalog.t_array("steps", "en")) == (Strings{"Sign up", "Verify", "Start", "Done"}));
+    CHECK(elements(catalog.t_array("steps", "de")) == (Strings{"Registrieren", "Bestaetigen", "Loslegen", "Fertig"}));
+    // The run stops at the first missing element instead of borrowing English ones.
+    CHECK(elements(catalog.t_array("steps", "fr")) == (Strings{"Inscription", "Verifier"}));
+    // No elements at all (or no first element): the fallback locale's run.
+    CHECK(elements(catalog.t_array("steps", "ja")) == (Strings{"Sign up", "Verify", "Start", "Done"}));
+    CHECK(elements(catalog.t_array("steps", "id")) == (Strings{"Sign up", "Verify", "Start", "Done"}));
+    CHECK(elements(catalog.t_array("steps", "xx")) == (Strings{"Sign up", "Verify", "Start", "Done"}));
+    CHECK(elements(catalog.t_array("steps", i18n::invalidLocale)).size() == 4);
+
+    CHECK(elements(catalog.t_array("months", "de")) == (Strings{"Januar", "Februar"}));
+    CHECK(catalog.t_array("nested.list", "en").size() == 1);
+    CHECK(catalog.t_array("steps.0", "en").empty());
+    CHECK(catalog.t_array("missing", "en").empty());
+    // Numeric keys that do not start at 0 are a code table, not an array.
+    CHECK(catalog.t_array("pages", "en").empty());
+    CHECK(catalog.t_code("pages", 2, "en") == "Two");
+
+    // Elements are the same views t_view() returns.
+    CHECK(catalog.t_array("steps", "de")[1].data() == catalog.t_view("steps.1", "de").data());
+  }
+} // namespace
+
+int main()
+{
+  nlohmann::json json = {
+      {"en", {{"steps", {"Sign up", "Verify", "Start", "Done"}}, {"months", {"January", "February"}}, {"nested", {{"list", {"x"}}}}, {"pages", {{"1", "One"}, {"2", "Two"}}}}},
+      {"de", {{"steps", {"Registrieren", "Bestaetigen", "Loslegen", "Fertig"}}, {"months", {"Januar", "Februar"}}}},
+      {"fr", {{"steps", {{"0", "Inscription"}, {"1", "Verifier"}, {"3", "Fini"}}}}},
+      {"id", {{"steps", {{"1", "Verifikasi"}, {"2", "Mulai"}}}}},
+      {"ja", {{"greeting", "konnichiwa"}}}};
+
+  i18n::CatalogOptions keyMajor;
+  keyMajor.layout = i18n::Layout::KeyMajor;
+  i18n::CatalogOptions localeMajor;
+  localeMajor.layout = i18n::Layout::LocaleMajor;
+  i18n::Catalog catalog(json, keyMajor);
+  checkArrays(catalog);
+  checkArrays(i18n::Catalog(json, localeMajor));
+
+  // Loading rebuilds the runs; copies keep them.
+  std::string path = (std::filesystem::temp_directory_path() / "i18n-test-arrays.i18nc").string();
+  catalog.save(path);
+  checkArrays(i18n::Catalog::load(path));
+  checkArrays(i18n::Catalog::load(path, i18n::Layout::LocaleMajor));
+  i18n::Catalog copy(catalog);
+  catalog = i18n::Catalog();
+  checkArrays(copy);
+  std::filesystem::remove(path);
+
+  // Without an English fallback, a locale without elements has an empty array.
+  i18n::Catalog noFallback(nlohmann::json{{"de", {{"steps", {"Eins"}}}}, {"fr", {{"other", "x"}}}});
+  CHECK(noFallback.t_array("steps", "de").size() == 1);
+  CHECK(noFallback.t_array("steps", "fr").empty());
+  return test::finish();
+}
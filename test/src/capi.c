@@ -0,0 +1,215 @@
+/* C interface: catalogs opened from JSON, bytes and files, key and locale lookups with fallback,
+ * code tables and arrays, and the NULL handles, out-of-range ids and failed opens every entry
+ * point has to survive. Built as C to keep the header honest. */
+
+#include <i18n/i18n_c.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(expression)                                                \
+  do                                                                     \
+  {                                                                      \
+    if (!(expression))                                                   \
+    {                                                                    \
+      ++failures;                                                        \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #expression);       \
+    }                                                                    \
+  } while (0)
+
+/**
+ * @brief Whether @p text holds exactly the NUL-terminated @p expected
+ */
+static int equals(i18n_string text, const char *expected)
+{
+  return text.data && text.size == strlen(expected) && memcmp(text.data, expected, text.size) == 0;
+}
+
+static i18n_key key(const i18n_catalog *catalog, const char *path)
+{
+  return i18n_find_key(catalog, path, strlen(path));
+}
+
+static i18n_locale locale(const i18n_catalog *catalog, const char *code)
+{
+  return i18n_find_locale(catalog, code, strlen(code));
+}
+
+static void checkCatalog(const i18n_catalog *catalog)
+{
+  i18n_locale en = locale(catalog, "en");
+  i18n_locale de = locale(catalog, "de");
+  i18n_key greeting = key(catalog, "user.greeting");
+  i18n_key farewell = key(catalog, "user.farewell");
+  i18n_string steps[4];
+
+  CHECK(i18n_locale_count(catalog) == 2);
+  CHECK(i18n_key_count(catalog) >= 2);
+  CHECK(en != I18N_INVALID_LOCALE && de != I18N_INVALID_LOCALE);
+  CHECK(greeting != I18N_INVALID_KEY && farewell != I18N_INVALID_KEY);
+  CHECK(locale(catalog, "fr") == I18N_INVALID_LOCALE);
+  CHECK(key(catalog, "user.missing") == I18N_INVALID_KEY);
+  CHECK(equals(i18n_locale_code(catalog, de), "de"));
+  CHECK(equals(i18n_key_name(catalog, greeting), "user.greeting"));
+
+  /* i18n_t() falls back to English, i18n_get() does not. */
+  CHECK(equals(i18n_t(catalog, greeting, de), "Hallo"));
+  CHECK(equals(i18n_t(catalog, farewell, de), "Goodbye"));
+  CHECK(equals(i18n_get(catalog, greeting, de), "Hallo"));
+  CHECK(i18n_get(catalog, farewell, de).data == NULL);
+  CHECK(equals(i18n_t(catalog, farewell, I18N_INVALID_LOCALE), "Goodbye"));
+  CHECK(i18n_t(catalog, I18N_INVALID_KEY, de).data == NULL);
+
+  /* Ids past the end of the catalog are treated like the invalid ids. */
+  CHECK(i18n_t(catalog, (i18n_key)i18n_key_count(catalog), de).data == NULL);
+  CHECK(i18n_t(catalog, 1000000, en).data == NULL);
+  CHECK(equals(i18n_t(catalog, greeting, (i18n_locale)i18n_locale_count(catalog)), "Hello"));
+  CHECK(i18n_get(catalog, greeting, 1000000).data == NULL);
+  CHECK(i18n_locale_code(catalog, (i18n_locale)i18n_locale_count(catalog)).data == NULL);
+  CHECK(i18n_key_name(catalog, (i18n_key)i18n_key_count(catalog)).data == NULL);
+  CHECK(i18n_key_name(catalog, I18N_INVALID_KEY).data == NULL);
+
+  CHECK(equals(i18n_t_code(catalog, "http", 4, 404, de), "Nicht gefunden"));
+  CHECK(equals(i18n_t_code(catalog, "http", 4, 500, de), "Server Error"));
+  CHECK(i18n_t_code(catalog, "http", 4, 403, de).data == NULL);
+  CHECK(i18n_t_code(catalog, "nope", 4, 1, de).data == NULL);
+
+  /* The count is reported even when it exceeds the capacity, which may be 0 with no buffer. */
+  CHECK(i18n_t_array(catalog, "steps", 5, de, steps, 4) == 3);
+  CHECK(equals(steps[0], "Eins") && equals(steps[1], "Zwei") && equals(steps[2], "Drei"));
+  steps[1].data = NULL;
+  CHECK(i18n_t_array(catalog, "steps", 5, en, steps, 1) == 3);
+  CHECK(equals(steps[0], "One") && steps[1].data == NULL);
+  CHECK(i18n_t_array(catalog, "steps", 5, de, NULL, 0) == 3);
+  CHECK(i18n_t_array(catalog, "steps", 5, 1000000, steps, 4) == 3);
+  CHECK(equals(steps[2], "Three"));
+  CHECK(i18n_t_array(catalog, "missing", 7, en, steps, 4) == 0);
+}
+
+/**
+ * @brief Read a whole file into a malloc'd buffer, or return NULL
+ */
+static char *readFile(const char *path, size_t *size)
+{
+  FILE *file = fopen(path, "rb");
+  char *bytes = NULL;
+  long length;
+  if (!file)
+  {
+    return NULL;
+  }
+  if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 && fseek(file, 0, SEEK_SET) == 0)
+  {
+    bytes = malloc((size_t)length);
+    if (bytes && fread(bytes, 1, (size_t)length, file) != (size_t)length)
+    {
+      free(bytes);
+      bytes = NULL;
+    }
+    *size = (size_t)length;
+  }
+  fclose(file);
+  return bytes;
+}
+
+/* argv[1] is test/data/capi.json compiled by i18n-tool; the JSON is repeated here for from_json. */
+int main(int argc, char **argv)
+{
+  static const char json[] =
+      "{\"en\": {\"user\": {\"greeting\": \"Hello\", \"farewell\": \"Goodbye\"},"
+      "          \"http\": {\"200\": \"OK\", \"404\": \"Not Found\", \"500\": \"Server Error\"},"
+      "          \"steps\": [\"One\", \"Two\", \"Three\"]},"
+      " \"de\": {\"user\": {\"greeting\": \"Hallo\"},"
+      "          \"http\": {\"404\": \"Nicht gefunden\"},"
+      "          \"steps\": [\"Eins\", \"Zwei\", \"Drei\"]}}";
+  i18n_catalog *catalog = NULL;
+  i18n_catalog *other = NULL;
+  char *bytes;
+  size_t size = 0;
+
+  if (argc != 2)
+  {
+    printf("Usage: %s <binary catalog>\n", argv[0]);
+    return 2;
+  }
+  CHECK(i18n_abi_version() == I18N_C_ABI_VERSION);
+
+  /* The same answers from JSON, from a file and from memory. */
+  CHECK(i18n_catalog_from_json(json, sizeof json - 1, &catalog) == 0);
+  CHECK(catalog != NULL);
+  if (catalog)
+  {
+    checkCatalog(catalog);
+  }
+  CHECK(i18n_catalog_open(argv[1], &other) == 0);
+  if (other)
+  {
+    checkCatalog(other);
+    i18n_catalog_free(other);
+    other = NULL;
+  }
+  else
+  {
+    printf("  %s\n", i18n_last_error());
+  }
+  bytes = readFile(argv[1], &size);
+  CHECK(bytes != NULL);
+  if (bytes)
+  {
+    CHECK(i18n_catalog_from_bytes(bytes, size, &other) == 0);
+    /* The bytes are copied. */
+    memset(bytes, 0, size);
+    free(bytes);
+    if (other)
+    {
+      checkCatalog(other);
+      i18n_catalog_free(other);
+    }
+  }
+
+  /* A failed open clears the handle and leaves a message for the calling thread. */
+  other = catalog;
+  CHECK(i18n_catalog_open("/nonexistent/i18n-test-capi.i18nc", &other) == -1);
+  CHECK(other == NULL);
+  CHECK(strstr(i18n_last_error(), "/nonexistent/i18n-test-capi.i18nc") != NULL);
+  CHECK(i18n_catalog_open(NULL, &other) == -1);
+  CHECK(i18n_last_error()[0] != '\0');
+  CHECK(i18n_catalog_open(argv[1], NULL) == -1);
+  CHECK(strcmp(i18n_last_error(), "Output handle is NULL") == 0);
+  CHECK(i18n_catalog_from_json("{\"en\": ", 7, &other) == -1);
+  CHECK(other == NULL && i18n_last_error()[0] != '\0');
+  CHECK(i18n_catalog_from_json(NULL, 0, &other) == -1);
+  CHECK(i18n_catalog_from_bytes("garbage", 7, &other) == -1);
+  CHECK(strstr(i18n_last_error(), "binary catalog") != NULL);
+  CHECK(i18n_catalog_from_bytes(NULL, 0, &other) == -1);
+  CHECK(other == NULL);
+
+  /* NULL handles and NULL strings: no crash, nothing found. */
+  CHECK(i18n_locale_count(NULL) == 0);
+  CHECK(i18n_key_count(NULL) == 0);
+  CHECK(i18n_find_locale(NULL, "en", 2) == I18N_INVALID_LOCALE);
+  CHECK(i18n_find_key(NULL, "user.greeting", 13) == I18N_INVALID_KEY);
+  CHECK(i18n_find_key(catalog, NULL, 3) == I18N_INVALID_KEY);
+  CHECK(i18n_find_locale(catalog, NULL, 2) == I18N_INVALID_LOCALE);
+  CHECK(i18n_locale_code(NULL, 0).data == NULL);
+  CHECK(i18n_key_name(NULL, 0).data == NULL);
+  CHECK(i18n_t(NULL, 0, 0).data == NULL);
+  CHECK(i18n_get(NULL, 0, 0).data == NULL);
+  CHECK(i18n_t_code(NULL, "http", 4, 404, 0).data == NULL);
+  CHECK(i18n_t_code(catalog, NULL, 4, 404, 0).data == NULL);
+  CHECK(i18n_t_array(NULL, "steps", 5, 0, NULL, 0) == 0);
+  CHECK(i18n_t_array(catalog, NULL, 5, 0, NULL, 0) == 0);
+  i18n_catalog_free(NULL);
+  i18n_catalog_free(catalog);
+
+  if (failures)
+  {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
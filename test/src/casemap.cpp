@@ -0,0 +1,105 @@
+// Case mapping: Unicode default mappings with expansions (sharp s, final sigma), the Turkish,
+// Dutch and Greek rules, title case word handling, and the catalog's cached t_upper()/t_lower()/
+// t_title() columns, which copies of a catalog share.
+
+#include "check.hpp"
+
+#include <i18n/casemap.hpp>
+#include <i18n/catalog.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+int main()
+{
+  // Default mappings, including expansions and case-less text.
+  CHECK(i18n::toUpper("Hello, World 42") == "HELLO, WORLD 42");
+  CHECK(i18n::toLower("Hello, World 42") == "hello, world 42");
+  CHECK(i18n::toUpper("stra\xC3\x9F" "e") == "STRASSE");
+  CHECK(i18n::toLower("STRASSE") == "strasse");
+  CHECK(i18n::toUpper("\xEF\xAC\x81le") == "FILE"); // fi ligature
+  CHECK(i18n::toUpper("\xC3\xA9t\xC3\xA9") == "\xC3\x89T\xC3\x89");
+  CHECK(i18n::toUpper("\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82") == "\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2");
+  CHECK(i18n::toUpper("\xE6\x97\xA5\xE6\x9C\xAC") == "\xE6\x97\xA5\xE6\x9C\xAC");
+  CHECK(i18n::toUpper("") == "");
+
+  // Turkish and Azerbaijani: i <-> dotted capital I, dotless i <-> I.
+  CHECK(i18n::toUpper("istanbul", "tr") == "\xC4\xB0STANBUL");
+  CHECK(i18n::toUpper("istanbul") == "ISTANBUL");
+  CHECK(i18n::toLower("ISPARTA", "tr") == "\xC4\xB1sparta");
+  CHECK(i18n::toLower("ISPARTA", "az-AZ") == "\xC4\xB1sparta");
+  CHECK(i18n::toLower("\xC4\xB0zmir", "tr") == "izmir");
+  CHECK(i18n::toLower("\xC4\xB0zmir") == "i\xCC\x87zmir");
+  CHECK(i18n::toUpper("\xC4\xB1\xC5\x9F\xC4\xB1k") == "I\xC5\x9EIK");
+  CHECK(i18n::toTitle("istanbul izmir", "tr") == "\xC4\xB0stanbul \xC4\xB0zmir");
+
+  // Dutch: a word-initial ij titlecases as a unit.
+  CHECK(i18n::toTitle("ijsselmeer", "nl") == "IJsselmeer");
+  CHECK(i18n::toTitle("het ijzeren ijkpunt", "nl-BE") == "Het IJzeren IJkpunt");
+  CHECK(i18n::toTitle("ijsselmeer") == "Ijsselmeer");
+  CHECK(i18n::toTitle("bijl", "nl") == "Bijl");
+
+  // Greek: capitals drop the tonos, also when it is a combining mark; final sigma in lower case.
+  CHECK(i18n::toUpper("\xCE\xAC\xCE\xBB\xCF\x86\xCE\xB1", "el") == "\xCE\x91\xCE\x9B\xCE\xA6\xCE\x91");
+  CHECK(i18n::toUpper("\xCE\xAC\xCE\xBB\xCF\x86\xCE\xB1") == "\xCE\x86\xCE\x9B\xCE\xA6\xCE\x91");
+  CHECK(i18n::toUpper("\xCE\xB1\xCC\x81", "el") == "\xCE\x91");
+  CHECK(i18n::toUpper("\xCE\xBF\xCE\xB4\xCF\x8C\xCF\x82", "el-GR") == "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3");
+  CHECK(i18n::toLower("\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3") == "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82");
+  CHECK(i18n::toLower("\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 \xCE\xA3\xCE\x91") == "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82 \xCF\x83\xCE\xB1");
+  CHECK(i18n::toLower("\xCE\xA3") == "\xCF\x83");
+  CHECK(i18n::toLower("\xCE\x9F\xCE\xA3\xCE\x9F\xCE\xA3.") == "\xCE\xBF\xCF\x83\xCE\xBF\xCF\x82.");
+
+  // Title case: per whitespace-separated word, after leading punctuation, not after digits.
+  CHECK(i18n::toTitle("hello wORLD") == "Hello World");
+  CHECK(i18n::toTitle("\"quoted\" (words)") == "\"Quoted\" (Words)");
+  CHECK(i18n::toTitle("3rd place") == "3rd Place");
+  CHECK(i18n::toTitle("\xC3\x9F" "e") == "Sse");
+
+  // appendCaseMapped() appends to any byte container.
+  std::vector<char> bytes = {'>', ' '};
+  i18n::appendCaseMapped("stra\xC3\x9F" "e", i18n::TextCase::Upper, "de", bytes);
+  CHECK(std::string(bytes.begin(), bytes.end()) == "> STRASSE");
+
+  // Catalog variants follow fallback to English, mapped with the requested locale's rules.
+  nlohmann::json json = {
+      {"en", {{"city", "istanbul"}, {"street", "Stra\xC3\x9F" "e"}, {"only", "english text"}}},
+      {"tr", {{"city", "istanbul"}}},
+      {"el", {{"city", "\xCE\x91\xCE\x98\xCE\x97\xCE\x9D\xCE\x91\xCE\xA3"}}},
+      {"nl", {{"city", "ijmuiden"}}}};
+  auto catalog = std::make_unique<i18n::Catalog>(json);
+  CHECK(catalog->t_upper("city", "en") == "ISTANBUL");
+  CHECK(catalog->t_upper("city", "tr") == "\xC4\xB0STANBUL");
+  CHECK(catalog->t_lower("city", "el") == "\xCE\xB1\xCE\xB8\xCE\xB7\xCE\xBD\xCE\xB1\xCF\x82");
+  CHECK(catalog->t_title("city", "nl") == "IJmuiden");
+  CHECK(catalog->t_upper("street", "en") == "STRASSE");
+  CHECK(catalog->t_upper("only", "tr") == "ENGL\xC4\xB0SH TEXT");
+  CHECK(catalog->t_title("only", "fr") == "English Text");
+  CHECK(catalog->t_upper("missing", "en", "default") == "default");
+  // Unchanged text is not copied: the variant is the translation itself.
+  CHECK(catalog->t_lower("only", "en").data() == catalog->t_view("only", "en").data());
+
+  // Copies share the case columns: a column built through one is seen by the other, and views
+  // stay valid after the catalog that built them is gone.
+  i18n::Catalog copy(*catalog);
+  std::string_view upper = copy.t_upper("street", "en");
+  CHECK(catalog->t_upper("street", "en").data() == upper.data());
+  std::string_view title = catalog->t_title("city", "tr");
+  CHECK(copy.t_title("city", "tr").data() == title.data());
+  i18n::Catalog assigned;
+  assigned = copy;
+  CHECK(assigned.t_upper("street", "en").data() == upper.data());
+  catalog.reset();
+  copy = i18n::Catalog(nlohmann::json{{"en", {{"street", "road"}}}});
+  CHECK(copy.t_upper("street", "en") == "ROAD");
+  CHECK(upper == "STRASSE");
+  CHECK(title == "\xC4\xB0stanbul");
+  CHECK(assigned.t_upper("street", "en") == "STRASSE");
+
+  // Building the variants up front gives the same results.
+  i18n::Catalog eager(json);
+  eager.buildCaseVariants();
+  CHECK(eager.t_upper("city", "tr") == "\xC4\xB0STANBUL");
+  CHECK(eager.t_lower("street", "en") == "stra\xC3\x9F" "e");
+  return test::finish();
+}
@@ -0,0 +1,177 @@
+// Binary catalog format: save/load round trips in both layouts, and rejection of corrupt or
+// hostile headers (the counts in the header are untrusted and must never drive an allocation).
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace
+{
+  std::string readFile(const std::string &path)
+  {
+    std::ifstream in(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  }
+
+  i18n::Catalog fromString(const std::string &bytes)
+  {
+    std::shared_ptr<char> copy(new char[bytes.size() + 1], std::default_delete<char[]>());
+    std::memcpy(copy.get(), bytes.data(), bytes.size());
+    return i18n::Catalog::fromBytes(copy, bytes.size());
+  }
+
+  std::string patched(std::string bytes, std::size_t offset, std::uint32_t value)
+  {
+    std::memcpy(&bytes[offset], &value, sizeof(value));
+    return bytes;
+  }
+
+  /**
+   * @brief Every key and locale of @p copy resolves to the same text and metrics as in @p original
+   */
+  bool sameContent(const i18n::Catalog &original, const i18n::Catalog &copy)
+  {
+    if (original.localeCount() != copy.localeCount() || original.keyCount() != copy.keyCount())
+    {
+      return false;
+    }
+    for (std::size_t k = 0; k < original.keyCount(); ++k)
+    {
+      i18n::KeyId key = copy.findKey(original.keyName(static_cast<i18n::KeyId>(k)));
+      for (std::size_t l = 0; l < original.localeCount(); ++l)
+      {
+        i18n::LocaleId locale = copy.findLocale(original.localeCode(static_cast<i18n::LocaleId>(l)));
+        i18n::TextMetrics a = original.t_meta(static_cast<i18n::KeyId>(k), static_cast<i18n::LocaleId>(l));
+        i18n::TextMetrics b = copy.t_meta(key, locale);
+        if (original.t_view(static_cast<i18n::KeyId>(k), static_cast<i18n::LocaleId>(l), "<none>") !=
+                copy.t_view(key, locale, "<none>") ||
+            a.codePoints != b.codePoints || a.graphemes != b.graphemes || a.width != b.width)
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+} // namespace
+
+int main()
+{
+  nlohmann::json json = {
+      {"en", {{"greeting", "Hello"}, {"user", {{"farewell", "Goodbye"}}}, {"steps", {"One", "Two"}}, {"errors", {{"E1", "Bad"}, {"E2", "Worse"}}}}},
+      {"de", {{"greeting", "Hallo"}, {"user", {{"farewell", "Tsch\xc3\xbc\x73"}}}, {"steps", {"Eins", "Zwei"}}}},
+      {"ja", {{"greeting", "\xe3\x81\x93\xe3\x82\x93\xe3\x81\xab\xe3\x81\xa1\xe3\x81\xaf"}}}};
+  i18n::Catalog catalog(json);
+
+  std::string path = (std::filesystem::temp_directory_path() / "i18n-test-catalog.i18nc").string();
+  catalog.save(path);
+  std::string bytes = readFile(path);
+
+  // Round trips: load() and fromBytes() in both layouts, and a re-save of the loaded catalog.
+  for (i18n::Layout layout : {i18n::Layout::KeyMajor, i18n::Layout::LocaleMajor})
+  {
+    i18n::Catalog loaded = i18n::Catalog::load(path, layout);
+    CHECK(loaded.getLayout() == layout);
+    CHECK(sameContent(catalog, loaded));
+    CHECK(loaded.t_view("user.farewell", "ja") == "Goodbye");
+    CHECK(loaded.t_code("steps", 1, "de") == "Zwei");
+    CHECK(loaded.t_array("steps", "de").size() == 2);
+  }
+  CHECK(sameContent(catalog, fromString(bytes)));
+  i18n::Catalog::load(path, i18n::Layout::LocaleMajor).save(path);
+  CHECK(sameContent(catalog, i18n::Catalog::load(path)));
+
+  // Layout::KeyMajor: a row is one contiguous run indexed by LocaleId, a column is strided
+  // by localeCount(); missing cells hold the sentinel and no fallback is applied.
+  const i18n::KeyId greeting = catalog.findKey("greeting");
+  const i18n::KeyId farewell = catalog.findKey("user.farewell");
+  const i18n::LocaleId de = catalog.findLocale("de");
+  const i18n::LocaleId ja = catalog.findLocale("ja");
+  auto row = catalog.row(greeting);
+  CHECK(row.contiguous() && row.size() == catalog.localeCount());
+  CHECK(&row[1] == &row[0] + 1 && row.span().size() == row.size());
+  CHECK(row[de] == "Hallo" && row[catalog.findLocale("en")] == "Hello");
+  auto farewells = catalog.row(farewell);
+  CHECK(i18n::Catalog::isMissing(farewells[ja]) && farewells[de] == "Tsch\xc3\xbc\x73");
+  auto japanese = catalog.column(ja);
+  CHECK(!japanese.contiguous() && japanese.stride() == catalog.localeCount());
+  CHECK(japanese.size() == catalog.keyCount() && japanese[greeting] == catalog.get(greeting, ja));
+  CHECK(i18n::Catalog::isMissing(japanese[farewell]));
+
+  // Layout::LocaleMajor: the same cells, with columns contiguous and rows strided by keyCount().
+  i18n::Catalog localeMajor(json, {i18n::Layout::LocaleMajor});
+  CHECK(localeMajor.getLayout() == i18n::Layout::LocaleMajor && sameContent(catalog, localeMajor));
+  auto german = localeMajor.column(localeMajor.findLocale("de"));
+  CHECK(german.contiguous() && german.size() == localeMajor.keyCount());
+  CHECK(&german[1] == &german[0] + 1);
+  CHECK(german[localeMajor.findKey("greeting")] == "Hallo" && german[localeMajor.findKey("steps.1")] == "Zwei");
+  CHECK(i18n::Catalog::isMissing(german[localeMajor.findKey("errors.E1")]));
+  auto greetings = localeMajor.row(localeMajor.findKey("greeting"));
+  CHECK(!greetings.contiguous() && greetings.stride() == localeMajor.keyCount());
+  CHECK(greetings.size() == localeMajor.localeCount() && &greetings[1] == &greetings[0] + localeMajor.keyCount());
+  for (std::size_t l = 0; l < localeMajor.localeCount(); ++l)
+  {
+    CHECK(greetings[l] == catalog.row(greeting)[catalog.findLocale(localeMajor.localeCode(static_cast<i18n::LocaleId>(l)))]);
+  }
+
+  // Ids past the end behave like invalidKey and invalidLocale instead of indexing the slab.
+  const auto keyPastEnd = static_cast<i18n::KeyId>(catalog.keyCount());
+  const auto localePastEnd = static_cast<i18n::LocaleId>(catalog.localeCount());
+  CHECK(catalog.t_view(keyPastEnd, de, "<none>") == "<none>");
+  CHECK(catalog.t_view(1000000, de, "<none>") == "<none>");
+  CHECK(catalog.t_view(farewell, localePastEnd) == "Goodbye");
+  CHECK(catalog.t_view(greeting, 1000000) == "Hello");
+  CHECK(catalog.t_meta(keyPastEnd, de).codePoints == 0);
+  CHECK(catalog.t_upper(keyPastEnd, de, "<none>") == "<none>");
+  CHECK(catalog.t_upper(greeting, localePastEnd) == "HELLO");
+
+  // Corrupt headers are rejected with an exception, never a crash or a huge allocation.
+  CHECK(test::thrown([&]()
+                     { fromString(bytes.substr(0, 39)); }) == "Not a binary catalog");
+  CHECK(test::thrown([&]()
+                     { fromString(patched(bytes, 0, 0x58585858)); }) == "Not a binary catalog");
+  CHECK(!test::thrown([&]()
+                      { fromString(patched(bytes, 8, 99)); })
+             .empty());
+  CHECK(!test::thrown([&]()
+                      { fromString(patched(bytes, 12, 0x04030201)); })
+             .empty());
+  CHECK(test::thrown([&]()
+                     { fromString(patched(bytes, 16, 7)); }) == "Corrupt binary catalog");
+  CHECK(test::thrown([&]()
+                     { fromString(bytes.substr(0, bytes.size() - 1)); }) == "Corrupt binary catalog");
+  CHECK(test::thrown([&]()
+                     { fromString(patched(bytes, 32, 0xFFFFFFFF)); }) == "Corrupt binary catalog");
+
+  // Counts whose products wrap a 64-bit size: in a version 1 header, 2^29 - 1 locales and
+  // 2^32 - 1 keys make 2^61 - 1 cells of 8 bytes, so poolOffset 32 used to pass the check.
+  std::string hostile = patched(patched(patched(patched(bytes, 8, 1), 20, (1u << 29) - 1), 24, 0xFFFFFFFF), 28, 32);
+  CHECK(test::thrown([&]()
+                     { fromString(hostile); }) == "Corrupt binary catalog");
+  CHECK(test::thrown([&]()
+                     { fromString(patched(patched(bytes, 20, 0xFFFFFFFF), 24, 0xFFFFFFFF)); }) == "Corrupt binary catalog");
+  CHECK(test::thrown([&]()
+                     { fromString(patched(bytes, 24, 0x10000)); }) == "Corrupt binary catalog");
+  CHECK(test::thrown([&]()
+                     { fromString(patched(bytes, 28, 40)); }) == "Corrupt binary catalog");
+
+  // A cell pointing past the pool.
+  CHECK(test::thrown([&]()
+                     { fromString(patched(bytes, 40, 0xFFFFFFF0)); }) == "Corrupt binary catalog");
+
+  std::ofstream(path, std::ios::binary) << patched(bytes, 20, 0xFFFFFFFF);
+  std::string message = test::thrown([&]()
+                                     { i18n::Catalog::load(path); });
+  CHECK(message.find("Corrupt binary catalog") != std::string::npos && message.find(path) != std::string::npos);
+
+  std::filesystem::remove(path);
+  return test::finish();
+}
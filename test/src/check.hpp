@@ -0,0 +1,55 @@
+// Minimal assertions shared by the test executables. A failed check prints its location and
+// expression and keeps going; main() returns test::finish(), which is non-zero after any failure.
+
+#ifndef I18N_TEST_CHECK_HPP
+#define I18N_TEST_CHECK_HPP
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+namespace test
+{
+  inline int failures = 0;
+
+  inline void check(bool ok, const char *expression, const char *file, int line)
+  {
+    if (!ok)
+    {
+      ++failures;
+      std::printf("FAIL %s:%d: %s\n", file, line, expression);
+    }
+  }
+
+  /**
+   * @brief Run @p action and return the message of the std::exception it threw, or "" if it did not throw
+   */
+  template <typename Action>
+  std::string thrown(Action &&action)
+  {
+    try
+    {
+      action();
+    }
+    catch (const std::exception &e)
+    {
+      return e.what()[0] ? e.what() : "(empty message)";
+    }
+    return {};
+  }
+
+  inline int finish()
+  {
+    if (failures)
+    {
+      std::printf("%d check(s) failed\n", failures);
+      return 1;
+    }
+    std::printf("All checks passed\n");
+    return 0;
+  }
+} // namespace test
+
+#define CHECK(expression) ::test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#endif
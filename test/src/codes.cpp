@@ -0,0 +1,89 @@
+// Numeric code tables: namespaces of plain numeric keys indexed on their own, patterns such as
+// "errors.E#" indexed on request, rejection of duplicate codes and sparse tables, and t_code()
+// lookups before and after a binary catalog is loaded again.
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+
+#include <filesystem>
+#include <string>
+
+int main()
+{
+  nlohmann::json json = {
+      {"en", {{"errors", {{"E1000", "Unknown error"}, {"E1001", "Timeout"}, {"E1003", "Disk full"}, {"title", "Errors"}}},
+              {"http", {{"200", "OK"}, {"404", "Not Found"}, {"500", "Server Error"}}},
+              {"far", {{"1", "one"}, {"100000", "far away"}}},
+              {"steps", {"First", "Second"}}}},
+      {"de", {{"errors", {{"E1000", "Unbekannter Fehler"}, {"E1003", "Datentraeger voll"}}},
+              {"http", {{"404", "Nicht gefunden"}}}}}};
+
+  i18n::CatalogOptions options;
+  options.codeTables = {"errors.E#"};
+  i18n::Catalog catalog(json, options);
+
+  // Requested pattern, with fallback to English and defaults for gaps and out-of-range codes.
+  CHECK(catalog.t_code("errors", 1000, "de") == "Unbekannter Fehler");
+  CHECK(catalog.t_code("errors", 1001, "de") == "Timeout");
+  CHECK(catalog.t_code("errors", 1003, "en") == "Disk full");
+  CHECK(catalog.t_code("errors", 1002, "de", "?") == "?");
+  CHECK(catalog.t_code("errors", 999, "de", "?") == "?");
+  CHECK(catalog.t_code("errors", 1004, "de", "?") == "?");
+  CHECK(catalog.t_code("errors", -1, "de", "?") == "?");
+  CHECK(catalog.findCode("errors", 1001) == catalog.findKey("errors.E1001"));
+  CHECK(catalog.findCode("errors", 1002) == i18n::invalidKey);
+  CHECK(catalog.findCode("nope", 1) == i18n::invalidKey);
+
+  // Plain numeric namespaces (and compiled arrays) are detected without a pattern.
+  CHECK(catalog.t_code("http", 404, "de") == "Nicht gefunden");
+  CHECK(catalog.t_code("http", 500, "de") == "Server Error");
+  CHECK(catalog.t_code("http", 403, "de", "?") == "?");
+  CHECK(catalog.t_code("steps", 1, catalog.findLocale("en")) == "Second");
+  // Too sparse for a dense table: left to findKey().
+  CHECK(catalog.findCode("far", 1) == i18n::invalidKey);
+  CHECK(catalog.t_view("far.100000", "en") == "far away");
+
+  // Patterns that cannot form a table are rejected with the reason.
+  nlohmann::json duplicate = {{"en", {{"errors", {{"E7", "a"}, {"E07", "b"}, {"E8", "c"}}}}}};
+  i18n::CatalogOptions duplicateOptions;
+  duplicateOptions.codeTables = {"errors.E#"};
+  CHECK(test::thrown([&]()
+                     { i18n::Catalog(duplicate, duplicateOptions); }) == "Code table 'errors.E#' has code 7 twice");
+  nlohmann::json sparse = {{"en", {{"errors", {{"E1", "a"}, {"E2", "b"}, {"E5000", "c"}}}}}};
+  CHECK(test::thrown([&]()
+                     { i18n::Catalog(sparse, duplicateOptions); }) == "Code table 'errors.E#' is too sparse");
+  CHECK(test::thrown([&]()
+                     { i18n::Catalog(sparse).buildCodeTable("errors.E"); }) == "Code table pattern must end with '#': errors.E");
+  // A sparse table is accepted while it wastes at most 1024 slots or seven per code.
+  nlohmann::json wide = {{"en", {{"errors", {{"E1", "a"}, {"E1024", "b"}}}}}};
+  CHECK(test::thrown([&]()
+                     { i18n::Catalog(wide, duplicateOptions); })
+            .empty());
+  // Duplicate plain numeric keys ("7" and "07") are not indexed, but stay reachable by path.
+  i18n::Catalog plain(nlohmann::json{{"en", {{"codes", {{"7", "a"}, {"07", "b"}}}}}});
+  CHECK(plain.findCode("codes", 7) == i18n::invalidKey);
+  CHECK(plain.t_view("codes.07", "en") == "b");
+  // Codes of more than 18 digits never match.
+  i18n::Catalog huge(nlohmann::json{{"en", {{"big", {{"1234567890123456789", "x"}}}}}});
+  CHECK(huge.findCode("big", 0) == i18n::invalidKey);
+
+  // Loading indexes plain numeric namespaces again; patterns have to be rebuilt after load().
+  std::string path = (std::filesystem::temp_directory_path() / "i18n-test-codes.i18nc").string();
+  catalog.save(path);
+  i18n::Catalog loaded = i18n::Catalog::load(path);
+  CHECK(loaded.t_code("http", 404, "de") == "Nicht gefunden");
+  CHECK(loaded.t_code("steps", 0, "de") == "First");
+  CHECK(loaded.t_code("errors", 1000, "de", "?") == "?");
+  loaded.buildCodeTable("errors.E#");
+  CHECK(loaded.t_code("errors", 1000, "de") == "Unbekannter Fehler");
+  CHECK(loaded.t_code("errors", 1001, "de") == "Timeout");
+  // A table of the same name is replaced, and the other tables keep working.
+  loaded.buildCodeTable("errors.E100#");
+  CHECK(loaded.t_code("errors", 3, "en") == "Disk full");
+  CHECK(loaded.t_code("errors", 1003, "en", "?") == "?");
+  CHECK(loaded.t_code("http", 200, "en") == "OK");
+  CHECK(loaded.t_code("steps", 1, "en") == "Second");
+  std::filesystem::remove(path);
+  return test::finish();
+}
@@ -0,0 +1,116 @@
+// Collation: the root order (accents after base letters, case last) and the Swedish, Danish,
+// Spanish, Turkish, Polish and Czech tailorings, through compare(), sortKey() and the sort keys
+// a catalog precomputes.
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/collation.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace
+{
+  /**
+   * @brief Whether @p words are in strictly ascending order for @p locale, by compare() and by
+   * sort key, and sorting them in reverse gives them back
+   */
+  bool ordered(const char *locale, std::initializer_list<std::string> words)
+  {
+    i18n::Collator collator(locale);
+    std::vector<std::string> expected(words);
+    for (std::size_t i = 0; i + 1 < expected.size(); ++i)
+    {
+      const std::string &a = expected[i];
+      const std::string &b = expected[i + 1];
+      if (collator.compare(a, b) >= 0 || collator.compare(b, a) <= 0 || collator.sortKey(a) >= collator.sortKey(b))
+      {
+        std::printf("  %s: expected '%s' < '%s'\n", locale, a.c_str(), b.c_str());
+        return false;
+      }
+    }
+
+    std::vector<std::string> sorted(expected.rbegin(), expected.rend());
+    std::sort(sorted.begin(), sorted.end(), [&](const std::string &a, const std::string &b)
+              { return collator.compare(a, b) < 0; });
+    return sorted == expected;
+  }
+} // namespace
+
+int main()
+{
+  // Root order: punctuation, digits, letters; accents are secondary, case tertiary.
+  CHECK(ordered("", {"!", "1", "9", "a", "z"}));
+  CHECK(ordered("en", {"resume", "r\xC3\xA9sum\xC3\xA9", "resumes"}));
+  CHECK(ordered("en", {"role", "Role", "r\xC3\xB4le", "roles"}));
+  CHECK(ordered("en", {"a", "A", "\xC3\xA1", "\xC3\x81", "b"}));
+  CHECK(ordered("de", {"Muller", "M\xC3\xBCller", "Mullers"}));
+  CHECK(ordered("en", {"z", "\xD0\xB0", "\xD1\x8F"})); // Latin before Cyrillic
+  CHECK(i18n::Collator("en").compare("abc", "abc") == 0);
+  CHECK(i18n::Collator("en").compare("cafe\xCC\x81", "caf\xC3\xA9") == 0); // decomposed equals precomposed
+
+  // Swedish and Finnish: a-ring, a-umlaut and o-umlaut are letters after z.
+  CHECK(ordered("sv", {"z", "\xC3\xA5", "\xC3\xA4", "\xC3\xB6"}));
+  CHECK(ordered("sv-SE", {"zebra", "\xC3\xA5ngest", "\xC3\xA4ng", "\xC3\xB6ra"}));
+  CHECK(ordered("fi", {"z", "\xC3\xA5", "\xC3\xA4", "\xC3\xB6"}));
+  CHECK(ordered("en", {"\xC3\xA5ngest", "apple", "\xC3\xB6l", "zebra"}));
+
+  // Danish and Norwegian: ae, o-stroke and a-ring after z.
+  CHECK(ordered("da", {"z", "\xC3\xA6", "\xC3\xB8", "\xC3\xA5"}));
+  CHECK(ordered("nb", {"zoo", "\xC3\xA6re", "\xC3\xB8l", "\xC3\xA5r"}));
+
+  // Spanish: n-tilde is a letter between n and o.
+  CHECK(ordered("es", {"nz", "\xC3\xB1" "a", "o"}));
+  CHECK(ordered("es", {"cana", "canz", "ca\xC3\xB1" "a", "cao"}));
+
+  // Turkish: dotless i sorts before i, and I/dotless i and dotted I/i are the case pairs.
+  CHECK(ordered("tr", {"h", "\xC4\xB1", "i", "j"}));
+  CHECK(ordered("tr", {"\xC4\xB1", "I", "i", "\xC4\xB0"}));
+  CHECK(ordered("tr", {"cz", "\xC3\xA7", "d"}));
+  CHECK(ordered("tr", {"gz", "\xC4\x9F", "h"}));
+  CHECK(ordered("tr", {"sz", "\xC5\x9F", "t"}));
+  CHECK(ordered("tr-TR", {"uz", "\xC3\xBC", "v"}));
+
+  // Polish: letters with ogonek, acute, stroke and dot follow their base letter.
+  CHECK(ordered("pl", {"az", "\xC4\x85", "b"}));
+  CHECK(ordered("pl", {"cz", "\xC4\x87", "d"}));
+  CHECK(ordered("pl", {"lz", "\xC5\x82", "m"}));
+  CHECK(ordered("pl", {"z", "\xC5\xBA", "\xC5\xBC"}));
+  CHECK(ordered("pl", {"Lublin", "\xC5\x81\xC3\xB3" "d\xC5\xBA"}));
+
+  // Czech and Slovak: letters with caron follow their base letter.
+  CHECK(ordered("cs", {"cz", "\xC4\x8D", "d"}));
+  CHECK(ordered("cs", {"rz", "\xC5\x99", "s"}));
+  CHECK(ordered("cs", {"sz", "\xC5\xA1", "t"}));
+  CHECK(ordered("sk", {"zz", "\xC5\xBE"}));
+  CHECK(ordered("en", {"\xC4\x8D", "cz"}));
+
+  // Catalog sort keys use each locale's collator.
+  nlohmann::json json = {
+      {"en", {{"a", "\xC3\xA5ngest"}, {"b", "zebra"}, {"c", "apple"}}},
+      {"sv", {{"a", "\xC3\xA5ngest"}, {"b", "zebra"}, {"c", "apple"}}}};
+  i18n::CatalogOptions options;
+  options.sortKeys = true;
+  i18n::Catalog catalog(json, options);
+  CHECK(catalog.hasSortKeys());
+  auto order = [&](const char *locale)
+  {
+    i18n::LocaleId id = catalog.findLocale(locale);
+    std::vector<i18n::KeyId> keys = {catalog.findKey("a"), catalog.findKey("b"), catalog.findKey("c")};
+    std::sort(keys.begin(), keys.end(), [&](i18n::KeyId a, i18n::KeyId b)
+              { return catalog.sort_key(a, id) < catalog.sort_key(b, id); });
+    std::string names;
+    for (i18n::KeyId key : keys)
+    {
+      names += catalog.keyName(key);
+    }
+    return names;
+  };
+  CHECK(order("en") == "acb");
+  CHECK(order("sv") == "cba");
+  CHECK(!i18n::Catalog(json).hasSortKeys());
+  return test::finish();
+}
@@ -0,0 +1,140 @@
+// Coroutine awaitables (C++20, I18N_ENABLE_COROUTINES): loadCatalog(), reload() and loadShard()
+// run on the executor, resume the coroutine on its worker thread, publish the new data, and
+// rethrow load errors at the co_await while the old data stays in use.
+
+#include "check.hpp"
+
+#include <i18n/coro.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  using SharedI18n = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::NoDiagnostics, i18n::SharedSnapshot>;
+
+  /**
+   * @brief Fire-and-forget coroutine that starts eagerly; results go through the caller's promise
+   */
+  struct Task
+  {
+    struct promise_type
+    {
+      Task get_return_object() { return {}; }
+      std::suspend_never initial_suspend() noexcept { return {}; }
+      std::suspend_never final_suspend() noexcept { return {}; }
+      void return_void() {}
+      void unhandled_exception() { std::terminate(); }
+    };
+  };
+
+  /**
+   * @brief Executor running every task on a new thread, joined by join()
+   */
+  struct Threads
+  {
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+
+    void join()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (std::thread &thread : threads)
+      {
+        thread.join();
+      }
+      threads.clear();
+    }
+  };
+
+  struct Observed
+  {
+    bool resumedOnWorker = false;
+    std::size_t catalogKeys = 0;
+    std::string catalogText;
+    std::string missingCatalog;
+    std::string reloaded;
+    std::string shard;
+    std::string failedReload;
+    std::string afterFailure;
+  };
+
+  // directory is taken by value: the frame outlives the caller's temporaries.
+  Task run(SharedI18n &i18n, std::string directory, Threads &threads, Observed &seen, std::promise<void> &done)
+  {
+    auto pool = [&threads](auto task)
+    {
+      std::lock_guard<std::mutex> lock(threads.mutex);
+      threads.threads.emplace_back(std::move(task));
+    };
+    std::thread::id caller = std::this_thread::get_id();
+
+    i18n::Catalog catalog = co_await i18n::loadCatalog(directory + "/catalog.i18nc", pool);
+    seen.resumedOnWorker = std::this_thread::get_id() != caller;
+    seen.catalogKeys = catalog.keyCount();
+    seen.catalogText = std::string(catalog.t_view("greeting", "de"));
+
+    try
+    {
+      co_await i18n::loadCatalog(directory + "/missing.i18nc", pool);
+    }
+    catch (const std::exception &e)
+    {
+      seen.missingCatalog = e.what();
+    }
+
+    co_await i18n::reload(i18n, directory + "/all.json", pool);
+    seen.reloaded = i18n.t("greeting", "de");
+    co_await i18n::loadShard(i18n, "fr", directory + "/fr.json", pool);
+    seen.shard = i18n.t("greeting", "fr");
+
+    try
+    {
+      co_await i18n::reload(i18n, directory + "/missing.json", pool);
+    }
+    catch (const std::exception &e)
+    {
+      seen.failedReload = e.what();
+    }
+    seen.afterFailure = i18n.t("greeting", "de");
+    done.set_value();
+  }
+} // namespace
+
+int main()
+{
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / "i18n-test-coro";
+  std::filesystem::create_directories(directory);
+  nlohmann::json json = {{"en", {{"greeting", "Hello"}}}, {"de", {{"greeting", "Hallo"}}}};
+  i18n::Catalog(json).save((directory / "catalog.i18nc").string());
+  std::ofstream(directory / "all.json") << json.dump();
+  std::ofstream(directory / "fr.json") << nlohmann::json{{"greeting", "Bonjour"}}.dump();
+
+  SharedI18n i18n(nlohmann::json{{"en", {{"greeting", "Bootstrap"}}}});
+  Threads threads;
+  Observed seen;
+  std::promise<void> done;
+  std::future<void> finished = done.get_future();
+  run(i18n, directory.string(), threads, seen, done);
+  finished.wait();
+  threads.join();
+
+  CHECK(seen.resumedOnWorker);
+  CHECK(seen.catalogKeys == 1);
+  CHECK(seen.catalogText == "Hallo");
+  CHECK(!seen.missingCatalog.empty());
+  CHECK(seen.reloaded == "Hallo");
+  CHECK(seen.shard == "Bonjour");
+  CHECK(!seen.failedReload.empty());
+  CHECK(seen.afterFailure == "Hallo");
+  // The data published on the workers is visible to every thread.
+  CHECK(i18n.t("greeting", "fr") == "Bonjour");
+
+  std::filesystem::remove_all(directory);
+  return test::finish();
+}
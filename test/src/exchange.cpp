@@ -0,0 +1,187 @@
+// CSV and XLIFF readers: quoting rules, embedded newlines, entity and character references,
+// CDATA, comments and DOCTYPE declarations, malformed input, and export/import round trips.
+
+#include "check.hpp"
+
+#include <i18n/exchange.hpp>
+
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+  using Entries = std::vector<std::tuple<std::string, std::string, std::string>>;
+
+  Entries csv(const std::string &text)
+  {
+    Entries entries;
+    std::istringstream in(text);
+    i18n::readCsv(in, [&](std::string_view locale, std::string_view key, std::string_view value)
+                  { entries.emplace_back(locale, key, value); });
+    return entries;
+  }
+
+  Entries xliff(const std::string &text, bool includeSource = true)
+  {
+    Entries entries;
+    std::istringstream in(text);
+    i18n::readXliff(
+        in, [&](std::string_view locale, std::string_view key, std::string_view value)
+        { entries.emplace_back(locale, key, value); },
+        includeSource);
+    return entries;
+  }
+
+  /**
+   * @brief XLIFF 1.2 document with one trans-unit whose target is @p target (raw markup)
+   */
+  std::string unit(const std::string &target)
+  {
+    return "<xliff version=\"1.2\"><file source-language=\"en\" target-language=\"de\"><body>"
+           "<trans-unit id=\"k\"><source>s</source><target>" +
+           target + "</target></trans-unit></body></file></xliff>";
+  }
+
+  std::string target(const std::string &markup)
+  {
+    Entries entries = xliff(unit(markup), false);
+    return entries.size() == 1 ? std::get<2>(entries[0]) : "<no entry>";
+  }
+} // namespace
+
+int main()
+{
+  // CSV: quoted fields with commas, doubled quotes and embedded newlines; CRLF and LF endings.
+  Entries entries = csv("\xEF\xBB\xBFkey,en,de\r\n"
+                        "plain,Hello,Hallo\r\n"
+                        "\"a,b\",\"x, y\",\"say \"\"hi\"\"\"\r\n"
+                        "multi,\"line one\r\nline two\",\"eins\nzwei\"\n"
+                        "empty,\"\",\n"
+                        "\n"
+                        "short,only\n");
+  CHECK((entries == Entries{{"en", "plain", "Hello"},
+                            {"de", "plain", "Hallo"},
+                            {"en", "a,b", "x, y"},
+                            {"de", "a,b", "say \"hi\""},
+                            {"en", "multi", "line one\r\nline two"},
+                            {"de", "multi", "eins\nzwei"},
+                            {"en", "empty", ""},
+                            {"en", "short", "only"}}));
+  CHECK(csv("key,en").empty());
+  CHECK(test::thrown([]()
+                     { csv(""); }) == "CSV: missing header row");
+  CHECK(test::thrown([]()
+                     { csv("key,en\na,\"open\nb,c\n"); }) == "CSV: unterminated quoted field at line 4");
+  CHECK(test::thrown([]()
+                     { csv("key,en\na,\"x\"y\n"); }) == "CSV: unexpected character after quoted field at line 2");
+  CHECK(test::thrown([]()
+                     { csv("key,en\na,\"1\nx\"\nb,1,2\n"); }) == "CSV: record at line 4 has more fields than the header");
+  CHECK(test::thrown([]()
+                     { csv("\xEF\xBB" "xkey,en\n"); }) == "CSV: invalid byte order mark");
+
+  // XLIFF 1.2 and 2.0, with source text, inline markup and self-closing elements.
+  entries = xliff("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                  "<!-- exported -->\n"
+                  "<xliff xmlns=\"urn:oasis:names:tc:xliff:document:1.2\" version=\"1.2\">\n"
+                  " <file source-language=\"en\" target-language=\"de\" datatype=\"plaintext\"><body>\n"
+                  "  <trans-unit id=\"1\" resname=\"greeting\"><source>Hello</source><target>Hallo</target></trans-unit>\n"
+                  "  <trans-unit id=\"bold\"><source>A <g id=\"1\">bold</g> move<x id=\"2\"/></source><target state='new'/></trans-unit>\n"
+                  " </body></file>\n"
+                  "</xliff>\n");
+  CHECK((entries == Entries{{"en", "greeting", "Hello"}, {"de", "greeting", "Hallo"}, {"en", "bold", "A bold move"}, {"de", "bold", ""}}));
+  entries = xliff("<xliff version=\"2.0\" srcLang=\"en\" trgLang=\"ja\"><file id=\"f\">"
+                  "<unit id=\"u1\" name=\"user.farewell\"><segment><source>Bye</source><target>\xe3\x81\x98\xe3\x82\x83\xe3\x81\xad</target></segment></unit>"
+                  "</file></xliff>",
+                  false);
+  CHECK((entries == Entries{{"ja", "user.farewell", "\xe3\x81\x98\xe3\x82\x83\xe3\x81\xad"}}));
+
+  // Entities and character references, in text and in attribute values.
+  CHECK(target("&lt;b&gt; &amp; &quot;q&quot; &apos;a&apos;") == "<b> & \"q\" 'a'");
+  CHECK(target("&#65;&#x42;&#X43;&#xe9;&#x20AC;&#x1F600;&#1114111;") == "ABC\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\xf4\x8f\xbf\xbf");
+  CHECK(target("&#x0000041;") == "A");
+  entries = xliff("<xliff version=\"2.0\" srcLang=\"en\" trgLang=\"de\"><unit id=\"a&amp;b&#x21;\"><target>x</target></unit></xliff>");
+  CHECK((entries == Entries{{"de", "a&b!", "x"}}));
+  for (const char *bad : {"&#xZZ;", "&#x;", "&#;", "&#12a;", "&#-1;", "&#x110000;", "&#xD800;", "&#xDFFF;", "&#0;",
+                          "&#4294967361;", "&#xFFFFFFFF;"})
+  {
+    std::string message = test::thrown([&]()
+                                       { target(bad); });
+    CHECK(message.rfind("XML: invalid character reference", 0) == 0);
+  }
+  CHECK(test::thrown([]()
+                     { target("&nbsp;"); }) == "XML: unknown entity &nbsp;");
+  CHECK(test::thrown([]()
+                     { target("&averyveryverylongname;"); }) == "XML: malformed entity reference");
+
+  // CDATA keeps markup and entity text verbatim; DOCTYPE declarations and comments are skipped.
+  CHECK(target("<![CDATA[<b>&amp;</b>]]>") == "<b>&amp;</b>");
+  CHECK(target("a<![CDATA[]]]]><![CDATA[>]]>b") == "a]]>b");
+  CHECK(target("x<!-- note <target>y</target> -->z") == "xz");
+  CHECK(test::thrown([]()
+                     { target("<![INCLUDE[x]]>"); }) == "XML: malformed CDATA section");
+  CHECK(test::thrown([]()
+                     { target("<![CDATX[x]]>"); }) == "XML: malformed CDATA section");
+  entries = xliff("<?xml version=\"1.0\"?>\n"
+                  "<!DOCTYPE xliff PUBLIC \"-//XLIFF//DTD XLIFF//EN\" \"http://www.oasis-open.org/committees/xliff/documents/xliff.dtd\">\n" +
+                      unit("ok"),
+                  false);
+  CHECK((entries == Entries{{"de", "k", "ok"}}));
+
+  // Malformed XLIFF.
+  CHECK(test::thrown([]()
+                     { xliff("<xliff><file source-language=\"en\" target-language=\"de\"><trans-unit id=\"k\"><target>x</tar"); }) == "XML: unexpected end of input");
+  CHECK(test::thrown([]()
+                     { xliff("<xliff><file><trans-unit id=\"k\"><target>x</target></trans-unit></file></xliff>"); }) ==
+        "XLIFF: unit 'k' has no target language");
+  CHECK(test::thrown([]()
+                     { xliff("<xliff><file target-language=\"de\"><trans-unit><target>x</target></trans-unit></file></xliff>"); }) ==
+        "XLIFF: unit without id");
+  CHECK(test::thrown([]()
+                     { xliff("<xliff><file id=f>"); }) == "XML: unquoted attribute value in <file>");
+
+  // Export and import again: values needing quotes or escapes survive both formats.
+  i18n::CatalogBuilder builder;
+  builder.add("en", "plain", "Hello");
+  builder.add("en", "tricky", "a, \"b\"\r\n<c> & d");
+  builder.add("de", "tricky", "\xc3\xa4, \"\xc3\xb6\"\n<\xc3\xbc>");
+  builder.add("de", "empty", "");
+  builder.add("en", "tabs", "a\tb\rc");
+  i18n::Catalog catalog = builder.build();
+
+  std::ostringstream csvOut;
+  i18n::exportCsv(catalog, csvOut);
+  std::istringstream csvIn(csvOut.str());
+  i18n::CatalogBuilder fromCsv;
+  i18n::importCsv(csvIn, fromCsv);
+  i18n::Catalog csvCatalog = fromCsv.build();
+
+  std::ostringstream xliffOut;
+  i18n::exportXliff(catalog, xliffOut, "en", "de");
+  CHECK(xliffOut.str().find("<trans-unit id=\"tricky\" resname=\"tricky\">") != std::string::npos);
+  CHECK(xliffOut.str().find("a&#9;b&#13;c") != std::string::npos);
+  std::istringstream xliffIn(xliffOut.str());
+  i18n::CatalogBuilder fromXliff;
+  i18n::importXliff(xliffIn, fromXliff);
+  i18n::Catalog xliffCatalog = fromXliff.build();
+
+  for (const i18n::Catalog *copy : {&csvCatalog, &xliffCatalog})
+  {
+    CHECK(copy->t_view("tricky", "en") == "a, \"b\"\r\n<c> & d");
+    CHECK(copy->t_view("tricky", "de") == "\xc3\xa4, \"\xc3\xb6\"\n<\xc3\xbc>");
+    CHECK(copy->t_view("plain", "en") == "Hello");
+  }
+  CHECK(csvCatalog.t_view("empty", "de", "<missing>").empty());
+  CHECK(xliffCatalog.t_view("tabs", "en") == "a\tb\rc");
+
+  // XML 1.0 has no way to write the other C0 control characters.
+  i18n::CatalogBuilder control;
+  control.add("en", "bell", "ring\x07");
+  control.add("de", "bell", "klingeln");
+  i18n::Catalog controlCatalog = control.build();
+  std::ostringstream controlOut;
+  CHECK(test::thrown([&]()
+                     { i18n::exportXliff(controlCatalog, controlOut, "en", "de"); }) == "XML: control character 7 cannot be written");
+  return test::finish();
+}
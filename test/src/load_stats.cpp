@@ -0,0 +1,154 @@
+// LoadStats: the phases recorded by the loading constructors, load() and Catalog builds, with
+// byte counts where documented and nested phases inside their parents, and the Chrome trace
+// written from them, which must parse as JSON whatever the flags of the output stream.
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/i18n.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  std::vector<std::string> names(const i18n::LoadStats &stats)
+  {
+    std::vector<std::string> result;
+    for (const i18n::LoadPhase &phase : stats.phases)
+    {
+      result.emplace_back(phase.name);
+    }
+    return result;
+  }
+
+  const i18n::LoadPhase *find(const i18n::LoadStats &stats, const char *name)
+  {
+    for (const i18n::LoadPhase &phase : stats.phases)
+    {
+      if (std::strcmp(phase.name, name) == 0)
+      {
+        return &phase;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Whether @p inner lies within @p outer on the timeline
+   */
+  bool within(const i18n::LoadPhase &inner, const i18n::LoadPhase &outer)
+  {
+    return inner.start >= outer.start && inner.start + inner.duration <= outer.start + outer.duration;
+  }
+
+  /**
+   * @brief Whether @p trace is valid Chrome trace JSON describing exactly the phases of @p stats
+   */
+  bool matchesTrace(const i18n::LoadStats &stats, const std::string &trace)
+  {
+    nlohmann::json json = nlohmann::json::parse(trace, nullptr, false);
+    if (json.is_discarded() || !json["traceEvents"].is_array() || json["traceEvents"].size() != stats.phases.size())
+    {
+      return false;
+    }
+    for (std::size_t i = 0; i < stats.phases.size(); ++i)
+    {
+      const nlohmann::json &event = json["traceEvents"][i];
+      const i18n::LoadPhase &phase = stats.phases[i];
+      double ts = event["ts"].get<double>();
+      double dur = event["dur"].get<double>();
+      if (event["name"] != phase.name || event["ph"] != "X" || event["args"]["bytes"] != phase.bytes ||
+          std::abs(ts * 1000.0 - static_cast<double>(phase.start.count())) > 0.5 ||
+          std::abs(dur * 1000.0 - static_cast<double>(phase.duration.count())) > 0.5)
+      {
+        return false;
+      }
+    }
+    return json["displayTimeUnit"] == "ns";
+  }
+} // namespace
+
+int main()
+{
+  nlohmann::json json = {{"en", {{"greeting", "Hello"}, {"steps", {"One", "Two"}}}}, {"de", {{"greeting", "Hallo"}}}};
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / "i18n-test-load-stats";
+  std::filesystem::create_directories(directory);
+  std::string path = (directory / "translations.json").string();
+  std::ofstream(path) << json.dump(2);
+  const std::size_t fileSize = static_cast<std::size_t>(std::filesystem::file_size(path));
+
+  // File constructor: open, size check, parse with "locales" nested inside it.
+  i18n::LoadStats fromFile;
+  I18n i18n(path, fromFile);
+  CHECK((names(fromFile) == std::vector<std::string>{"open", "size check", "locales", "parse"}));
+  CHECK(find(fromFile, "size check")->bytes == fileSize && find(fromFile, "parse")->bytes == fileSize);
+  CHECK(find(fromFile, "open")->bytes == 0 && find(fromFile, "locales")->bytes == 0);
+  CHECK(within(*find(fromFile, "locales"), *find(fromFile, "parse")));
+  CHECK(std::all_of(fromFile.phases.begin(), fromFile.phases.end(), [&](const i18n::LoadPhase &phase)
+                    { return phase.start.count() >= 0 && phase.start + phase.duration <= fromFile.total(); }));
+  CHECK(i18n.t("greeting", "de") == "Hallo");
+
+  // The const char * and JSON object constructors.
+  i18n::LoadStats fromLiteral;
+  I18n literal(path.c_str(), fromLiteral);
+  CHECK(names(fromLiteral) == names(fromFile));
+  i18n::LoadStats fromJson;
+  I18n object(json, fromJson);
+  CHECK((names(fromJson) == std::vector<std::string>{"validate", "locales", "copy"}));
+  CHECK(within(*find(fromJson, "locales"), *find(fromJson, "copy")));
+
+  // load() appends "publish"; the resource overload records the same phases.
+  i18n::LoadStats reloaded;
+  std::pmr::monotonic_buffer_resource resource;
+  i18n.load(path, &resource, &reloaded);
+  CHECK((names(reloaded) == std::vector<std::string>{"open", "size check", "locales", "parse", "publish"}));
+  CHECK(find(reloaded, "parse")->bytes == fileSize);
+  reloaded.clear();
+  CHECK(reloaded.phases.empty() && reloaded.total().count() == 0);
+  i18n.load(path, std::pmr::get_default_resource(), &reloaded);
+  CHECK(reloaded.phases.size() == 5 && std::strcmp(reloaded.phases.back().name, "publish") == 0);
+
+  // Catalog builds record through CatalogOptions::stats.
+  i18n::LoadStats compiled;
+  i18n::CatalogOptions options;
+  options.stats = &compiled;
+  i18n::Catalog catalog(json, options);
+  for (const char *phase : {"utf8", "slab", "index", "metrics", "code tables"})
+  {
+    CHECK(find(compiled, phase) != nullptr);
+  }
+  CHECK(find(compiled, "utf8")->bytes > 0);
+
+  // The Chrome trace parses as JSON and carries every phase, also when the stream is set to
+  // hexadecimal, scientific notation or a short precision.
+  CHECK(matchesTrace(fromFile, fromFile.chromeTrace()));
+  CHECK(matchesTrace(compiled, compiled.chromeTrace()));
+  std::ostringstream skewed;
+  skewed << std::hex << std::scientific << std::setprecision(2) << std::showpos;
+  fromFile.writeChromeTrace(skewed);
+  CHECK(skewed.str() == fromFile.chromeTrace());
+  i18n::LoadStats handmade;
+  auto origin = std::chrono::steady_clock::time_point() + std::chrono::seconds(1);
+  handmade.record("late", origin + std::chrono::nanoseconds(2500), origin + std::chrono::nanoseconds(1002505), 12);
+  handmade.record("outer", origin, origin + std::chrono::nanoseconds(5000007));
+  CHECK(handmade.phases[0].start.count() == 2500 && handmade.phases[1].start.count() == 0);
+  CHECK(handmade.total().count() == 5000007);
+  std::string trace = handmade.chromeTrace();
+  CHECK(trace.find("\"ts\":2.500,\"dur\":1000.005,\"args\":{\"bytes\":12}") != std::string::npos);
+  CHECK(trace.find("\"ts\":0.000,\"dur\":5000.007,") != std::string::npos);
+  CHECK(matchesTrace(handmade, trace));
+  CHECK(matchesTrace(i18n::LoadStats(), i18n::LoadStats().chromeTrace()));
+
+  std::filesystem::remove_all(directory);
+  return test::finish();
+}
@@ -0,0 +1,277 @@
+// Gettext support: plural rules (default, Russian, Arabic, hostile headers), .mo lookups in
+// both byte orders, with msgctxt and plural entries, through the hash table and by bisection,
+// and .mo catalogs behind the JSON data of basic_i18n (loadMo(), t() and tn()).
+
+#include "check.hpp"
+
+#include <i18n/i18n.hpp>
+#include <i18n/mo.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  const char *const russian = "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);";
+  const char *const arabic = "nplurals=6; plural=(n==0 ? 0 : n==1 ? 1 : n==2 ? 2 : n%100>=3 && n%100<=10 ? 3 : n%100>=11 ? 4 : 5);";
+
+  std::uint32_t hashpjw(const std::string &text)
+  {
+    std::uint32_t value = 0;
+    for (char c : text)
+    {
+      value = (value << 4) + static_cast<unsigned char>(c);
+      std::uint32_t high = value & 0xF0000000u;
+      if (high)
+      {
+        value ^= high >> 24;
+        value ^= high;
+      }
+    }
+    return value;
+  }
+
+  /**
+   * @brief Write a .mo file the way msgfmt does: sorted originals, then translations, then an
+   * optional hash table with double hashing
+   */
+  void writeMo(const std::string &path, const std::map<std::string, std::string> &messages, bool swapped, bool hashTable)
+  {
+    std::uint32_t count = static_cast<std::uint32_t>(messages.size());
+    std::uint32_t hashSize = 0;
+    if (hashTable)
+    {
+      hashSize = count * 4 / 3 + 3;
+      for (bool prime = false; !prime; hashSize += prime ? 0 : 1)
+      {
+        prime = true;
+        for (std::uint32_t d = 2; d * d <= hashSize; ++d)
+        {
+          prime = prime && hashSize % d != 0;
+        }
+      }
+    }
+
+    std::uint32_t originals = 28;
+    std::uint32_t translations = originals + count * 8;
+    std::uint32_t hashOffset = translations + count * 8;
+    std::uint32_t strings = hashOffset + hashSize * 4;
+
+    std::vector<std::uint32_t> words = {0x950412de, 0, count, originals, translations, hashSize, hashOffset};
+    std::vector<std::uint32_t> originalTable;
+    std::vector<std::uint32_t> translationTable;
+    std::vector<std::uint32_t> slots(hashSize, 0);
+    std::string pool;
+    std::uint32_t index = 0;
+    for (const auto &[original, translation] : messages)
+    {
+      originalTable.push_back(static_cast<std::uint32_t>(original.size()));
+      originalTable.push_back(strings + static_cast<std::uint32_t>(pool.size()));
+      pool += original;
+      pool.push_back('\0');
+      if (hashSize)
+      {
+        // Plural originals are hashed on the singular msgid only.
+        std::uint32_t value = hashpjw(original.substr(0, original.find('\0')));
+        std::uint32_t slot = value % hashSize;
+        std::uint32_t increment = 1 + value % (hashSize - 2);
+        while (slots[slot])
+        {
+          slot = slot >= hashSize - increment ? slot - (hashSize - increment) : slot + increment;
+        }
+        slots[slot] = index + 1;
+      }
+      ++index;
+    }
+    for (const auto &message : messages)
+    {
+      translationTable.push_back(static_cast<std::uint32_t>(message.second.size()));
+      translationTable.push_back(strings + static_cast<std::uint32_t>(pool.size()));
+      pool += message.second;
+      pool.push_back('\0');
+    }
+    words.insert(words.end(), originalTable.begin(), originalTable.end());
+    words.insert(words.end(), translationTable.begin(), translationTable.end());
+    words.insert(words.end(), slots.begin(), slots.end());
+
+    std::ofstream out(path, std::ios::binary);
+    for (std::uint32_t word : words)
+    {
+      if (swapped)
+      {
+        word = (word >> 24) | ((word >> 8) & 0xFF00) | ((word << 8) & 0xFF0000) | (word << 24);
+      }
+      out.write(reinterpret_cast<const char *>(&word), sizeof(word));
+    }
+    out << pool;
+  }
+
+  std::string header(const std::string &pluralForms)
+  {
+    return "Project-Id-Version: test\nContent-Type: text/plain; charset=UTF-8\n" +
+           (pluralForms.empty() ? std::string() : "Plural-Forms: " + pluralForms + "\n");
+  }
+
+  std::string repeat(const std::string &text, std::size_t times)
+  {
+    std::string result;
+    for (std::size_t i = 0; i < times; ++i)
+    {
+      result += text;
+    }
+    return result;
+  }
+} // namespace
+
+int main()
+{
+  // Plural rules.
+  i18n::PluralRule english;
+  CHECK(english.count() == 2);
+  CHECK(english.index(0) == 1 && english.index(1) == 0 && english.index(2) == 1);
+  CHECK(i18n::PluralRule::fromHeader("Content-Type: text/plain\n").index(1) == 0);
+
+  i18n::PluralRule ru = i18n::PluralRule::fromHeader(header(russian));
+  CHECK(ru.count() == 3);
+  const unsigned long ruOne[] = {1, 21, 101, 1001};
+  const unsigned long ruFew[] = {2, 3, 4, 22, 24, 102};
+  const unsigned long ruMany[] = {0, 5, 11, 12, 14, 19, 20, 25, 111, 112};
+  for (unsigned long n : ruOne)
+    CHECK(ru.index(n) == 0);
+  for (unsigned long n : ruFew)
+    CHECK(ru.index(n) == 1);
+  for (unsigned long n : ruMany)
+    CHECK(ru.index(n) == 2);
+
+  i18n::PluralRule ar = i18n::PluralRule::fromHeader(header(arabic));
+  CHECK(ar.count() == 6);
+  CHECK(ar.index(0) == 0 && ar.index(1) == 1 && ar.index(2) == 2);
+  CHECK(ar.index(3) == 3 && ar.index(10) == 3 && ar.index(103) == 3);
+  CHECK(ar.index(11) == 4 && ar.index(99) == 4 && ar.index(111) == 4);
+  CHECK(ar.index(100) == 5 && ar.index(101) == 5 && ar.index(102) == 5);
+
+  // Out-of-range results clamp to the last form; -, ! and division by zero are defined.
+  CHECK(i18n::PluralRule(2, "n").index(7) == 1);
+  CHECK(i18n::PluralRule(3, "!(n - 1) + n / 0 + n % 0").index(1) == 1);
+  CHECK(i18n::PluralRule(3, "-n + n + 2").index(5) == 2);
+
+  // Malformed and hostile expressions are rejected with an exception, not a stack overflow.
+  for (const std::string &bad : {std::string("n +"), std::string("(n"), std::string("n ? 1"), std::string("x"),
+                                 repeat("(", 100000) + "n" + repeat(")", 100000), repeat("!", 100000) + "n",
+                                 repeat("-", 100000) + "n", repeat("n ? 0 : ", 100000) + "1", repeat("n + ", 100000) + "n"})
+  {
+    CHECK(test::thrown([&]()
+                       { i18n::PluralRule(2, bad); })
+              .rfind("Invalid plural expression", 0) == 0);
+  }
+  CHECK(i18n::PluralRule(2, repeat("(", 32) + "n != 1" + repeat(")", 32)).index(2) == 1);
+  CHECK(test::thrown([]()
+                     { i18n::PluralRule::fromHeader("Plural-Forms: plural=n;\n"); }) == "Invalid Plural-Forms header:  plural=n;");
+
+  // .mo files in both byte orders, with and without a hash table.
+  std::map<std::string, std::string> messages = {
+      {"", header(russian)},
+      {"Open file", "\xd0\x9e\xd1\x82\xd0\xba\xd1\x80\xd1\x8b\xd1\x82\xd1\x8c \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb"},
+      {std::string("%d file\0%d files", 16), std::string("%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\0%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\xd0\xb0\0%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\xd0\xbe\xd0\xb2", 41)},
+      {"menu\x04Open", "\xd0\x9e\xd1\x82\xd0\xba\xd1\x80\xd1\x8b\xd1\x82\xd1\x8c"},
+      {"door\x04Open", "\xd0\x9e\xd1\x82\xd0\xbf\xd0\xb5\xd1\x80\xd0\xb5\xd1\x82\xd1\x8c"},
+  };
+  for (int i = 0; i < 200; ++i)
+  {
+    messages["message " + std::to_string(i)] = "translation " + std::to_string(i);
+  }
+
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / "i18n-test-mo";
+  std::filesystem::create_directories(directory);
+  for (bool swapped : {false, true})
+  {
+    for (bool hashTable : {true, false})
+    {
+      std::string path = (directory / ("ru-" + std::to_string(swapped) + std::to_string(hashTable) + ".mo")).string();
+      writeMo(path, messages, swapped, hashTable);
+      i18n::MoCatalog mo(path);
+
+      CHECK(mo.size() == messages.size());
+      CHECK(mo.pluralRule().count() == 3);
+      CHECK(mo.header().find("Plural-Forms") != std::string_view::npos);
+      CHECK(mo.find("Open file") == messages["Open file"]);
+      CHECK(!mo.find("Open"));
+      CHECK(!mo.find("Open files"));
+      CHECK(!mo.find("zzz"));
+
+      // msgctxt: the same msgid in two contexts, and no match without one.
+      CHECK(mo.find("menu", "Open") == messages["menu\x04Open"]);
+      CHECK(mo.find("door", "Open") == messages["door\x04Open"]);
+      CHECK(!mo.find("window", "Open"));
+      CHECK(!mo.find("menu", "Open file"));
+
+      // Plural entries: the header's rule selects the form; find() returns the first one.
+      CHECK(mo.findPlural("%d file", 1) == "%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb");
+      CHECK(mo.findPlural("%d file", 3) == "%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\xd0\xb0");
+      CHECK(mo.findPlural("%d file", 11) == "%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\xd0\xbe\xd0\xb2");
+      CHECK(mo.find("%d file") == mo.findPlural("%d file", 21));
+      CHECK(!mo.findPlural("%d files", 2));
+
+      bool all = true;
+      for (int i = 0; i < 200; ++i)
+      {
+        all = all && mo.find("message " + std::to_string(i)) == "translation " + std::to_string(i);
+      }
+      CHECK(all);
+    }
+  }
+
+  // A hostile Plural-Forms header makes the catalog fail to open instead of crashing.
+  std::string hostile = (directory / "hostile.mo").string();
+  writeMo(hostile, {{"", header("nplurals=2; plural=" + repeat("(", 100000) + "n" + repeat(")", 100000) + ";")}}, false, true);
+  CHECK(test::thrown([&]()
+                     { i18n::MoCatalog mo(hostile); })
+            .rfind("Invalid plural expression", 0) == 0);
+
+  std::string truncated = (directory / "truncated.mo").string();
+  std::ofstream(truncated, std::ios::binary) << std::string("\xde\x12\x04\x95", 4) << std::string(20, '\0');
+  CHECK(test::thrown([&]()
+                     { i18n::MoCatalog mo(truncated); })
+            .rfind("Not a .mo file", 0) == 0);
+
+  // loadMo(): JSON answers first, then the locale's .mo, then the same two for "en".
+  using QuietI18n = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::NoDiagnostics>;
+  QuietI18n i18n(nlohmann::json{{"en", {{"title", "Title"}}}, {"ru", {{"Open file", "From JSON"}}}});
+  std::string ruMo = (directory / "ru.mo").string();
+  std::string enMo = (directory / "en.mo").string();
+  std::string ruSecond = (directory / "ru-second.mo").string();
+  writeMo(ruMo, messages, false, true);
+  writeMo(enMo, {{"", header("")}, {"Only in English", "From en.mo"}, {std::string("%d day\0%d days", 14), std::string("%d day\0%d days", 14)}}, false, true);
+  writeMo(ruSecond, {{"", header(russian)}, {"message 1", "replaced"}}, false, true);
+  i18n.loadMo("ru", ruMo);
+  i18n.loadMo("en", enMo);
+
+  CHECK(i18n.t("Open file", "ru") == "From JSON");
+  CHECK(i18n.t("message 7", "ru") == "translation 7");
+  CHECK(i18n.t("Only in English", "ru") == "From en.mo");
+  CHECK(i18n.t("title", "ru") == "Title");
+  CHECK(i18n.t("message 7", "de") == "Content not found");
+
+  // tn(): the locale's Plural-Forms rule picks the form, then the "en" catalog's, then t().
+  CHECK(i18n.tn("%d file", 1, "ru") == "%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb");
+  CHECK(i18n.tn("%d file", 3, "ru") == "%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\xd0\xb0");
+  CHECK(i18n.tn("%d file", 11, "ru") == "%d \xd1\x84\xd0\xb0\xd0\xb9\xd0\xbb\xd0\xbe\xd0\xb2");
+  CHECK(i18n.tn("%d day", 1, "ru") == "%d day" && i18n.tn("%d day", 2, "ru") == "%d days");
+  CHECK(i18n.tn("title", 2, "ru") == "Title");
+
+  // A second catalog for a locale replaces the first; the locale is listed once.
+  i18n.loadMo("ru", ruSecond);
+  CHECK(i18n.t("message 1", "ru") == "replaced");
+  CHECK(i18n.t("message 7", "ru") == "Content not found");
+  CHECK(i18n.tn("%d file", 3, "ru", "none") == "none");
+  CHECK(std::count(i18n.getLocales().begin(), i18n.getLocales().end(), "ru") == 1);
+
+  std::filesystem::remove_all(directory);
+  return test::finish();
+}
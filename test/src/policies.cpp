@@ -0,0 +1,314 @@
+// Lookup policies of basic_i18n: English fallback or none, stderr diagnostics or none, and
+// single-threaded or shared-snapshot storage, alone and combined, including copies that
+// diverge after an update and load_async() switching data; the memory resources of results
+// and storage; and arena-backed storage (ArenaJson, FlatArenaJson) through copies, moves and
+// shard loads.
+
+#include "check.hpp"
+
+#include <i18n/arena_json.hpp>
+#include <i18n/i18n.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+namespace
+{
+  using Default = I18n;
+  using Lean = i18n::basic_i18n<i18n::JsonStorage, i18n::NoFallback, i18n::NoDiagnostics>;
+  using Quiet = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::NoDiagnostics>;
+  using Shared = i18n::basic_i18n<i18n::JsonStorage, i18n::EnglishFallback, i18n::NoDiagnostics, i18n::SharedSnapshot>;
+  using SharedLean = i18n::basic_i18n<i18n::JsonStorage, i18n::NoFallback, i18n::StderrDiagnostics, i18n::SharedSnapshot>;
+
+  const nlohmann::json translations = {
+      {"en", {{"greeting", "Hello"}, {"farewell", "Goodbye"}, {"count", 3}}},
+      {"de", {{"greeting", "Hallo"}, {"onlyGerman", "Nur hier"}}}};
+
+  /**
+   * @brief Heap resource that tracks the bytes it has outstanding
+   */
+  struct CountingResource : std::pmr::memory_resource
+  {
+    std::size_t outstanding = 0;
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      outstanding += bytes;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override
+    {
+      outstanding -= bytes;
+      std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+
+  /**
+   * @brief Heap resource whose first allocation waits until open() is called
+   *
+   * Handed to load_async(), it holds the worker after parsing and before publishing, so the
+   * test can look at the data while the load is still pending.
+   */
+  struct GateResource : std::pmr::memory_resource
+  {
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool entered = false;
+    bool opened = false;
+
+    void waitUntilEntered()
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [this]()
+                   { return entered; });
+    }
+
+    void open()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      opened = true;
+      changed.notify_all();
+    }
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      entered = true;
+      changed.notify_all();
+      changed.wait(lock, [this]()
+                   { return opened; });
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override
+    {
+      std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+
+  /**
+   * @brief Copies, moves and shard loads of an arena-backed instance; each copy owns its arena
+   */
+  template <typename I18nType>
+  void checkArena(const std::string &file, const std::string &shard, const std::string &bigShard)
+  {
+    I18nType original(file);
+    CHECK(original.t("greeting", "de") == "Hallo" && original.t("farewell", "de") == "Goodbye");
+
+    I18nType copy(original);
+    copy.loadShard("de", shard);
+    CHECK(copy.t("greeting", "de") == "Servus" && original.t("greeting", "de") == "Hallo");
+    CHECK(copy.t("greeting", "en") == "Hello" && copy.getLocales().size() == 2);
+    copy.loadShard("fr", shard);
+    CHECK(copy.t("greeting", "fr") == "Servus" && copy.getLocales().size() == 3);
+
+    I18nType moved(std::move(copy));
+    CHECK(moved.t("greeting", "de") == "Servus" && moved.t("greeting", "fr") == "Servus");
+    I18nType assigned(file);
+    assigned = moved;
+    moved = I18nType(file);
+    CHECK(assigned.t("greeting", "fr") == "Servus" && moved.t("greeting", "de") == "Hallo");
+    original = std::move(assigned);
+    CHECK(original.t("greeting", "de") == "Servus");
+
+    // Replacing a shard again and again keeps memory bounded by the live data: the tree is
+    // rebuilt in a fresh arena instead of piling replaced locales up in the old one.
+    CountingResource counting;
+    std::pmr::memory_resource *previous = std::pmr::set_default_resource(&counting);
+    {
+      I18nType sharded(file);
+      sharded.loadShard("de", bigShard);
+      std::size_t once = counting.outstanding;
+      for (int i = 0; i < 50; ++i)
+      {
+        sharded.loadShard("de", bigShard);
+      }
+      CHECK(counting.outstanding < once * 2);
+      CHECK(sharded.t("key 7", "de") == std::string(200, 'x') && sharded.t("greeting", "en") == "Hello");
+    }
+    std::pmr::set_default_resource(previous);
+    CHECK(counting.outstanding == 0);
+  }
+
+  /**
+   * @brief Run @p action with std::cerr redirected, returning what it wrote
+   */
+  template <typename Action>
+  std::string stderrOf(Action &&action)
+  {
+    std::ostringstream captured;
+    std::streambuf *previous = std::cerr.rdbuf(captured.rdbuf());
+    action();
+    std::cerr.rdbuf(previous);
+    return captured.str();
+  }
+
+  /**
+   * @brief Lookups every fallback policy answers the same way
+   */
+  template <typename I18nType>
+  void checkCommon(const I18nType &i18n)
+  {
+    CHECK(i18n.t("greeting", "de") == "Hallo");
+    CHECK(i18n.t("greeting", "en") == "Hello");
+    CHECK(i18n.template t<int>("count", "en") == 3);
+    CHECK(i18n.t("missing", "de", std::string("default")) == "default");
+  }
+} // namespace
+
+int main()
+{
+  std::filesystem::path directory = std::filesystem::temp_directory_path() / "i18n-test-policies";
+  std::filesystem::create_directories(directory);
+  std::string shard = (directory / "de.json").string();
+  std::string replacement = (directory / "all.json").string();
+  std::ofstream(shard) << nlohmann::json{{"greeting", "Servus"}}.dump();
+  std::ofstream(replacement) << nlohmann::json{{"en", {{"greeting", "Hi"}}}}.dump();
+  std::string original = (directory / "original.json").string();
+  std::string bigShard = (directory / "big.json").string();
+  std::ofstream(original) << translations.dump();
+  nlohmann::json big = nlohmann::json::object();
+  for (int i = 0; i < 200; ++i)
+  {
+    big["key " + std::to_string(i)] = std::string(200, 'x');
+  }
+  std::ofstream(bigShard) << big.dump();
+
+  // EnglishFallback: a path missing in a locale comes from "en", then "Content not found".
+  Quiet quiet(translations);
+  checkCommon(quiet);
+  CHECK(quiet.t("farewell", "de") == "Goodbye");
+  CHECK(quiet.t<int>("count", "de") == 3);
+  CHECK(quiet.t("missing", "de") == "Content not found");
+
+  // NoFallback: only the requested locale, and an empty string when nothing is found.
+  Lean lean(translations);
+  checkCommon(lean);
+  CHECK(lean.t("farewell", "de").empty());
+  CHECK(lean.t("farewell", "de", std::string("none")) == "none");
+  CHECK(lean.t<int>("count", "de", -1) == -1);
+  CHECK(lean.t("farewell", "fr").empty());
+
+  // StderrDiagnostics warns about a path found only in the requested locale; NoDiagnostics
+  // does not check at all.
+  Default noisy(translations);
+  std::string warning = stderrOf([&]()
+                                 { noisy.t("onlyGerman", "de"); });
+  CHECK(warning.find("Warning: Content for path 'onlyGerman'") != std::string::npos);
+  CHECK(warning.find("'de'") != std::string::npos);
+  CHECK(stderrOf([&]()
+                 { noisy.t("greeting", "de"); })
+            .empty());
+  CHECK(stderrOf([&]()
+                 { quiet.t("onlyGerman", "de"); lean.t("onlyGerman", "de"); })
+            .empty());
+
+  // SharedSnapshot answers like SingleThreaded; a copy shares the data until either side
+  // is updated, then the two diverge.
+  Shared shared(translations);
+  checkCommon(shared);
+  CHECK(shared.t("farewell", "de") == "Goodbye");
+  Shared copy(shared);
+  copy.loadShard("de", shard);
+  CHECK(copy.t("greeting", "de") == "Servus" && shared.t("greeting", "de") == "Hallo");
+  shared.load(replacement);
+  CHECK(shared.t("greeting", "en") == "Hi" && shared.t("greeting", "de") == "Hi");
+  CHECK(copy.t("greeting", "en") == "Hello" && copy.t("farewell", "de") == "Goodbye");
+  Shared assigned;
+  assigned = copy;
+  CHECK(assigned.t("greeting", "de") == "Servus");
+
+  // load_async(): the bootstrap data answers while the load is pending, the new data after
+  // the future is ready, and a failed load rethrows through the future and keeps the data.
+  GateResource gate;
+  Shared bootstrapped(nlohmann::json{{"en", {{"greeting", "Bootstrap"}}}});
+  std::future<void> ready = bootstrapped.load_async(original, &gate);
+  gate.waitUntilEntered();
+  CHECK(bootstrapped.t("greeting", "de") == "Bootstrap");
+  CHECK(ready.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+  gate.open();
+  ready.get();
+  CHECK(bootstrapped.t("greeting", "de") == "Hallo" && bootstrapped.getLocales().size() == 2);
+  std::future<void> failed = bootstrapped.load_async((directory / "missing.json").string());
+  std::string error = test::thrown([&]()
+                                   { failed.get(); });
+  CHECK(error.find("Could not open file") != std::string::npos);
+  CHECK(bootstrapped.t("greeting", "de") == "Hallo");
+
+  // SingleThreaded copies are independent from the start.
+  Quiet quietCopy(quiet);
+  quietCopy.loadShard("de", shard);
+  CHECK(quietCopy.t("greeting", "de") == "Servus" && quiet.t("greeting", "de") == "Hallo");
+
+  // Policies combine freely: no fallback with diagnostics on shared snapshots.
+  SharedLean sharedLean(translations);
+  stderrOf([&]()
+           { checkCommon(sharedLean); });
+  CHECK(sharedLean.t("farewell", "de").empty());
+  CHECK(stderrOf([&]()
+                 { sharedLean.t("onlyGerman", "de"); })
+            .find("'onlyGerman'") != std::string::npos);
+
+  // The std::pmr::string overload of t() is picked for any memory resource pointer, with
+  // literal or std::string arguments, and follows the policy's fallback.
+  std::pmr::monotonic_buffer_resource request;
+  std::string path = "farewell";
+  std::string locale = "de";
+  std::pmr::string text = quiet.t("farewell", "de", &request);
+  CHECK(text == "Goodbye" && text.get_allocator().resource() == &request);
+  CHECK(quiet.t(path, locale, &request) == "Goodbye");
+  CHECK(shared.t(std::string("greeting"), locale, &request) == "Hi");
+  CHECK(lean.t(path, locale, &request).empty());
+  CHECK(lean.t(std::string("greeting"), std::string("de"), &request) == "Hallo");
+
+  // load() with a memory resource: the new locale list lives on it, under either threading
+  // policy, and assigning an instance keeps the assigned-from data.
+  std::pmr::monotonic_buffer_resource bookkeeping;
+  Quiet reloaded(translations);
+  reloaded.load(replacement, &bookkeeping);
+  CHECK(reloaded.getLocales().get_allocator().resource() == &bookkeeping);
+  CHECK(reloaded.t("greeting", "de") == "Hi");
+  Shared sharedReloaded(translations);
+  sharedReloaded.load(replacement, &bookkeeping);
+  CHECK(sharedReloaded.getLocales().get_allocator().resource() == &bookkeeping);
+  Quiet target(translations);
+  target = std::move(reloaded);
+  CHECK(target.t("greeting", "de") == "Hi" && target.getLocales().size() == 1);
+  target = quiet;
+  CHECK(target.t("greeting", "de") == "Hallo" && target.getLocales().size() == 2);
+
+  // Storage move assignment across resources moves the locale list onto the target's resource.
+  i18n::JsonStorage onHeap(translations);
+  i18n::JsonStorage onArena(nlohmann::json{{"fr", {{"greeting", "Salut"}}}}, &bookkeeping);
+  onHeap = std::move(onArena);
+  CHECK(onHeap.resource() == std::pmr::get_default_resource());
+  CHECK(onHeap.locales().size() == 1 && onHeap.locales().front() == "fr");
+  CHECK(onHeap.find("fr", "greeting") && *onHeap.find("fr", "greeting") == "Salut");
+
+  checkArena<i18n::basic_i18n<i18n::BasicJsonStorage<i18n::ArenaJson>, i18n::EnglishFallback, i18n::NoDiagnostics>>(original, shard, bigShard);
+  checkArena<i18n::basic_i18n<i18n::BasicJsonStorage<i18n::FlatArenaJson>, i18n::EnglishFallback, i18n::NoDiagnostics>>(original, shard, bigShard);
+  checkArena<i18n::basic_i18n<i18n::BasicJsonStorage<i18n::ArenaJson>, i18n::EnglishFallback, i18n::NoDiagnostics, i18n::SharedSnapshot>>(original, shard, bigShard);
+
+  std::filesystem::remove_all(directory);
+  return test::finish();
+}
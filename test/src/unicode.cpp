@@ -0,0 +1,143 @@
+// Text metrics: grapheme clusters (combining marks, Hangul, emoji ZWJ sequences, flags), East
+// Asian width, direction of the first strong character, and the metrics stored by binary
+// catalogs (version 2) against those recomputed when loading a version 1 file.
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/unicode.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace
+{
+  bool metrics(std::string_view text, std::uint32_t codePoints, std::uint32_t graphemes, std::uint32_t width)
+  {
+    i18n::TextMetrics m = i18n::measureText(text);
+    bool ok = m.codePoints == codePoints && m.graphemes == graphemes && m.width == width;
+    if (!ok)
+    {
+      std::printf("  measureText: %u code points, %u graphemes, %u columns\n", m.codePoints, m.graphemes, m.width);
+    }
+    return ok;
+  }
+
+  i18n::TextDirection direction(std::string_view text)
+  {
+    return i18n::measureText(text).direction;
+  }
+} // namespace
+
+int main()
+{
+  using Direction = i18n::TextDirection;
+
+  // ASCII, control characters and CR LF (one cluster).
+  CHECK(metrics("", 0, 0, 0));
+  CHECK(metrics("Hello", 5, 5, 5));
+  CHECK(metrics("a\r\nb", 4, 3, 2));
+  CHECK(metrics("a\tb", 3, 3, 2));
+  CHECK(i18n::measureText("Hello").ascii);
+  CHECK(!i18n::measureText("caf\xC3\xA9").ascii);
+
+  // Combining marks join the preceding character, also right after an ASCII prefix.
+  CHECK(metrics("caf\xC3\xA9", 4, 4, 4));
+  CHECK(metrics("cafe\xCC\x81", 5, 4, 4));
+  CHECK(metrics("a\xCC\x80\xCC\x81\xCC\x82", 4, 1, 1));
+  CHECK(metrics("\xCC\x81x", 2, 2, 1));
+  CHECK(metrics("\xE0\xA4\xA8\xE0\xA4\xAE\xE0\xA4\xB8\xE0\xA5\x8D\xE0\xA4\xA4\xE0\xA5\x87", 6, 4, 4)); // Devanagari namaste
+
+  // Hangul: precomposed syllables, and conjoining jamo L V T forming one syllable.
+  CHECK(metrics("\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4", 3, 3, 6));
+  CHECK(metrics("\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB", 3, 1, 2));
+  CHECK(metrics("\xEA\xB0\x80\xE1\x86\xA8", 2, 1, 2)); // LV + T
+
+  // Emoji: ZWJ sequences, skin tones, presentation selectors and flags.
+  CHECK(metrics("\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7", 5, 1, 2));
+  CHECK(metrics("\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD", 2, 1, 2));
+  CHECK(metrics("\xE2\x9D\xA4\xEF\xB8\x8F", 2, 1, 2));
+  CHECK(metrics("\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA", 2, 1, 2));
+  CHECK(metrics("\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5", 4, 2, 4));
+  CHECK(metrics("ok \xF0\x9F\x98\x80!", 5, 5, 6));
+  // A ZWJ not preceded by an emoji does not glue the next emoji to it.
+  CHECK(metrics("a\xE2\x80\x8D\xF0\x9F\x98\x80", 3, 2, 3));
+
+  // East Asian width: wide and fullwidth take two columns, halfwidth forms one.
+  CHECK(metrics("\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", 3, 3, 6));
+  CHECK(metrics("\xEF\xBC\xA1\xEF\xBC\xA2", 2, 2, 4));
+  CHECK(metrics("\xEF\xBD\xB1\xEF\xBD\xB2", 2, 2, 2));
+  CHECK(metrics("\xE3\x81\x8B\xE3\x82\x99", 2, 1, 2)); // hiragana ka + combining dakuten
+  CHECK(metrics("Tokyo \xE6\x9D\xB1\xE4\xBA\xAC", 8, 8, 10));
+
+  // Direction of the first strong character; digits and punctuation are neutral.
+  CHECK(direction("") == Direction::Neutral);
+  CHECK(direction("123 !?") == Direction::Neutral);
+  CHECK(direction("Hello") == Direction::LeftToRight);
+  CHECK(direction("(\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82)") == Direction::LeftToRight);
+  CHECK(direction("\xE6\x97\xA5\xE6\x9C\xAC") == Direction::LeftToRight);
+  CHECK(direction("\xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D") == Direction::RightToLeft);
+  CHECK(direction("\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7") == Direction::RightToLeft);
+  CHECK(direction("42 \xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D abc") == Direction::RightToLeft);
+  CHECK(direction("abc \xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D") == Direction::LeftToRight);
+
+  // Binary catalogs: version 2 stores the metrics, version 1 recomputes them on load.
+  nlohmann::json json = {
+      {"en", {{"plain", "Hello"}, {"family", "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"}, {"flag", "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA"}}},
+      {"he", {{"plain", "\xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D"}}},
+      {"ko", {{"plain", "\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4"}, {"flag", "\xEA\xB0\x80\xE1\x86\xA8"}}},
+      {"ja", {{"plain", "\xEF\xBD\xB1 Tokyo \xE6\x9D\xB1\xE4\xBA\xAC"}}}};
+  i18n::Catalog catalog(json);
+  std::string path = (std::filesystem::temp_directory_path() / "i18n-test-unicode.i18nc").string();
+  catalog.save(path);
+  std::string v2;
+  {
+    std::ifstream in(path, std::ios::binary);
+    v2.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+
+  // Version 1 is the same file without the metrics records between the cells and the pool.
+  std::uint32_t poolOffset;
+  std::memcpy(&poolOffset, v2.data() + 28, 4);
+  std::size_t metricsBytes = catalog.keyCount() * catalog.localeCount() * 16;
+  std::string v1 = v2.substr(0, poolOffset - metricsBytes) + v2.substr(poolOffset);
+  std::uint32_t version = 1;
+  std::uint32_t v1PoolOffset = static_cast<std::uint32_t>(poolOffset - metricsBytes);
+  std::memcpy(&v1[8], &version, 4);
+  std::memcpy(&v1[28], &v1PoolOffset, 4);
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << v1;
+  i18n::Catalog fromV1 = i18n::Catalog::load(path);
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << v2;
+  i18n::Catalog fromV2 = i18n::Catalog::load(path);
+
+  bool same = true;
+  for (i18n::KeyId key = 0; key < catalog.keyCount(); ++key)
+  {
+    for (i18n::LocaleId locale = 0; locale < catalog.localeCount(); ++locale)
+    {
+      i18n::TextMetrics expected = i18n::measureText(catalog.t_view(key, locale));
+      same = same && catalog.t_meta(key, locale) == expected && fromV1.t_meta(key, locale) == expected &&
+             fromV2.t_meta(key, locale) == expected && fromV1.isAscii(key, locale) == catalog.isAscii(key, locale) &&
+             fromV2.isAscii(key, locale) == catalog.isAscii(key, locale);
+    }
+  }
+  CHECK(same);
+  CHECK(fromV1.t_meta("family", "en").graphemes == 1);
+  CHECK(fromV2.t_meta("plain", "he").direction == Direction::RightToLeft);
+  CHECK(fromV2.t_meta("plain", "ja").width == 12);
+
+  // A version 2 record with an out-of-range direction is rejected.
+  std::string corrupt = v2;
+  std::size_t firstRecord = poolOffset - metricsBytes;
+  corrupt[firstRecord + 12] = 3;
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+  CHECK(test::thrown([&]()
+                     { i18n::Catalog::load(path); })
+            .rfind("Corrupt binary catalog", 0) == 0);
+
+  std::filesystem::remove(path);
+  return test::finish();
+}
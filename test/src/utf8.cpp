@@ -0,0 +1,135 @@
+// UTF-8 validation and repair: maximal-subpart replacement, overlongs, surrogates and code
+// points above U+10FFFF, each placed after ASCII prefixes of every length so sequences start
+// and straddle the 8- and 16-byte boundaries of the vectorized ASCII scan.
+
+#include "check.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/utf8.hpp>
+
+#include <string>
+
+namespace
+{
+  const std::string fffd = "\xEF\xBF\xBD";
+
+  struct Case
+  {
+    std::string input;
+    std::string repaired;
+    std::size_t error; // offset of the first invalid byte, npos if valid
+  };
+
+  std::string ascii(std::size_t length)
+  {
+    std::string text;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+      text.push_back(static_cast<char>('a' + i % 26));
+    }
+    return text;
+  }
+} // namespace
+
+int main()
+{
+  const std::size_t npos = std::string::npos;
+  const Case cases[] = {
+      // Valid sequences at the edges of each length class.
+      {"\xC2\x80", "\xC2\x80", npos},
+      {"\xDF\xBF", "\xDF\xBF", npos},
+      {"\xE0\xA0\x80", "\xE0\xA0\x80", npos},
+      {"\xED\x9F\xBF", "\xED\x9F\xBF", npos},
+      {"\xEE\x80\x80", "\xEE\x80\x80", npos},
+      {"\xEF\xBF\xBF", "\xEF\xBF\xBF", npos},
+      {"\xF0\x90\x80\x80", "\xF0\x90\x80\x80", npos},
+      {"\xF4\x8F\xBF\xBF", "\xF4\x8F\xBF\xBF", npos},
+      {"\xE2\x82\xAC\xF0\x9F\x98\x80\xC3\xA9", "\xE2\x82\xAC\xF0\x9F\x98\x80\xC3\xA9", npos},
+
+      // Overlong forms: the lead or second byte is already invalid, so every byte is replaced.
+      {"\xC0\x80", fffd + fffd, 0},
+      {"\xC1\xBF", fffd + fffd, 0},
+      {"\xE0\x80\x80", fffd + fffd + fffd, 0},
+      {"\xE0\x9F\xBF", fffd + fffd + fffd, 0},
+      {"\xF0\x80\x80\x80", fffd + fffd + fffd + fffd, 0},
+      {"\xF0\x8F\xBF\xBF", fffd + fffd + fffd + fffd, 0},
+
+      // Surrogates (U+D800..U+DFFF) and code points above U+10FFFF.
+      {"\xED\xA0\x80", fffd + fffd + fffd, 0},
+      {"\xED\xBF\xBF", fffd + fffd + fffd, 0},
+      {"\xED\xA0\xBD\xED\xB8\x80", fffd + fffd + fffd + fffd + fffd + fffd, 0}, // a surrogate pair (CESU-8)
+      {"\xF4\x90\x80\x80", fffd + fffd + fffd + fffd, 0},
+      {"\xF5\x80\x80\x80", fffd + fffd + fffd + fffd, 0},
+      {"\xF7\xBF\xBF\xBF", fffd + fffd + fffd + fffd, 0},
+      {"\xFE", fffd, 0},
+      {"\xFF", fffd, 0},
+
+      // Maximal subparts: a truncated sequence is one replacement, a stray continuation one each.
+      {"\xE2\x82", fffd, 0},
+      {"\xF0\x9F\x98", fffd, 0},
+      {"\xF0\x9F\x98" "A", fffd + "A", 0},
+      {"\xE2\x82\xC3\xA9", fffd + "\xC3\xA9", 0},
+      {"\x80", fffd, 0},
+      {"\x80\xBF\x80", fffd + fffd + fffd, 0},
+      {"\xC3\xA9\x80", "\xC3\xA9" + fffd, 2},
+      {"\xE2\x82\xAC\xE2\x82", "\xE2\x82\xAC" + fffd, 3},
+      // Unicode Standard, Table 3-8.
+      {"\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64", "a" + fffd + fffd + fffd + "b" + fffd + "c" + fffd + fffd + "d", 1},
+  };
+
+  for (const Case &entry : cases)
+  {
+    const std::string &expected = entry.repaired;
+
+    // Every prefix length up to 40 puts the sequence at, before and after offsets 8, 15, 16, 31 and 32.
+    bool validOk = true;
+    bool repairOk = true;
+    for (std::size_t prefix = 0; prefix <= 40; ++prefix)
+    {
+      for (std::size_t suffix : {0, 1, 17})
+      {
+        std::string text = ascii(prefix) + entry.input + ascii(suffix);
+        std::size_t error = i18n::validateUtf8(text);
+        validOk = validOk && error == (entry.error == npos ? npos : prefix + entry.error);
+        repairOk = repairOk && i18n::repairUtf8(text) == ascii(prefix) + expected + ascii(suffix);
+      }
+    }
+    CHECK(validOk);
+    CHECK(repairOk);
+    CHECK(i18n::validateUtf8(expected) == npos);
+  }
+
+  // Long mixed input: repair is the identity on valid text and isAscii() sees every byte.
+  std::string mixed;
+  for (int i = 0; i < 100; ++i)
+  {
+    mixed += ascii(static_cast<std::size_t>(i % 19)) + "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+  }
+  CHECK(i18n::validateUtf8(mixed) == npos);
+  CHECK(i18n::repairUtf8(mixed) == mixed);
+  CHECK(!i18n::isAscii(mixed));
+  CHECK(i18n::isAscii(ascii(1000)));
+  CHECK(i18n::isAscii(""));
+  CHECK(i18n::validateUtf8("") == npos);
+  for (std::size_t at = 0; at < 40; ++at)
+  {
+    std::string text = ascii(40);
+    text[at] = '\x80';
+    CHECK(!i18n::isAscii(text));
+  }
+
+  // Catalog builds reject or repair invalid translations, and always reject invalid keys.
+  i18n::CatalogBuilder builder;
+  builder.add("en", "broken", "caf\xE9 ok");
+  CHECK(test::thrown([&]()
+                     { builder.build(); }) == "Invalid UTF-8 at byte 3 of 'broken' in locale 'en'");
+  builder.add("en", "broken", "caf\xE9 ok");
+  i18n::CatalogOptions options;
+  options.invalidUtf8 = i18n::InvalidUtf8::Repair;
+  CHECK(builder.build(options).t_view("broken", "en") == "caf" + fffd + " ok");
+  builder.add("en", "bad\xFFkey", "x");
+  CHECK(test::thrown([&]()
+                     { builder.build(options); })
+            .rfind("Invalid UTF-8 in key path", 0) == 0);
+  return test::finish();
+}
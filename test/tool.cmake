@@ -0,0 +1,21 @@
+# Run i18n-tool once and check its exit code and output; used by the tool_* tests.
+#
+#   cmake -DTOOL=<i18n-tool> -DARGS=<a;b;c> -DEXIT=<code> -DEXPECT=<regex> -P tool.cmake
+#
+# EXPECT must match the combined stdout and stderr.
+
+execute_process(
+  COMMAND ${TOOL} ${ARGS}
+  RESULT_VARIABLE result
+  OUTPUT_VARIABLE output
+  ERROR_VARIABLE output
+)
+
+if(NOT "${result}" STREQUAL "${EXIT}")
+  message(FATAL_ERROR "i18n-tool ${ARGS} exited with ${result}, expected ${EXIT}:\n${output}")
+endif()
+
+if(NOT output MATCHES "${EXPECT}")
+  message(FATAL_ERROR "i18n-tool ${ARGS} output does not match '${EXPECT}':\n${output}")
+endif()
+
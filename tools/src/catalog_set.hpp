@@ -0,0 +1,298 @@
+#ifndef I18N_TOOL_CATALOG_SET_HPP
+#define I18N_TOOL_CATALOG_SET_HPP
+
+#include <i18n/i18n.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace tool
+{
+  /**
+   * @brief Run @p fn for every index in [0, count) on up to @p threads worker threads.
+   *
+   * Work is handed out one index at a time through an atomic counter, so uneven items
+   * (one huge locale next to many small ones) still keep every worker busy. The first
+   * exception thrown by any worker is rethrown on the calling thread.
+   */
+  template <typename Fn>
+  void parallelFor(std::size_t count, unsigned threads, Fn fn)
+  {
+    if (count == 0)
+    {
+      return;
+    }
+
+    unsigned workers = static_cast<unsigned>(std::min<std::size_t>(std::max(threads, 1u), count));
+    if (workers == 1)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        fn(i);
+      }
+      return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+
+    for (unsigned w = 0; w < workers; ++w)
+    {
+      pool.emplace_back([&]()
+                        {
+        for (std::size_t i = next++; i < count; i = next++)
+        {
+          try
+          {
+            fn(i);
+          }
+          catch (...)
+          {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+            {
+              error = std::current_exception();
+            }
+          }
+        } });
+    }
+
+    for (auto &thread : pool)
+    {
+      thread.join();
+    }
+
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  /**
+   * @brief A single non-object value in a locale tree, addressed by its dot-separated path.
+   */
+  struct Leaf
+  {
+    std::string path;
+    const nlohmann::json *value;
+    std::size_t depth;
+  };
+
+  /**
+   * @brief Flattened view of one locale.
+   */
+  struct LocaleView
+  {
+    std::string code;
+    const nlohmann::json *root = nullptr;
+    std::vector<Leaf> leaves;
+
+    /**
+     * @brief Find a leaf by path using binary search (leaves are kept sorted by path).
+     */
+    const Leaf *find(const std::string &path) const
+    {
+      auto it = std::lower_bound(leaves.begin(), leaves.end(), path,
+                                 [](const Leaf &leaf, const std::string &key)
+                                 { return leaf.path < key; });
+      return it != leaves.end() && it->path == path ? &*it : nullptr;
+    }
+  };
+
+  /**
+   * @brief Collect every leaf below @p node, depth-first.
+   */
+  inline void flatten(const nlohmann::json &node, const std::string &prefix, std::size_t depth, std::vector<Leaf> &out)
+  {
+    for (auto &[key, value] : node.items())
+    {
+      std::string path = prefix.empty() ? key : prefix + "." + key;
+      if (value.is_object())
+      {
+        flatten(value, path, depth + 1, out);
+      }
+      else
+      {
+        out.push_back({std::move(path), &value, depth + 1});
+      }
+    }
+  }
+
+  /**
+   * @brief Resolve a dot-separated path below @p root, or nullptr if any segment is missing.
+   *
+   * Segments are views into @p path and are looked up without building key strings.
+   */
+  inline const nlohmann::json *resolve(const nlohmann::json &root, std::string_view path)
+  {
+    const nlohmann::json *current = &root;
+    std::size_t begin = 0;
+    while (begin < path.size())
+    {
+      std::size_t end = std::min(path.find('.', begin), path.size());
+      if (!current->is_object())
+      {
+        return nullptr;
+      }
+      auto it = current->find(path.substr(begin, end - begin));
+      if (it == current->end())
+      {
+        return nullptr;
+      }
+      current = &*it;
+      begin = end + 1;
+    }
+    return current;
+  }
+
+  /**
+   * @brief Recursively merge @p source into @p target, with @p source winning on conflicts.
+   *
+   * Values are moved out of @p source, which is left in a valid but unspecified state.
+   */
+  inline void deepMerge(nlohmann::json &target, nlohmann::json &&source)
+  {
+    for (auto it = source.begin(); it != source.end(); ++it)
+    {
+      auto existing = target.find(it.key());
+      if (existing != target.end() && existing->is_object() && it->is_object())
+      {
+        deepMerge(*existing, std::move(*it));
+      }
+      else
+      {
+        target[it.key()] = std::move(*it);
+      }
+    }
+  }
+
+  /**
+   * @brief Read and parse one translation file.
+   *
+   * @throws std::runtime_error If the file cannot be opened, is empty, or contains invalid JSON
+   */
+  inline nlohmann::json parseFile(const std::string &path)
+  {
+    std::ifstream ifs(path);
+    if (!ifs.is_open())
+    {
+      throw std::runtime_error("Could not open file: " + path);
+    }
+    if (ifs.peek() == std::ifstream::traits_type::eof())
+    {
+      throw std::runtime_error("File is empty: " + path);
+    }
+    try
+    {
+      return nlohmann::json::parse(ifs);
+    }
+    catch (const nlohmann::json::parse_error &e)
+    {
+      throw std::runtime_error("Invalid JSON in file: " + path + "\n" + e.what());
+    }
+  }
+
+  /**
+   * @brief One or more translation files merged into a single I18n instance and flattened per locale.
+   *
+   * Files are parsed concurrently, then merged in command-line order so later files override
+   * earlier ones; subtrees are moved rather than copied, and the merged tree is moved into the
+   * I18n instance. Each locale is flattened on its own worker, which is where most of the time
+   * goes for very large catalogs.
+   */
+  struct CatalogSet
+  {
+    I18n i18n;
+    std::vector<LocaleView> locales;
+
+    CatalogSet() = default;
+    CatalogSet(CatalogSet &&) noexcept = default;
+    CatalogSet &operator=(CatalogSet &&) noexcept = default;
+
+    // Views point into i18n, so a copy would alias the original's data.
+    CatalogSet(const CatalogSet &) = delete;
+    CatalogSet &operator=(const CatalogSet &) = delete;
+
+    /**
+     * @brief Load and flatten @p files using up to @p threads workers.
+     *
+     * @throws std::runtime_error If any file cannot be loaded or the merged data is invalid
+     */
+    static CatalogSet load(const std::vector<std::string> &files, unsigned threads)
+    {
+      if (files.empty())
+      {
+        throw std::runtime_error("No input files");
+      }
+
+      std::vector<nlohmann::json> parsed(files.size());
+      parallelFor(files.size(), threads, [&](std::size_t i)
+                  {
+        parsed[i] = parseFile(files[i]);
+        if (!parsed[i].is_object())
+        {
+          throw std::runtime_error("JSON must be an object: " + files[i]);
+        } });
+
+      nlohmann::json merged = std::move(parsed.front());
+      for (std::size_t i = 1; i < parsed.size(); ++i)
+      {
+        deepMerge(merged, std::move(parsed[i]));
+        parsed[i] = nullptr;
+      }
+
+      CatalogSet set;
+      set.i18n = I18n(std::move(merged));
+
+      const nlohmann::json &data = set.i18n.getTranslations();
+      for (std::string_view locale : set.i18n.getLocales())
+      {
+        std::string code(locale);
+        LocaleView view;
+        view.code = code;
+        view.root = &data.at(code);
+        set.locales.push_back(std::move(view));
+      }
+
+      parallelFor(set.locales.size(), threads, [&](std::size_t i)
+                  {
+        LocaleView &view = set.locales[i];
+        if (view.root->is_object())
+        {
+          flatten(*view.root, "", 0, view.leaves);
+        }
+        std::sort(view.leaves.begin(), view.leaves.end(), [](const Leaf &a, const Leaf &b)
+                  { return a.path < b.path; }); });
+
+      return set;
+    }
+
+    /**
+     * @brief Find a flattened locale by code, or nullptr if it is not present.
+     */
+    const LocaleView *find(const std::string &code) const
+    {
+      for (const auto &view : locales)
+      {
+        if (view.code == code)
+        {
+          return &view;
+        }
+      }
+      return nullptr;
+    }
+  };
+} // namespace tool
+
+#endif // I18N_TOOL_CATALOG_SET_HPP
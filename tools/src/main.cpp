@@ -0,0 +1,1008 @@
+#include "catalog_set.hpp"
+
+#include <i18n/catalog.hpp>
+#include <i18n/exchange.hpp>
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  /**
+   * @brief Error in the command line itself; reported together with the usage text.
+   */
+  struct UsageError : std::runtime_error
+  {
+    using std::runtime_error::runtime_error;
+  };
+
+  const char *const usage =
+      "Usage: i18n-tool <command> [options] <file>...\n"
+      "\n"
+      "Commands:\n"
+      "  stats     Key counts, depth histogram, bytes per locale and duplicate strings\n"
+      "  lint      Report structural problems and placeholder mismatches\n"
+      "  coverage  Percentage of reference keys translated in every other locale\n"
+      "  compile   Merge the inputs into a single minified JSON or binary catalog\n"
+      "  diff      Compare two catalogs: i18n-tool diff <old> <new>\n"
+      "  prune     Drop keys missing from the reference locale, null values and empty objects\n"
+      "  import    Stream CSV/XLIFF files into a binary catalog: i18n-tool import -o <out> <file>...\n"
+      "  export    Stream a JSON or binary catalog out as CSV or XLIFF\n"
+      "\n"
+      "Options:\n"
+      "  -o, --output <file>  Output file for compile/prune (default: stdout)\n"
+      "  --format <fmt>       compile: json (default) or binary; import/export: csv or xliff\n"
+      "                       (import detects it from the file extension by default)\n"
+      "  --target <locale>    export: target locale of an XLIFF file\n"
+      "  --layout <order>     compile: key-major (default) or locale-major cell order for binary output\n"
+      "  --repair-utf8        import: replace invalid UTF-8 with U+FFFD instead of failing\n"
+      "  -j, --jobs <n>       Worker threads (default: hardware concurrency)\n"
+      "  --ref <locale>       Reference locale for lint/coverage/prune (default: en)\n"
+      "  --json               Machine-readable output for stats/coverage\n"
+      "  --min <percent>      coverage: fail when any locale is below this percentage\n"
+      "  --top <n>            stats: number of duplicate strings to list (default: 10)\n"
+      "  --strict             lint: treat warnings as errors\n"
+      "  -v, --verbose        List individual keys in coverage/diff output\n";
+
+  /**
+   * @brief Parsed command line.
+   */
+  struct Options
+  {
+    std::string command;
+    std::vector<std::string> files;
+    std::string output;
+    std::string ref = "en";
+    std::string format;
+    std::string target;
+    i18n::Layout layout = i18n::Layout::KeyMajor;
+    i18n::InvalidUtf8 invalidUtf8 = i18n::InvalidUtf8::Reject;
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+    bool json = false;
+    bool strict = false;
+    bool verbose = false;
+    double minCoverage = -1.0;
+    std::size_t top = 10;
+  };
+
+  /**
+   * @brief Parse the value of a numeric option, requiring a whole number when @p integral is set.
+   *
+   * @throws UsageError If @p text is not a number in [@p low, @p high]
+   */
+  double parseNumber(const std::string &arg, const std::string &text, double low, double high, bool integral)
+  {
+    char *end = nullptr;
+    double parsed = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() || *end != '\0' || !std::isfinite(parsed) || parsed < low || parsed > high ||
+        (integral && parsed != std::floor(parsed)))
+    {
+      throw UsageError("Invalid value for " + arg + ": " + text);
+    }
+    return parsed;
+  }
+
+  Options parseOptions(int argc, char **argv)
+  {
+    Options options;
+    if (argc < 2)
+    {
+      throw UsageError("Missing command");
+    }
+    options.command = argv[1];
+
+    for (int i = 2; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+      auto value = [&]() -> std::string
+      {
+        if (i + 1 >= argc)
+        {
+          throw UsageError("Missing value for " + arg);
+        }
+        return argv[++i];
+      };
+
+      if (arg == "-o" || arg == "--output")
+      {
+        options.output = value();
+      }
+      else if (arg == "-j" || arg == "--jobs")
+      {
+        options.jobs = static_cast<unsigned>(parseNumber(arg, value(), 1, 4096, true));
+      }
+      else if (arg == "--format")
+      {
+        options.format = value();
+        if (options.format != "json" && options.format != "binary" && options.format != "csv" && options.format != "xliff")
+        {
+          throw UsageError("Unknown format: " + options.format);
+        }
+      }
+      else if (arg == "--target")
+      {
+        options.target = value();
+      }
+      else if (arg == "--layout")
+      {
+        std::string layout = value();
+        if (layout == "key-major")
+        {
+          options.layout = i18n::Layout::KeyMajor;
+        }
+        else if (layout == "locale-major")
+        {
+          options.layout = i18n::Layout::LocaleMajor;
+        }
+        else
+        {
+          throw UsageError("Unknown layout: " + layout);
+        }
+      }
+      else if (arg == "--repair-utf8")
+      {
+        options.invalidUtf8 = i18n::InvalidUtf8::Repair;
+      }
+      else if (arg == "--ref")
+      {
+        options.ref = value();
+      }
+      else if (arg == "--json")
+      {
+        options.json = true;
+      }
+      else if (arg == "--min")
+      {
+        options.minCoverage = parseNumber(arg, value(), 0, 100, false);
+      }
+      else if (arg == "--top")
+      {
+        options.top = static_cast<std::size_t>(parseNumber(arg, value(), 0, 1e9, true));
+      }
+      else if (arg == "--strict")
+      {
+        options.strict = true;
+      }
+      else if (arg == "-v" || arg == "--verbose")
+      {
+        options.verbose = true;
+      }
+      else if (!arg.empty() && arg[0] == '-' && arg != "-")
+      {
+        throw UsageError("Unknown option: " + arg);
+      }
+      else
+      {
+        options.files.push_back(arg);
+      }
+    }
+
+    return options;
+  }
+
+  /**
+   * @brief Write @p json to the configured output file, or stdout when none was given.
+   */
+  void writeOutput(const Options &options, const nlohmann::json &json)
+  {
+    if (options.output.empty() || options.output == "-")
+    {
+      std::cout << json.dump() << std::endl;
+      return;
+    }
+
+    std::ofstream ofs(options.output, std::ios::binary);
+    if (!ofs.is_open())
+    {
+      throw std::runtime_error("Could not open file: " + options.output);
+    }
+    ofs << json.dump();
+  }
+
+  std::string quote(const std::string &value)
+  {
+    return nlohmann::json(value).dump();
+  }
+
+  /**
+   * @brief Extract the set of `{placeholder}` names used in a translation string.
+   */
+  std::set<std::string> placeholders(const std::string &text)
+  {
+    std::set<std::string> names;
+    std::size_t pos = 0;
+    while ((pos = text.find('{', pos)) != std::string::npos)
+    {
+      std::size_t end = text.find('}', pos + 1);
+      if (end == std::string::npos)
+      {
+        break;
+      }
+      names.insert(text.substr(pos + 1, end - pos - 1));
+      pos = end + 1;
+    }
+    return names;
+  }
+
+  // ---------------------------------------------------------------------------
+  // stats
+  // ---------------------------------------------------------------------------
+
+  struct LocaleStats
+  {
+    std::size_t keys = 0;
+    std::size_t strings = 0;
+    std::size_t valueBytes = 0;
+    std::size_t keyBytes = 0;
+    std::size_t maxDepth = 0;
+    std::map<std::size_t, std::size_t> depths;
+    std::size_t duplicateValues = 0;
+    std::size_t duplicateBytes = 0;
+    std::vector<std::pair<std::string, std::size_t>> topDuplicates;
+  };
+
+  LocaleStats computeStats(const tool::LocaleView &view, std::size_t top)
+  {
+    LocaleStats stats;
+    std::unordered_map<std::string_view, std::size_t> seen;
+    seen.reserve(view.leaves.size());
+
+    for (const auto &leaf : view.leaves)
+    {
+      ++stats.keys;
+      stats.keyBytes += leaf.path.size();
+      stats.maxDepth = std::max(stats.maxDepth, leaf.depth);
+      ++stats.depths[leaf.depth];
+
+      if (leaf.value->is_string())
+      {
+        const auto &text = leaf.value->get_ref<const std::string &>();
+        ++stats.strings;
+        stats.valueBytes += text.size();
+        if (++seen[text] > 1)
+        {
+          stats.duplicateBytes += text.size();
+        }
+      }
+    }
+
+    for (const auto &[text, count] : seen)
+    {
+      if (count > 1)
+      {
+        ++stats.duplicateValues;
+        stats.topDuplicates.emplace_back(std::string(text), count);
+      }
+    }
+
+    std::sort(stats.topDuplicates.begin(), stats.topDuplicates.end(), [](const auto &a, const auto &b)
+              { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+    if (stats.topDuplicates.size() > top)
+    {
+      stats.topDuplicates.resize(top);
+    }
+
+    return stats;
+  }
+
+  int runStats(const Options &options, const tool::CatalogSet &set)
+  {
+    std::vector<LocaleStats> stats(set.locales.size());
+    tool::parallelFor(set.locales.size(), options.jobs, [&](std::size_t i)
+                      { stats[i] = computeStats(set.locales[i], options.top); });
+
+    if (options.json)
+    {
+      nlohmann::json out = nlohmann::json::object();
+      for (std::size_t i = 0; i < stats.size(); ++i)
+      {
+        const auto &s = stats[i];
+        nlohmann::json depths = nlohmann::json::object();
+        for (const auto &[depth, count] : s.depths)
+        {
+          depths[std::to_string(depth)] = count;
+        }
+        nlohmann::json duplicates = nlohmann::json::array();
+        for (const auto &[text, count] : s.topDuplicates)
+        {
+          duplicates.push_back({{"text", text}, {"count", count}});
+        }
+        out[set.locales[i].code] = {
+            {"keys", s.keys},
+            {"strings", s.strings},
+            {"valueBytes", s.valueBytes},
+            {"keyBytes", s.keyBytes},
+            {"maxDepth", s.maxDepth},
+            {"depthHistogram", depths},
+            {"duplicateValues", s.duplicateValues},
+            {"duplicateBytes", s.duplicateBytes},
+            {"topDuplicates", duplicates}};
+      }
+      std::cout << out.dump(2) << std::endl;
+      return 0;
+    }
+
+    std::cout << std::left << std::setw(10) << "locale" << std::right
+              << std::setw(10) << "keys" << std::setw(10) << "strings" << std::setw(12) << "bytes"
+              << std::setw(12) << "key-bytes" << std::setw(7) << "depth" << std::setw(8) << "dups"
+              << std::setw(12) << "dup-bytes" << "\n";
+
+    std::map<std::size_t, std::size_t> depths;
+    for (std::size_t i = 0; i < stats.size(); ++i)
+    {
+      const auto &s = stats[i];
+      std::cout << std::left << std::setw(10) << set.locales[i].code << std::right
+                << std::setw(10) << s.keys << std::setw(10) << s.strings << std::setw(12) << s.valueBytes
+                << std::setw(12) << s.keyBytes << std::setw(7) << s.maxDepth << std::setw(8) << s.duplicateValues
+                << std::setw(12) << s.duplicateBytes << "\n";
+      for (const auto &[depth, count] : s.depths)
+      {
+        depths[depth] += count;
+      }
+    }
+
+    std::size_t widest = 0;
+    for (const auto &entry : depths)
+    {
+      widest = std::max(widest, entry.second);
+    }
+    std::cout << "\nDepth histogram (all locales):\n";
+    for (const auto &[depth, count] : depths)
+    {
+      std::size_t bar = widest ? (count * 40 + widest - 1) / widest : 0;
+      std::cout << std::setw(4) << depth << "  " << std::setw(10) << count << "  " << std::string(bar, '#') << "\n";
+    }
+
+    std::cout << "\nTop duplicate strings:\n";
+    for (std::size_t i = 0; i < stats.size(); ++i)
+    {
+      for (const auto &[text, count] : stats[i].topDuplicates)
+      {
+        std::cout << "  " << std::left << std::setw(8) << set.locales[i].code << std::right
+                  << "x" << std::setw(6) << std::left << count << std::right << quote(text) << "\n";
+      }
+    }
+
+    return 0;
+  }
+
+  // ---------------------------------------------------------------------------
+  // lint
+  // ---------------------------------------------------------------------------
+
+  struct Finding
+  {
+    bool error;
+    std::string locale;
+    std::string path;
+    std::string message;
+  };
+
+  void lintTree(const nlohmann::json &node, const std::string &locale, const std::string &prefix, std::vector<Finding> &out)
+  {
+    for (auto &[key, value] : node.items())
+    {
+      std::string path = prefix.empty() ? key : prefix + "." + key;
+      if (key.empty())
+      {
+        out.push_back({true, locale, path, "empty key segment"});
+      }
+      else if (key.find('.') != std::string::npos)
+      {
+        out.push_back({true, locale, path, "key contains '.', unreachable through dot-separated paths"});
+      }
+
+      if (value.is_object())
+      {
+        if (value.empty())
+        {
+          out.push_back({false, locale, path, "empty object"});
+        }
+        lintTree(value, locale, path, out);
+      }
+      else if (value.is_null())
+      {
+        out.push_back({false, locale, path, "null value, lookups fall back"});
+      }
+      else if (value.is_string())
+      {
+        const auto &text = value.get_ref<const std::string &>();
+        if (text.empty())
+        {
+          out.push_back({false, locale, path, "empty string"});
+        }
+        else if (std::isspace(static_cast<unsigned char>(text.front())) || std::isspace(static_cast<unsigned char>(text.back())))
+        {
+          out.push_back({false, locale, path, "leading or trailing whitespace"});
+        }
+      }
+    }
+  }
+
+  std::vector<Finding> lintLocale(const tool::LocaleView &view, const tool::LocaleView *ref)
+  {
+    std::vector<Finding> findings;
+    if (!view.root->is_object())
+    {
+      findings.push_back({true, view.code, "", "locale value is not an object"});
+      return findings;
+    }
+
+    lintTree(*view.root, view.code, "", findings);
+
+    if (!ref || ref == &view || !ref->root->is_object())
+    {
+      return findings;
+    }
+
+    for (const auto &leaf : view.leaves)
+    {
+      const tool::Leaf *source = ref->find(leaf.path);
+      if (!source)
+      {
+        // A leaf here may shadow an object in the reference locale.
+        const nlohmann::json *refNode = tool::resolve(*ref->root, leaf.path);
+        if (refNode && refNode->is_object())
+        {
+          findings.push_back({true, view.code, leaf.path, "value is an object in '" + ref->code + "'"});
+        }
+        continue;
+      }
+
+      if (source->value->is_string() && leaf.value->is_string())
+      {
+        auto expected = placeholders(source->value->get_ref<const std::string &>());
+        auto actual = placeholders(leaf.value->get_ref<const std::string &>());
+        if (expected != actual)
+        {
+          findings.push_back({true, view.code, leaf.path, "placeholders differ from '" + ref->code + "'"});
+        }
+      }
+      else if (source->value->type() != leaf.value->type() && !leaf.value->is_null() && !source->value->is_null())
+      {
+        findings.push_back({true, view.code, leaf.path, std::string("type ") + leaf.value->type_name() + " differs from " + source->value->type_name() + " in '" + ref->code + "'"});
+      }
+    }
+
+    return findings;
+  }
+
+  int runLint(const Options &options, const tool::CatalogSet &set)
+  {
+    const tool::LocaleView *ref = set.find(options.ref);
+    std::vector<std::vector<Finding>> perLocale(set.locales.size());
+    tool::parallelFor(set.locales.size(), options.jobs, [&](std::size_t i)
+                      { perLocale[i] = lintLocale(set.locales[i], ref); });
+
+    std::size_t errors = 0;
+    std::size_t warnings = 0;
+    for (const auto &findings : perLocale)
+    {
+      for (const auto &finding : findings)
+      {
+        bool error = finding.error || options.strict;
+        (error ? errors : warnings)++;
+        std::cout << (error ? "error: " : "warning: ") << finding.locale;
+        if (!finding.path.empty())
+        {
+          std::cout << ":" << finding.path;
+        }
+        std::cout << ": " << finding.message << "\n";
+      }
+    }
+
+    if (!ref)
+    {
+      std::cout << "warning: reference locale '" << options.ref << "' not found, cross-locale checks skipped\n";
+      ++warnings;
+    }
+
+    std::cout << errors << " error(s), " << warnings << " warning(s)" << std::endl;
+    return errors ? 1 : 0;
+  }
+
+  // ---------------------------------------------------------------------------
+  // coverage
+  // ---------------------------------------------------------------------------
+
+  bool isTranslated(const nlohmann::json &value)
+  {
+    return !value.is_null() && !(value.is_string() && value.get_ref<const std::string &>().empty());
+  }
+
+  int runCoverage(const Options &options, const tool::CatalogSet &set)
+  {
+    const tool::LocaleView *ref = set.find(options.ref);
+    if (!ref)
+    {
+      throw std::runtime_error("Reference locale not found: " + options.ref);
+    }
+
+    std::vector<const tool::Leaf *> expected;
+    for (const auto &leaf : ref->leaves)
+    {
+      if (isTranslated(*leaf.value))
+      {
+        expected.push_back(&leaf);
+      }
+    }
+
+    struct Coverage
+    {
+      std::size_t translated = 0;
+      std::size_t extra = 0;
+      std::vector<std::string> missing;
+    };
+
+    std::vector<Coverage> results(set.locales.size());
+    tool::parallelFor(set.locales.size(), options.jobs, [&](std::size_t i)
+                      {
+      const tool::LocaleView &view = set.locales[i];
+      Coverage &coverage = results[i];
+      for (const tool::Leaf *leaf : expected)
+      {
+        const tool::Leaf *match = view.find(leaf->path);
+        if (match && isTranslated(*match->value))
+        {
+          ++coverage.translated;
+        }
+        else
+        {
+          coverage.missing.push_back(leaf->path);
+        }
+      }
+      for (const auto &leaf : view.leaves)
+      {
+        if (!ref->find(leaf.path))
+        {
+          ++coverage.extra;
+        }
+      } });
+
+    bool belowMinimum = false;
+    nlohmann::json out = nlohmann::json::object();
+    for (std::size_t i = 0; i < set.locales.size(); ++i)
+    {
+      const auto &view = set.locales[i];
+      const auto &coverage = results[i];
+      double percent = expected.empty() ? 100.0 : 100.0 * static_cast<double>(coverage.translated) / static_cast<double>(expected.size());
+      if (view.code != ref->code && percent < options.minCoverage)
+      {
+        belowMinimum = true;
+      }
+
+      if (options.json)
+      {
+        out[view.code] = {
+            {"translated", coverage.translated},
+            {"total", expected.size()},
+            {"percent", percent},
+            {"extra", coverage.extra},
+            {"missing", options.verbose ? nlohmann::json(coverage.missing) : nlohmann::json(coverage.missing.size())}};
+        continue;
+      }
+
+      std::cout << std::left << std::setw(10) << view.code << std::right << std::fixed << std::setprecision(1)
+                << std::setw(7) << percent << "%  " << coverage.translated << "/" << expected.size()
+                << "  missing " << coverage.missing.size() << ", extra " << coverage.extra << "\n";
+      if (options.verbose)
+      {
+        for (const auto &path : coverage.missing)
+        {
+          std::cout << "    missing: " << path << "\n";
+        }
+      }
+    }
+
+    if (options.json)
+    {
+      std::cout << out.dump(2) << std::endl;
+    }
+
+    return belowMinimum ? 1 : 0;
+  }
+
+  // ---------------------------------------------------------------------------
+  // compile
+  // ---------------------------------------------------------------------------
+
+  int runCompile(const Options &options, const tool::CatalogSet &set)
+  {
+    for (const auto &view : set.locales)
+    {
+      if (!view.root->is_object())
+      {
+        throw std::runtime_error("Locale '" + view.code + "' is not an object");
+      }
+    }
+
+    if (!options.format.empty() && options.format != "json" && options.format != "binary")
+    {
+      throw UsageError("compile writes json or binary, not " + options.format);
+    }
+
+    if (options.format == "binary")
+    {
+      if (options.output.empty() || options.output == "-")
+      {
+        throw UsageError("Binary output needs -o <file>");
+      }
+      i18n::Catalog catalog(set.i18n.getTranslations(), {options.layout});
+      catalog.save(options.output);
+      std::cerr << "compiled " << catalog.keyCount() << " keys in " << catalog.localeCount() << " locales" << std::endl;
+      return 0;
+    }
+
+    writeOutput(options, set.i18n.getTranslations());
+    return 0;
+  }
+
+  // ---------------------------------------------------------------------------
+  // import / export
+  // ---------------------------------------------------------------------------
+
+  bool endsWith(const std::string &text, const std::string &suffix)
+  {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+  }
+
+  int runImport(const Options &options)
+  {
+    if (options.output.empty() || options.output == "-")
+    {
+      throw UsageError("import needs -o <file>");
+    }
+
+    // Entries stream from each file into the builder; no file is held in memory as a whole.
+    i18n::CatalogBuilder builder;
+    for (const auto &file : options.files)
+    {
+      std::string format = options.format;
+      if (format.empty())
+      {
+        format = endsWith(file, ".csv") ? "csv" : (endsWith(file, ".xlf") || endsWith(file, ".xliff")) ? "xliff" : "";
+      }
+
+      std::ifstream ifs(file, std::ios::binary);
+      if (!ifs.is_open())
+      {
+        throw std::runtime_error("Could not open file: " + file);
+      }
+
+      try
+      {
+        if (format == "csv")
+        {
+          i18n::importCsv(ifs, builder);
+        }
+        else if (format == "xliff")
+        {
+          i18n::importXliff(ifs, builder);
+        }
+        else
+        {
+          throw UsageError("Cannot tell the format of " + file + ", use --format csv|xliff");
+        }
+      }
+      catch (const UsageError &)
+      {
+        throw;
+      }
+      catch (const std::runtime_error &e)
+      {
+        throw std::runtime_error(file + ": " + e.what());
+      }
+    }
+
+    i18n::Catalog catalog = builder.build({options.layout, nullptr, options.invalidUtf8});
+    catalog.save(options.output);
+    std::cerr << "imported " << catalog.keyCount() << " keys in " << catalog.localeCount() << " locales" << std::endl;
+    return 0;
+  }
+
+  /**
+   * @brief Load a binary catalog, or compile a JSON one
+   */
+  i18n::Catalog loadCatalog(const std::string &file)
+  {
+    std::ifstream ifs(file, std::ios::binary);
+    char magic[sizeof(i18n::detail::BinaryFormat::magic)] = {};
+    if (ifs.read(magic, sizeof(magic)) && std::equal(std::begin(magic), std::end(magic), i18n::detail::BinaryFormat::magic))
+    {
+      return i18n::Catalog::load(file);
+    }
+    return i18n::Catalog(I18n(file).getTranslations());
+  }
+
+  int runExport(const Options &options)
+  {
+    if (options.files.size() != 1)
+    {
+      throw UsageError("export expects exactly one catalog");
+    }
+    if (options.format != "csv" && options.format != "xliff")
+    {
+      throw UsageError("export needs --format csv|xliff");
+    }
+    if (options.format == "xliff" && options.target.empty())
+    {
+      throw UsageError("XLIFF export needs --target <locale>");
+    }
+
+    i18n::Catalog catalog = loadCatalog(options.files.front());
+
+    std::ofstream file;
+    if (!options.output.empty() && options.output != "-")
+    {
+      file.open(options.output, std::ios::binary);
+      if (!file.is_open())
+      {
+        throw std::runtime_error("Could not open file: " + options.output);
+      }
+    }
+    std::ostream &out = file.is_open() ? file : std::cout;
+
+    if (options.format == "csv")
+    {
+      i18n::exportCsv(catalog, out);
+    }
+    else
+    {
+      i18n::exportXliff(catalog, out, options.ref, options.target);
+    }
+    return out.good() ? 0 : 2;
+  }
+
+  // ---------------------------------------------------------------------------
+  // diff
+  // ---------------------------------------------------------------------------
+
+  int runDiff(const Options &options)
+  {
+    if (options.files.size() != 2)
+    {
+      throw UsageError("diff expects exactly two files");
+    }
+
+    std::vector<tool::CatalogSet> sides(2);
+    tool::parallelFor(2, options.jobs, [&](std::size_t i)
+                      { sides[i] = tool::CatalogSet::load({options.files[i]}, std::max(1u, options.jobs / 2)); });
+
+    std::set<std::string> codes;
+    for (const auto &side : sides)
+    {
+      for (const auto &view : side.locales)
+      {
+        codes.insert(view.code);
+      }
+    }
+
+    std::size_t added = 0;
+    std::size_t removed = 0;
+    std::size_t changed = 0;
+    static const tool::LocaleView empty;
+
+    for (const auto &code : codes)
+    {
+      const tool::LocaleView *before = sides[0].find(code);
+      const tool::LocaleView *after = sides[1].find(code);
+      if (!before)
+      {
+        std::cout << "+ locale " << code << "\n";
+        before = &empty;
+      }
+      if (!after)
+      {
+        std::cout << "- locale " << code << "\n";
+        after = &empty;
+      }
+
+      // Both leaf lists are sorted by path, so a single merge pass finds every difference.
+      auto a = before->leaves.begin();
+      auto b = after->leaves.begin();
+      while (a != before->leaves.end() || b != after->leaves.end())
+      {
+        if (b == after->leaves.end() || (a != before->leaves.end() && a->path < b->path))
+        {
+          ++removed;
+          if (options.verbose)
+          {
+            std::cout << "- " << code << ":" << a->path << "\n";
+          }
+          ++a;
+        }
+        else if (a == before->leaves.end() || b->path < a->path)
+        {
+          ++added;
+          if (options.verbose)
+          {
+            std::cout << "+ " << code << ":" << b->path << "\n";
+          }
+          ++b;
+        }
+        else
+        {
+          if (*a->value != *b->value)
+          {
+            ++changed;
+            if (options.verbose)
+            {
+              std::cout << "~ " << code << ":" << a->path << ": " << a->value->dump() << " -> " << b->value->dump() << "\n";
+            }
+          }
+          ++a;
+          ++b;
+        }
+      }
+    }
+
+    std::cout << added << " added, " << removed << " removed, " << changed << " changed" << std::endl;
+    return added || removed || changed ? 1 : 0;
+  }
+
+  // ---------------------------------------------------------------------------
+  // prune
+  // ---------------------------------------------------------------------------
+
+  std::size_t countLeaves(const nlohmann::json &node)
+  {
+    if (!node.is_object())
+    {
+      return 1;
+    }
+    std::size_t count = 0;
+    for (const auto &child : node)
+    {
+      count += countLeaves(child);
+    }
+    return count;
+  }
+
+  /**
+   * @brief Remove null leaves, empty objects and (when @p ref is given) keys absent from @p ref.
+   *
+   * @return Number of leaves removed
+   */
+  std::size_t pruneTree(nlohmann::json &node, const nlohmann::json *ref)
+  {
+    std::size_t removed = 0;
+    for (auto it = node.begin(); it != node.end();)
+    {
+      const nlohmann::json *refChild = nullptr;
+      if (ref)
+      {
+        auto found = ref->find(it.key());
+        refChild = found != ref->end() ? &*found : nullptr;
+      }
+
+      bool orphan = ref && (!refChild || refChild->is_object() != it->is_object());
+      if (orphan || it->is_null())
+      {
+        removed += countLeaves(*it);
+        it = node.erase(it);
+        continue;
+      }
+
+      if (it->is_object())
+      {
+        removed += pruneTree(*it, refChild);
+        if (it->empty())
+        {
+          it = node.erase(it);
+          continue;
+        }
+      }
+      ++it;
+    }
+    return removed;
+  }
+
+  int runPrune(const Options &options, const tool::CatalogSet &set)
+  {
+    nlohmann::json data = set.i18n.getTranslations();
+    const nlohmann::json *ref = data.contains(options.ref) ? &data[options.ref] : nullptr;
+    if (!ref)
+    {
+      throw std::runtime_error("Reference locale not found: " + options.ref);
+    }
+
+    // Prune the reference first (nulls and empty objects only) so other locales compare against the result.
+    std::size_t removed = pruneTree(data[options.ref], nullptr);
+
+    std::vector<std::string> others;
+    for (std::string_view locale : set.i18n.getLocales())
+    {
+      std::string code(locale);
+      if (code != options.ref && data[code].is_object())
+      {
+        others.push_back(code);
+      }
+    }
+
+    std::vector<nlohmann::json *> nodes;
+    for (const auto &code : others)
+    {
+      nodes.push_back(&data[code]);
+    }
+
+    std::vector<std::size_t> counts(nodes.size());
+    tool::parallelFor(nodes.size(), options.jobs, [&](std::size_t i)
+                      { counts[i] = pruneTree(*nodes[i], ref); });
+    for (auto count : counts)
+    {
+      removed += count;
+    }
+
+    std::cerr << "pruned " << removed << " entr" << (removed == 1 ? "y" : "ies") << std::endl;
+    writeOutput(options, data);
+    return 0;
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  try
+  {
+    Options options = parseOptions(argc, argv);
+    if (options.command == "-h" || options.command == "--help" || options.command == "help")
+    {
+      std::cout << usage;
+      return 0;
+    }
+
+    if (options.files.empty())
+    {
+      throw UsageError("No input files");
+    }
+
+    if (options.command == "diff")
+    {
+      return runDiff(options);
+    }
+    if (options.command == "import")
+    {
+      return runImport(options);
+    }
+    if (options.command == "export")
+    {
+      return runExport(options);
+    }
+
+    using Command = int (*)(const Options &, const tool::CatalogSet &);
+    static const std::map<std::string, Command> commands = {
+        {"stats", runStats},
+        {"lint", runLint},
+        {"coverage", runCoverage},
+        {"compile", runCompile},
+        {"prune", runPrune}};
+
+    auto command = commands.find(options.command);
+    if (command == commands.end())
+    {
+      throw UsageError("Unknown command: " + options.command);
+    }
+
+    tool::CatalogSet set = tool::CatalogSet::load(options.files, options.jobs);
+    return command->second(options, set);
+  }
+  catch (const UsageError &e)
+  {
+    std::cerr << "i18n-tool: " << e.what() << "\n\n"
+              << usage;
+    return 2;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "i18n-tool: " << e.what() << std::endl;
+    return 2;
+  }
+}